@@ -23,6 +23,7 @@ from xml.dom import minidom
 from Frame import Frame
 from Link import Link
 from Node import Node
+from Schedule import Schedule
 import networkx as nx
 from random import random, choice, shuffle, randint
 
@@ -1033,6 +1034,34 @@ class Network:
                 else:
                     accumulative_percentage += frame_type.percentage       # If not, we go for the next one
 
+    # Scheduler Functions #
+
+    def schedule(self, configuration, mode=Schedule.ScheduleMode.configuration, quiet=True):
+        """
+        Schedule the created network with the Organic Scheduler in the same process, handing it the nodes, links,
+        paths and frames directly instead of writing the network xml file
+        :param configuration: schedule configuration xml
+        :type configuration: str
+        :param mode: scheduling mode, by default the one of the schedule configuration
+        :type mode: Schedule.ScheduleMode
+        :param quiet: True to hide the output of the scheduler
+        :type quiet: bool
+        :return: the schedule of the network
+        :rtype: Schedule
+        """
+        node_types = [node['type'].node_type for node_id, node in sorted(self.__graph.nodes(data=True))]
+        links = [[link[0], link[1], self.__link_objects_list[link_id]] for link_id, link in enumerate(self.__link_list)]
+        paths = []
+        for sender_id in self.__end_system_list:        # Same paths as the ones written in the network xml file
+            for receiver_id in self.__end_system_list:
+                if sender_id != receiver_id:
+                    for path in self.__paths[sender_id][receiver_id]:
+                        paths.append([sender_id, receiver_id, path])
+
+        return Schedule.schedule_network(node_types, links, paths, self.__frames, configuration,
+                                         self.__minimum_time_switch, self.__self_healing_protocol, mode=mode,
+                                         quiet=quiet)
+
     # Input Functions #
 
     def read_network_configuration_xml(self, configuration_file):
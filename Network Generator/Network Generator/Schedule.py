@@ -0,0 +1,226 @@
+# -*- coding: utf-8 -*-
+
+"""* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Schedule Class                                                                                                     *
+ *  Network Generator                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 18/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Class with the schedule of a network obtained from the Organic Scheduler in the same process, through the cffi     *
+ *  bindings built by scheduler_build.py. The network is handed as arrays of nodes, links, paths and frames, and the   *
+ *  schedule is returned as arrays of transmissions, with no files involved. Every network is scheduled by the         *
+ *  scheduler in its own process, so as many networks as needed can be scheduled one after the other.                  *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * """
+
+from enum import Enum
+from Link import Link
+from Node import Node
+
+
+class Schedule:
+    """
+    Class with the schedule of a network, with the transmission time of every replica of every instance of every frame
+    in every link of its paths
+    """
+
+    class ScheduleMode(Enum):
+        """
+        Class to define the scheduling modes of the scheduler, with the same values as in the scheduler. The pareto
+        mode is missing as it finds several schedules written in files
+        """
+        configuration = -1      # Keep the mode of the schedule configuration
+        one_shot = 0
+        hierarchical = 1
+        priority = 2
+        benders = 4
+        subset = 5
+
+    def __init__(self, status, hyper_period=0, rejected=None, transmissions=None):
+        """
+        Initialization of the schedule
+        :param status: 0 if the schedule was found, error code of the scheduler otherwise
+        :type status: int
+        :param hyper_period: hyper-period of the schedule in ns
+        :type hyper_period: int
+        :param rejected: list with 1 for every frame that could not be scheduled and 0 for the rest
+        :type rejected: list of int
+        :param transmissions: list of transmissions as [frame id, link id, instance, replica, time in ns]
+        :type transmissions: list of list of int
+        """
+        self.__status = status
+        self.__hyper_period = hyper_period
+        self.__rejected = rejected if rejected is not None else []
+        self.__transmissions = transmissions if transmissions is not None else []
+
+    def __str__(self):
+        """
+        Transform the information of the schedule to a string
+        :return: a string with the schedule information
+        :rtype: str
+        """
+        if not self.found:
+            return "The schedule was not found, error code " + str(self.__status)
+        return_text = "Schedule information =>\n"
+        return_text += "    Hyper-period  : " + str(self.__hyper_period) + " nanoseconds\n"
+        return_text += "    Rejected      : " + str(self.rejected_frames) + "\n"
+        return_text += "    Transmissions : " + str(len(self.__transmissions))
+        return return_text
+
+    def __get_status(self):
+        """
+        Get the result of the scheduler
+        :return: 0 if the schedule was found, error code of the scheduler otherwise
+        :rtype: int
+        """
+        return self.__status
+
+    def __get_found(self):
+        """
+        Get if the schedule was found
+        :return: True if the schedule was found, False otherwise
+        :rtype: bool
+        """
+        return self.__status == 0
+
+    def __get_hyper_period(self):
+        """
+        Get the hyper-period of the schedule in ns
+        :return: hyper-period of the schedule in ns
+        :rtype: int
+        """
+        return self.__hyper_period
+
+    def __get_rejected(self):
+        """
+        Get which frames could not be scheduled
+        :return: list with 1 for every frame that could not be scheduled and 0 for the rest
+        :rtype: list of int
+        """
+        return self.__rejected
+
+    def __get_rejected_frames(self):
+        """
+        Get the identifiers of the frames that could not be scheduled
+        :return: list of frame ids
+        :rtype: list of int
+        """
+        return [frame_id for frame_id, rejected in enumerate(self.__rejected) if rejected == 1]
+
+    def __get_transmissions(self):
+        """
+        Get all the transmissions of the schedule
+        :return: list of transmissions as [frame id, link id, instance, replica, time in ns]
+        :rtype: list of list of int
+        """
+        return self.__transmissions
+
+    def get_frame_transmissions(self, frame_id):
+        """
+        Get the transmissions of the given frame
+        :param frame_id: frame id
+        :type frame_id: int
+        :return: list of transmissions as [link id, instance, replica, time in ns]
+        :rtype: list of list of int
+        """
+        if not isinstance(frame_id, int):
+            raise TypeError('The frame id should be an integer')
+        return [transmission[1:] for transmission in self.__transmissions if transmission[0] == frame_id]
+
+    status = property(__get_status)                         # 0 if found, error code of the scheduler otherwise
+    found = property(__get_found)                           # If the schedule was found
+    hyper_period = property(__get_hyper_period)             # Hyper-period of the schedule in ns
+    rejected = property(__get_rejected)                     # 1 for every frame that could not be scheduled
+    rejected_frames = property(__get_rejected_frames)       # Identifiers of the frames that could not be scheduled
+    transmissions = property(__get_transmissions)           # All the transmissions of the schedule
+
+    # Scheduler Functions #
+
+    @staticmethod
+    def schedule_network(node_types, links, paths, frames, configuration, minimum_time_switch=0,
+                         self_healing_protocol=None, shortest_path=0, mode=ScheduleMode.configuration, quiet=True):
+        """
+        Schedule the given network with the Organic Scheduler in the same process, without writing any file.
+        Nodes, links and frames are identified by their position in the lists, as in the network xml file
+        :param node_types: type of every node
+        :type node_types: list of Node.NodeType
+        :param links: list of links as [source node id, destination node id, Link]
+        :type links: list of list
+        :param paths: list of paths as [sender id, receiver id, list of link ids], empty to compute them
+        :type paths: list of list
+        :param frames: list of frames
+        :type frames: list of Frame
+        :param configuration: schedule configuration xml
+        :type configuration: str
+        :param minimum_time_switch: minimum time in ns that a frame has to stay in a switch
+        :type minimum_time_switch: int
+        :param self_healing_protocol: self-healing protocol with its period and time in ns, None if there is none
+        :type self_healing_protocol: Network.SelfHealingProtocol
+        :param shortest_path: if the paths are computed, 1 for only the shortest one, 0 for all of them
+        :type shortest_path: int
+        :param mode: scheduling mode
+        :type mode: Schedule.ScheduleMode
+        :param quiet: True to hide the output of the scheduler
+        :type quiet: bool
+        :return: the schedule of the network
+        :rtype: Schedule
+        """
+        from _organic_scheduler import ffi, lib     # Built by scheduler_build.py, only needed to schedule
+
+        if not isinstance(configuration, str):
+            raise TypeError('The configuration should be the xml as a string')
+        if mode not in Schedule.ScheduleMode:
+            raise TypeError('The mode should be a ScheduleMode')
+        if any(node_type is Node.NodeType.access_point for node_type in node_types):
+            raise ValueError('The scheduler does not support access points')
+
+        # The arrays have to be kept alive until the network is scheduled
+        network = ffi.new('NetworkArrays *')
+        arrays = {
+            'node_types': ffi.new('int[]', [0 if node_type is Node.NodeType.switch else 1
+                                            for node_type in node_types]),
+            'link_sources': ffi.new('int[]', [link[0] for link in links]),
+            'link_destinations': ffi.new('int[]', [link[1] for link in links]),
+            'link_speeds': ffi.new('int[]', [int(link[2].speed) for link in links]),
+            'link_types': ffi.new('int[]', [0 if link[2].link_type is Link.LinkType.wired else 1 for link in links]),
+            'path_senders': ffi.new('int[]', [path[0] for path in paths]),
+            'path_receivers': ffi.new('int[]', [path[1] for path in paths]),
+            'path_lengths': ffi.new('int[]', [len(path[2]) for path in paths]),
+            'path_links': ffi.new('int[]', [link_id for path in paths for link_id in path[2]]),
+            'frame_periods': ffi.new('long long int[]', [frame.period for frame in frames]),
+            'frame_deadlines': ffi.new('long long int[]', [frame.deadline for frame in frames]),
+            'frame_sizes': ffi.new('int[]', [frame.size for frame in frames]),
+            'frame_starting_times': ffi.new('long long int[]', [frame.starting_time for frame in frames]),
+            'frame_end_to_ends': ffi.new('long long int[]', [frame.end_to_end_delay for frame in frames]),
+            'frame_senders': ffi.new('int[]', [frame.sender_id for frame in frames]),
+            'frame_num_receivers': ffi.new('int[]', [len(frame.receivers_id) for frame in frames]),
+            'frame_receivers': ffi.new('int[]', [receiver_id for frame in frames for receiver_id in frame.receivers_id])
+        }
+        for name, array in arrays.items():
+            setattr(network, name, array)
+        network.num_nodes = len(node_types)
+        network.num_links = len(links)
+        network.num_paths = len(paths)
+        network.shortest_path = shortest_path
+        network.num_frames = len(frames)
+        network.switch_minimum_time = minimum_time_switch
+        if self_healing_protocol is not None:
+            network.protocol_period = self_healing_protocol.period
+            network.protocol_time = self_healing_protocol.time
+
+        # Schedule it and copy the arrays of the schedule before freeing them
+        configuration_xml = configuration.encode('utf-8')
+        schedule = ffi.new('ScheduleArrays *')
+        status = lib.schedule_network_arrays(network, configuration_xml, len(configuration_xml), mode.value,
+                                             1 if quiet else 0, schedule)
+        if status < 0:
+            return Schedule(status)
+        rejected = list(ffi.unpack(schedule.rejected, schedule.num_frames))
+        transmissions = [[schedule.transmission_frames[i], schedule.transmission_links[i],
+                          schedule.transmission_instances[i], schedule.transmission_replicas[i],
+                          schedule.transmission_times[i]] for i in range(schedule.num_transmissions)]
+        hyper_period = schedule.hyper_period
+        lib.free_schedule_arrays(schedule)
+        return Schedule(status, hyper_period, rejected, transmissions)
@@ -0,0 +1,97 @@
+# -*- coding: utf-8 -*-
+
+"""* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Scheduler Build                                                                                                    *
+ *  Network Generator                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 18/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Script that builds the in-process bindings of the Organic Scheduler with cffi, so the generated networks can be    *
+ *  scheduled without writing and parsing xml files. It compiles the scheduler sources into the _organic_scheduler     *
+ *  extension next to this file, run it once with 'python3 scheduler_build.py' before scheduling a network.            *
+ *  The paths and libraries of the solvers are the ones of the scheduler project, they can be changed with the         *
+ *  environment variables SCHEDULER_INCLUDE_DIRS, SCHEDULER_LIBRARY_DIRS (separated by ':') and SCHEDULER_LIBRARIES    *
+ *  (separated by spaces).                                                                                             *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * """
+
+import os
+import shutil
+from glob import glob
+from cffi import FFI
+
+# Directory with the sources of the scheduler, the executable main is not part of the bindings
+DIRECTORY = os.path.dirname(os.path.abspath(__file__))
+SCHEDULER_DIRECTORY = os.path.join(DIRECTORY, '..', '..', 'Scheduler', 'Scheduler')
+SOURCES = [source for source in sorted(glob(os.path.join(SCHEDULER_DIRECTORY, '*.c')))
+           if os.path.basename(source) != 'main.c']
+
+# Same search paths and libraries as the scheduler project, unless they are given in the environment
+INCLUDE_DIRS = os.environ.get('SCHEDULER_INCLUDE_DIRS', '/usr/local/include:/usr/local/include/highs:'
+                              '/Library/gurobi752/mac64/include:/usr/local/include/libxml2:'
+                              '/usr/include/libxml2').split(':')
+LIBRARY_DIRS = os.environ.get('SCHEDULER_LIBRARY_DIRS', '/usr/local/lib:/Library/gurobi752/mac64/lib').split(':')
+LIBRARIES = os.environ.get('SCHEDULER_LIBRARIES', 'xml2 z3 gurobi75 highs').split()
+
+# Declarations of Bindings.h that are used from Python
+DECLARATIONS = """
+typedef struct NetworkArrays {
+    int num_nodes;
+    int *node_types;
+    long long int *node_precisions;
+    int num_links;
+    int *link_sources;
+    int *link_destinations;
+    int *link_speeds;
+    int *link_types;
+    int num_paths;
+    int *path_senders;
+    int *path_receivers;
+    int *path_lengths;
+    int *path_links;
+    int shortest_path;
+    int max_paths;
+    int num_frames;
+    long long int *frame_periods;
+    long long int *frame_deadlines;
+    int *frame_sizes;
+    long long int *frame_starting_times;
+    long long int *frame_end_to_ends;
+    int *frame_senders;
+    int *frame_num_receivers;
+    int *frame_receivers;
+    int *frame_priorities;
+    long long int switch_minimum_time;
+    long long int protocol_period;
+    long long int protocol_time;
+} NetworkArrays;
+
+typedef struct ScheduleArrays {
+    long long int hyper_period;
+    int num_frames;
+    int *rejected;
+    int num_transmissions;
+    int *transmission_frames;
+    int *transmission_links;
+    int *transmission_instances;
+    int *transmission_replicas;
+    long long int *transmission_times;
+} ScheduleArrays;
+
+int schedule_network_arrays(NetworkArrays *network, char *configuration, int configuration_size, int mode, int quiet,
+                            ScheduleArrays *schedule);
+void free_schedule_arrays(ScheduleArrays *schedule);
+"""
+
+ffibuilder = FFI()
+ffibuilder.cdef(DECLARATIONS)
+ffibuilder.set_source('_organic_scheduler', '#include "Scheduler.h"\n#include "Bindings.h"\n', sources=SOURCES,
+                      include_dirs=[SCHEDULER_DIRECTORY] + INCLUDE_DIRS, library_dirs=LIBRARY_DIRS,
+                      libraries=LIBRARIES, extra_compile_args=['-std=gnu11'])
+
+if __name__ == '__main__':
+    # Compile in the build directory and leave only the extension next to the generator
+    library = ffibuilder.compile(tmpdir=os.path.join(DIRECTORY, 'build'), verbose=True)
+    shutil.copy(library, DIRECTORY)
@@ -0,0 +1,369 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Analysis.c                                                                                                         *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Description in Analysis.h                                                                                          *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Analysis.h"
+#include "Network.h"
+
+/* VARIABLES */
+
+LinkSlack *links_slack = NULL;              // Slack of every link of the last analysis
+int num_links_slack = 0;                    // Number of links in the last analysis
+
+/* PRIVATE FUNCTIONS */
+
+/**
+ Transmission of an offset instance and replica in a link
+ */
+typedef struct Transmission {
+    long long int start;                    // Time when the transmission starts in ns
+    long long int end;                      // Time when the transmission ends in ns
+    int link;                               // Link of the transmission
+}Transmission;
+
+/**
+ Sort the transmissions by starting time with a LSD radix sort of 8 bits per digit.
+ The number of passes only depends on the largest starting time (the hyper-period), so it is linear
+
+ @param transmissions array of transmissions to sort
+ @param buffer auxiliar array of the same size
+ @param num_transmissions number of transmissions
+ @param max_time largest starting time of the transmissions
+ @return pointer to the array that contains the sorted transmissions (transmissions or buffer)
+ */
+Transmission * radix_sort_transmissions(Transmission *transmissions, Transmission *buffer, int num_transmissions,
+                                        long long int max_time) {
+    
+    int count[256];
+    Transmission *source = transmissions, *destination = buffer, *swap;
+    
+    for (int shift = 0; shift < 64 && (max_time >> shift) > 0; shift += 8) {
+        for (int digit = 0; digit < 256; digit++) {
+            count[digit] = 0;
+        }
+        for (int it = 0; it < num_transmissions; it++) {
+            count[(source[it].start >> shift) & 0xFF]++;
+        }
+        for (int digit = 1; digit < 256; digit++) {
+            count[digit] += count[digit - 1];
+        }
+        // Backwards to keep the order of the previous digits (stable)
+        for (int it = num_transmissions - 1; it >= 0; it--) {
+            destination[--count[(source[it].start >> shift) & 0xFF]] = source[it];
+        }
+        swap = source;
+        source = destination;
+        destination = swap;
+    }
+    
+    return source;
+}
+
+/**
+ Add a gap into the slack of the link
+
+ @param slack_pt pointer to the slack of the link
+ @param start time when the gap starts in ns
+ @param length length of the gap in ns
+ */
+void add_gap(LinkSlack *slack_pt, long long int start, long long int length) {
+    
+    int bucket = 0;
+    
+    if (length <= 0) {
+        return;
+    }
+    slack_pt->gaps[slack_pt->num_gaps].start = start;
+    slack_pt->gaps[slack_pt->num_gaps].length = length;
+    slack_pt->num_gaps++;
+    slack_pt->free_time += length;
+    if (length > slack_pt->largest_gap) {
+        slack_pt->largest_gap = length;
+    }
+    while (bucket < NUM_GAP_BUCKETS - 1 && (length >> (bucket + 1)) > 0) {
+        bucket++;
+    }
+    slack_pt->histogram[bucket]++;
+}
+
+/**
+ Calculate the slack of a link with its transmissions sorted by starting time
+
+ @param slack_pt pointer to the slack of the link
+ @param transmissions transmissions of the link sorted by starting time
+ @param num_transmissions number of transmissions of the link
+ @param link_id identifier of the link
+ */
+void analyze_link_slack(LinkSlack *slack_pt, Transmission *transmissions, int num_transmissions, int link_id) {
+    
+    long long int hyper_period = get_hyper_period();
+    long long int period = get_protocol_period();
+    long long int busy;                     // Busy time in the current protocol period
+    long long int min_free;                 // Free time in the least free protocol period
+    long long int first_busy = 0;           // Busy time in the first protocol period
+    long long int wrap_busy = 0;            // Busy time of transmissions that wrap around to the first period
+    long long int window, next_window;      // Protocol period of the start and end of a transmission
+    long long int window_end;               // End of the current protocol period
+    long long int last_length;              // Length of the last protocol period, clipped by the hyper-period
+    long long int start, end;
+    int num_windows;                        // Number of protocol periods in the hyper-period
+    
+    slack_pt->gaps = malloc(sizeof(Gap) * (num_transmissions + 1));
+    slack_pt->num_gaps = 0;
+    slack_pt->largest_gap = 0;
+    slack_pt->free_time = 0;
+    for (int bucket = 0; bucket < NUM_GAP_BUCKETS; bucket++) {
+        slack_pt->histogram[bucket] = 0;
+    }
+    
+    if (num_transmissions == 0) {
+        add_gap(slack_pt, 0, hyper_period);
+    } else {
+        // Gaps between consecutive transmissions, the last one wraps around the hyper-period to the first one
+        for (int it = 0; it < num_transmissions - 1; it++) {
+            add_gap(slack_pt, transmissions[it].end, transmissions[it + 1].start - transmissions[it].end);
+        }
+        add_gap(slack_pt, transmissions[num_transmissions - 1].end,
+                hyper_period - transmissions[num_transmissions - 1].end + transmissions[0].start);
+    }
+    
+    // The guaranteed best-effort time is the free time of the least free protocol period. As transmissions are sorted,
+    // we only visit the periods with transmissions, the rest are completely free
+    slack_pt->min_free_period = -1;
+    slack_pt->best_effort_bytes = 0;
+    if (period <= 0) {
+        return;
+    }
+    num_windows = (int) ((hyper_period + period - 1) / period);
+    // If the hyper-period is not a multiple of the protocol period, the last one is cut by the end of the hyper-period
+    last_length = hyper_period - (long long int) (num_windows - 1) * period;
+    min_free = period;
+    window = 0;
+    busy = 0;
+    for (int it = 0; it < num_transmissions; it++) {
+        start = transmissions[it].start;
+        end = transmissions[it].end;
+        // Split the transmission if it crosses the end of a period
+        while (start < end) {
+            // If the transmission wraps around the hyper-period, the rest is transmitted in the first period
+            if (start >= hyper_period) {
+                wrap_busy += end - start;
+                break;
+            }
+            next_window = start / period;
+            if (next_window != window) {
+                if (window == 0) {
+                    first_busy = busy;
+                } else if (period - busy < min_free) {
+                    min_free = period - busy;
+                }
+                window = next_window;
+                busy = 0;
+            }
+            window_end = (window + 1) * period < hyper_period ? (window + 1) * period : hyper_period;
+            if (end <= window_end) {
+                busy += end - start;
+                start = end;
+            } else {
+                busy += window_end - start;
+                start = window_end;
+            }
+        }
+    }
+    if (window == 0) {
+        first_busy = busy;
+    } else if (window < num_windows - 1 && period - busy < min_free) {
+        min_free = period - busy;
+    }
+    // The last period is only as long as the part left of the hyper-period, even if it has no transmissions
+    if (num_windows > 1) {
+        if (window < num_windows - 1) {
+            busy = 0;
+        }
+        if (last_length - busy < min_free) {
+            min_free = last_length - busy;
+        }
+    }
+    // The first period also has the transmissions that wrap around the hyper-period
+    busy = first_busy + wrap_busy;
+    if ((num_windows > 1 ? period : last_length) - busy < min_free) {
+        min_free = (num_windows > 1 ? period : last_length) - busy;
+    }
+    slack_pt->min_free_period = min_free;
+    if (slack_pt->min_free_period < 0) {
+        slack_pt->min_free_period = 0;
+    }
+    // The time to transmit is size * 1000 / speed in ns, so the bytes that fit are time * speed / 1000
+    slack_pt->best_effort_bytes = (slack_pt->min_free_period * get_link_speed(get_link(link_id))) / 1000;
+}
+
+/* PUBLIC FUNCTIONS */
+
+/**
+ Calculate the free gaps of all links with the transmission times of the obtained schedule.
+ Transmissions are sorted by time with a radix sort and then by link with a stable counting sort, so it is linear in
+ the number of transmissions
+
+ @return 0 if done correctly, error code otherwise
+ */
+int analyze_slack(void) {
+    
+    Transmission *transmissions, *buffer, *sorted, *by_link;
+    int num_transmissions = 0;
+    int *link_start;                        // First transmission of every link after sorting them by link
+    Frame *frame_pt;
+    Offset *offset_pt;
+    long long int start;
+    long long int max_time = 0;
+    
+    free_slack_analysis();
+    
+    // Count all the transmissions to allocate them only once
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        offset_pt = get_offset_root(get_frame(frame_it));
+        while (!is_last_offset(offset_pt)) {
+            num_transmissions += get_num_instances(offset_pt) * get_num_replicas(offset_pt);
+            offset_pt = get_next_offset(offset_pt);
+        }
+    }
+    transmissions = malloc(sizeof(Transmission) * (num_transmissions + 1));
+    buffer = malloc(sizeof(Transmission) * (num_transmissions + 1));
+    
+    num_transmissions = 0;
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            for (int instance = 0; instance < get_num_instances(offset_pt); instance++) {
+                for (int replica = 0; replica < get_num_replicas(offset_pt); replica++) {
+                    start = get_offset(offset_pt, instance, replica);
+                    if (start <= 0) {               // Transmission time 0 is for offsets that are not used
+                        continue;
+                    }
+                    transmissions[num_transmissions].start = start;
+                    transmissions[num_transmissions].end = start + get_timeslot_size(offset_pt);
+                    transmissions[num_transmissions].link = get_offset_link(offset_pt);
+                    if (start > max_time) {
+                        max_time = start;
+                    }
+                    num_transmissions++;
+                }
+            }
+            offset_pt = get_next_offset(offset_pt);
+        }
+    }
+    
+    // Sort by time, and then by link keeping the time order
+    sorted = radix_sort_transmissions(transmissions, buffer, num_transmissions, max_time);
+    by_link = (sorted == transmissions) ? buffer : transmissions;
+    link_start = malloc(sizeof(int) * (get_num_links() + 1));
+    for (int link_it = 0; link_it <= get_num_links(); link_it++) {
+        link_start[link_it] = 0;
+    }
+    for (int it = 0; it < num_transmissions; it++) {
+        link_start[sorted[it].link + 1]++;
+    }
+    for (int link_it = 0; link_it < get_num_links(); link_it++) {
+        link_start[link_it + 1] += link_start[link_it];
+    }
+    for (int it = 0; it < num_transmissions; it++) {
+        by_link[link_start[sorted[it].link]++] = sorted[it];
+    }
+    // After placing them, every position points to the start of the next link
+    for (int link_it = get_num_links(); link_it > 0; link_it--) {
+        link_start[link_it] = link_start[link_it - 1];
+    }
+    link_start[0] = 0;
+    
+    num_links_slack = get_num_links();
+    links_slack = malloc(sizeof(LinkSlack) * num_links_slack);
+    for (int link_it = 0; link_it < num_links_slack; link_it++) {
+        analyze_link_slack(&links_slack[link_it], &by_link[link_start[link_it]],
+                           link_start[link_it + 1] - link_start[link_it], link_it);
+    }
+    
+    free(link_start);
+    free(transmissions);
+    free(buffer);
+    return 0;
+}
+
+/**
+ Get the slack analysis of the given link
+
+ @param link_id identifier of the link
+ @return pointer to the slack of the link, NULL if it was not analyzed
+ */
+LinkSlack * get_link_slack(int link_id) {
+    
+    if (link_id < 0 || link_id >= num_links_slack) {
+        printf("The link was not analyzed\n");
+        return NULL;
+    }
+    
+    return &links_slack[link_id];
+}
+
+/**
+ Print a summary of the slack of every link
+
+ @return 0 if done correctly, error code otherwise
+ */
+int print_slack_analysis(void) {
+    
+    LinkSlack *slack_pt;
+    int last_bucket;
+    
+    if (links_slack == NULL) {
+        printf("There is no slack analysis to print\n");
+        return NO_SLACK_ANALYSIS;
+    }
+    
+    printf("Best-effort slack in the hyper-period of %lld ns\n", get_hyper_period());
+    for (int link_it = 0; link_it < num_links_slack; link_it++) {
+        slack_pt = &links_slack[link_it];
+        printf("Link %d: %d gaps, free %lld ns, largest gap %lld ns", link_it, slack_pt->num_gaps,
+               slack_pt->free_time, slack_pt->largest_gap);
+        if (slack_pt->min_free_period >= 0) {
+            printf(", guaranteed %lld ns (%lld bytes) every %lld ns", slack_pt->min_free_period,
+                   slack_pt->best_effort_bytes, get_protocol_period());
+        }
+        // Histogram only until the largest bucket with gaps
+        last_bucket = -1;
+        for (int bucket = 0; bucket < NUM_GAP_BUCKETS; bucket++) {
+            if (slack_pt->histogram[bucket] > 0) {
+                last_bucket = bucket;
+            }
+        }
+        printf(", histogram (2^i ns):");
+        for (int bucket = 0; bucket <= last_bucket; bucket++) {
+            printf(" %d", slack_pt->histogram[bucket]);
+        }
+        printf("\n");
+    }
+    
+    return 0;
+}
+
+/**
+ Free the memory of the last slack analysis
+ */
+void free_slack_analysis(void) {
+    
+    if (links_slack != NULL) {
+        for (int link_it = 0; link_it < num_links_slack; link_it++) {
+            free(links_slack[link_it].gaps);
+        }
+        free(links_slack);
+    }
+    links_slack = NULL;
+    num_links_slack = 0;
+}
@@ -0,0 +1,81 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Analysis.h                                                                                                         *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Package that analyzes an obtained schedule.                                                                        *
+ *  It calculates the free time that every link leaves for the best-effort traffic, which is not scheduled.            *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef Analysis_h
+#define Analysis_h
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#endif /* Analysis_h */
+
+/* STRUCT DEFINITIONS */
+
+#define NUM_GAP_BUCKETS 64
+
+/**
+ Interval of time in a link without any scheduled transmission
+ */
+typedef struct Gap {
+    long long int start;                // Time when the gap starts in ns
+    long long int length;               // Duration of the gap in ns
+}Gap;
+
+/**
+ Free time of a link in the hyper-period left for the best-effort traffic
+ */
+typedef struct LinkSlack {
+    Gap *gaps;                          // Gaps of the link sorted by starting time (the last one can wrap around)
+    int num_gaps;                       // Number of gaps in the link
+    long long int largest_gap;          // Length of the largest gap in ns
+    long long int free_time;            // Total free time in the hyper-period in ns
+    int histogram[NUM_GAP_BUCKETS];     // Number of gaps with length in [2^i, 2^(i+1)) ns
+    long long int min_free_period;      // Minimum free time in any protocol period in ns, -1 if there is no period
+    long long int best_effort_bytes;    // Bytes of best-effort traffic guaranteed in every protocol period
+}LinkSlack;
+
+/* ERROR CODE DEFINITIONS */
+
+#define NO_SLACK_ANALYSIS -1
+#define SLACK_LINK_OUT_OF_RANGE -2
+
+/* CODE DEFINITIONS */
+
+/**
+ Calculate the free gaps of all links with the transmission times of the obtained schedule.
+ Transmissions are sorted by time with a radix sort and then by link with a stable counting sort, so it is linear in
+ the number of transmissions
+
+ @return 0 if done correctly, error code otherwise
+ */
+int analyze_slack(void);
+
+/**
+ Get the slack analysis of the given link
+
+ @param link_id identifier of the link
+ @return pointer to the slack of the link, NULL if it was not analyzed
+ */
+LinkSlack * get_link_slack(int link_id);
+
+/**
+ Print a summary of the slack of every link
+
+ @return 0 if done correctly, error code otherwise
+ */
+int print_slack_analysis(void);
+
+/**
+ Free the memory of the last slack analysis
+ */
+void free_slack_analysis(void);
@@ -0,0 +1,172 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Backend.c                                                                                                          *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Description in Backend.h                                                                                           *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Backend.h"
+
+/* VARIABLES */
+
+int backend_statistics = 0;         // 1 if the built in engines print the statistics of every solve
+
+/* PRIVATE FUNCTIONS */
+
+/**
+ Load the backend of the given shared library. The library is never unloaded, as the backend can be used again in
+ later stages
+
+ @param path path of the shared library
+ @return pointer to the backend, NULL if it could not be loaded
+ */
+SolverBackend * load_solver_backend(char *path) {
+    
+    void *library;
+    BackendEntryPoint entry_point;
+    SolverBackend *backend;
+    
+    library = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (library == NULL) {
+        printf("The backend %s could not be loaded: %s\n", path, dlerror());
+        return NULL;
+    }
+    entry_point = (BackendEntryPoint) dlsym(library, BACKEND_ENTRY_POINT);
+    if (entry_point == NULL) {
+        printf("The backend %s does not have the function %s\n", path, BACKEND_ENTRY_POINT);
+        dlclose(library);
+        return NULL;
+    }
+    backend = entry_point();
+    if (backend == NULL || backend->version != BACKEND_INTERFACE_VERSION) {
+        printf("The backend %s does not implement the version %d of the interface\n", path,
+               BACKEND_INTERFACE_VERSION);
+        dlclose(library);
+        return NULL;
+    }
+    // Operations needed to build and solve any model, the rest are optional
+    if (backend->create == NULL || backend->new_var == NULL || backend->add_diff == NULL ||
+        backend->add_guarded == NULL || backend->add_disjunction == NULL || backend->set_objective == NULL ||
+        backend->solve == NULL || backend->get_value == NULL || backend->destroy == NULL) {
+        printf("The backend %s does not implement all the needed operations\n", path);
+        dlclose(library);
+        return NULL;
+    }
+    
+    return backend;
+}
+
+/* PUBLIC FUNCTIONS */
+
+/**
+ Get the built in backend with the given name, no shared library is loaded
+
+ @param name name of the backend
+ @return pointer to the backend, NULL if there is no built in backend with such name
+ */
+SolverBackend * get_built_in_backend(char *name) {
+    
+    SolverBackend *built_in[5];
+    
+    built_in[0] = get_z3_backend();
+    built_in[1] = get_gurobi_backend();
+    built_in[2] = get_highs_backend();
+    built_in[3] = get_cp_backend();
+    built_in[4] = get_sat_backend();
+    for (int backend_it = 0; backend_it < 5; backend_it++) {
+        if (strcmp(built_in[backend_it]->name, name) == 0) {
+            return built_in[backend_it];
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ Get the backend with the given name. Built in backends are searched first, if there is none with such name, it is
+ loaded as a shared library (for example "./libscheduler_cp.so") that implements BACKEND_ENTRY_POINT
+
+ @param name name of the backend or path of the shared library
+ @return pointer to the backend, NULL if it was not found
+ */
+SolverBackend * get_solver_backend(char *name) {
+    
+    SolverBackend *backend;
+    
+    backend = get_built_in_backend(name);
+    if (backend != NULL) {
+        return backend;
+    }
+    
+    return load_solver_backend(name);
+}
+
+/**
+ Set if the built in engines print the statistics of every solve, as the literals of the SAT encoding or the failures
+ of the CP search
+
+ @param statistics 1 to print the statistics, 0 otherwise
+ */
+void set_backend_statistics(int statistics) {
+    
+    backend_statistics = statistics;
+}
+
+/**
+ Get if the built in engines print the statistics of every solve
+
+ @return 1 if the statistics are printed, 0 otherwise
+ */
+int get_backend_statistics(void) {
+    
+    return backend_statistics;
+}
+
+/**
+ Initialize a linear constraint with the difference between two variables
+ variable1 - variable2 (sense) rhs
+
+ @param constraint pointer to the constraint to initialize
+ @param variable1 handle of the first variable, NO_VARIABLE if there is none
+ @param variable2 handle of the second variable, NO_VARIABLE if there is none
+ @param sense relation between the difference and the right hand side
+ @param rhs right hand side
+ */
+void init_difference(LinearConstraint *constraint, int variable1, int variable2, ConstraintSense sense,
+                     long long int rhs) {
+    
+    constraint->num_variables = 0;
+    constraint->sense = sense;
+    constraint->rhs = rhs;
+    add_linear_term(constraint, variable1, 1);
+    add_linear_term(constraint, variable2, -1);
+}
+
+/**
+ Add a variable with the given coefficient into a linear constraint, unless it is NO_VARIABLE
+
+ @param constraint pointer to the constraint
+ @param variable handle of the variable
+ @param value coefficient of the variable
+ @return 0 if done correctly, error code otherwise
+ */
+int add_linear_term(LinearConstraint *constraint, int variable, long long int value) {
+    
+    if (variable == NO_VARIABLE) {
+        return 0;
+    }
+    if (constraint->num_variables == MAX_LINEAR_VARIABLES) {
+        printf("A linear constraint can have at most %d variables\n", MAX_LINEAR_VARIABLES);
+        return BACKEND_OPERATION_NOT_SUPPORTED;
+    }
+    
+    constraint->variables[constraint->num_variables] = variable;
+    constraint->values[constraint->num_variables] = value;
+    constraint->num_variables++;
+    return 0;
+}
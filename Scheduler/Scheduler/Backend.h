@@ -0,0 +1,242 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Backend.h                                                                                                          *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Package that contains the interface between the optimizator and the solvers.                                       *
+ *  Every solver is a backend with a table of operations to create variables and constraints, solve them and read the  *
+ *  solution. Variables are identified by an integer handle given by the backend, so the optimizator builds the same   *
+ *  model for all of them. Backends are built in (z3, gurobi, HiGHS, the CP engine and the SAT encoding) or loaded     *
+ *  from a shared library at runtime.                                                                                  *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef Backend_h
+#define Backend_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <dlfcn.h>
+
+#endif /* Backend_h */
+
+/* ERROR CODE DEFINITIONS */
+
+#define BACKEND_NOT_FOUND -1
+#define BACKEND_VERSION_NOT_SUPPORTED -2
+#define BACKEND_OPERATION_NOT_SUPPORTED -3
+#define BACKEND_TIME_LIMIT -4
+#define EXPORT_FILE_NOT_OPENED -501
+#define EXPORT_FORMAT_NOT_SUPPORTED -502
+
+/* CODE DEFINITIONS */
+
+#define BACKEND_INTERFACE_VERSION 3                 // Version of the operations table, increased if it changes
+#define BACKEND_ENTRY_POINT "get_scheduler_backend" // Function that returns the backend of a shared library
+#define MAX_LINEAR_VARIABLES 4                      // Maximum number of variables in a linear constraint
+#define NO_VARIABLE -1                              // Handle of a variable that does not exist
+#define SOLUTION_NOT_PROVEN 2                       // Solution found but not proven the best by the time limit
+#define INFINITE_BOUND LLONG_MAX                    // Bound of a variable that is not bounded
+
+/* STRUCT DEFINITIONS */
+
+/**
+ Formats to export the generated model into a file
+ */
+typedef enum ExportFormat {
+    no_export,
+    smt2_export,
+    lp_export,
+    mps_export,
+    dimacs_export
+}ExportFormat;
+
+/**
+ Domains of the variables of a backend
+ */
+typedef enum VariableDomain {
+    integer_domain,                     // Integer variable between its lower and upper bounds
+    boolean_domain                      // Boolean literal, 0 is false and 1 is true in linear constraints
+}VariableDomain;
+
+/**
+ Relation between the two sides of a linear constraint
+ */
+typedef enum ConstraintSense {
+    sense_less_equal,
+    sense_greater_equal,
+    sense_equal
+}ConstraintSense;
+
+/**
+ Linear constraint values[0] * variables[0] + ... + values[n - 1] * variables[n - 1] (sense) rhs.
+ The constraints of the schedule are differences between two offsets, sometimes with a third variable that moves them
+ (distances, spacing or latencies), so they only have a few variables
+ */
+typedef struct LinearConstraint {
+    int num_variables;                          // Number of variables of the constraint
+    int variables[MAX_LINEAR_VARIABLES];        // Handles of the variables
+    long long int values[MAX_LINEAR_VARIABLES]; // Coefficient of every variable
+    ConstraintSense sense;                      // Relation between the sum and the right hand side
+    long long int rhs;                          // Right hand side
+}LinearConstraint;
+
+/**
+ Table of operations of a backend. A backend only keeps one model at a time, created with create and freed with
+ destroy. Operations return 0 (or the handle of the new variable) if done correctly and a negative error code otherwise
+ */
+typedef struct SolverBackend {
+    int version;                        // Version of the interface implemented, BACKEND_INTERFACE_VERSION
+    char *name;                         // Name of the backend, as written in the schedule configuration
+    int distances;                      // 1 if the distances between transmissions can be maximized (MIP solvers)
+
+    // Create an empty model, freeing the previous one if it was not destroyed
+    int (*create)(void);
+    // Export the model into the given file in the given format once it is solved, error if not supported
+    int (*open_export)(ExportFormat format, char *filename);
+    // Create a variable and return its handle. Variables with the same lower and upper bounds are constants.
+    // The index identifies the variable when it has no name
+    int (*new_var)(long long int lower, long long int upper, VariableDomain domain, int index, char *name);
+    // Add a linear constraint, usually the difference between two offsets
+    int (*add_diff)(LinearConstraint *constraint);
+    // Add a linear constraint that only holds when the boolean literal has the given value (0 or 1)
+    int (*add_guarded)(int literal, int value, LinearConstraint *constraint);
+    // Add that at least one of the constraints holds, unless any of the guard literals is false
+    int (*add_disjunction)(int num_constraints, LinearConstraint *constraints, int num_guards, int *guards);
+    // Add that the result literal is true if and only if any of the literals is true
+    int (*add_or)(int result, int num_literals, int *literals);
+    // Add that exactly one of the literals is true
+    int (*add_exactly_one)(int num_literals, int *literals);
+    // Add a disjunctive resource where the tasks (start variable and duration) never overlap, NULL if not supported
+    int (*add_resource)(int num_tasks, int *variables, long long int *durations);
+    // Add an objective to maximize the weighted sum of the variables, less important than the previous ones
+    int (*set_objective)(int num_variables, int *variables, double *values);
+    // Change the lower bound of a variable for the next calls to solve
+    int (*set_lower_bound)(int variable, long long int lower);
+    // Solve the model with the given time limit in seconds, 1 if a solution was found, SOLUTION_NOT_PROVEN if the time
+    // limit stopped the search after finding one, 0 if there is none, BACKEND_TIME_LIMIT if the time limit stopped it
+    // before finding any, error otherwise
+    int (*solve)(int time);
+    // Solve the model assuming that the literals are true, 1 if a solution was found, 0 if not and then the literals
+    // in conflict (unsat core) are saved in core, error if it is unknown. NULL if the backend cannot find cores
+    int (*solve_assuming)(int time, int num_literals, int *literals, int *num_core, int *core);
+    // Look for better parameters of the solver within the given time limit, NULL if the backend cannot tune
+    int (*tune)(int time);
+    // Get the value of a variable in the last solution found
+    int (*get_value)(int variable, long long int *value);
+    // Get the number of constraints added into the model
+    long long int (*get_num_constraints)(void);
+    // Free the model, it can be called several times
+    void (*destroy)(void);
+}SolverBackend;
+
+/**
+ Function of a shared library that returns its backend, named BACKEND_ENTRY_POINT
+ */
+typedef SolverBackend * (*BackendEntryPoint)(void);
+
+/**
+ Get the built in backend of z3, which finds the schedule with its optimize solver (description in Z3Backend.h)
+
+ @return pointer to the backend
+ */
+SolverBackend * get_z3_backend(void);
+
+/**
+ Get the built in backend of gurobi (description in MIPBackend.h)
+
+ @return pointer to the backend
+ */
+SolverBackend * get_gurobi_backend(void);
+
+/**
+ Get the built in backend of HiGHS (description in MIPBackend.h)
+
+ @return pointer to the backend
+ */
+SolverBackend * get_highs_backend(void);
+
+/**
+ Get the built in backend of the CP engine, which finds the schedule with its own propagation and search (description
+ in CPBackend.h)
+
+ @return pointer to the backend
+ */
+SolverBackend * get_cp_backend(void);
+
+/**
+ Get the built in backend of the time-indexed SAT encoding, solved with the SAT core of z3 (description in
+ SATBackend.h)
+
+ @return pointer to the backend
+ */
+SolverBackend * get_sat_backend(void);
+
+/**
+ Set the length of the macrotick of the SAT encoding for the next models. Variables take a value every macrotick from
+ their lower bound, so a larger macrotick gives a smaller encoding that misses the values in between, and every
+ variable can span at most SAT_MAX_MACROTICKS of them
+
+ @param macrotick length of the macrotick in ns, 0 or less to use the default one
+ */
+void set_sat_macrotick(long long int macrotick);
+
+/**
+ Get the built in backend with the given name, no shared library is loaded
+
+ @param name name of the backend
+ @return pointer to the backend, NULL if there is no built in backend with such name
+ */
+SolverBackend * get_built_in_backend(char *name);
+
+/**
+ Get the backend with the given name. Built in backends are searched first, if there is none with such name, it is
+ loaded as a shared library (for example "./libscheduler_cp.so") that implements BACKEND_ENTRY_POINT
+
+ @param name name of the backend or path of the shared library
+ @return pointer to the backend, NULL if it was not found
+ */
+SolverBackend * get_solver_backend(char *name);
+
+/**
+ Set if the built in engines print the statistics of every solve, as the literals of the SAT encoding or the failures
+ of the CP search
+
+ @param statistics 1 to print the statistics, 0 otherwise
+ */
+void set_backend_statistics(int statistics);
+
+/**
+ Get if the built in engines print the statistics of every solve
+
+ @return 1 if the statistics are printed, 0 otherwise
+ */
+int get_backend_statistics(void);
+
+/**
+ Initialize a linear constraint with the difference between two variables
+ variable1 - variable2 (sense) rhs
+
+ @param constraint pointer to the constraint to initialize
+ @param variable1 handle of the first variable, NO_VARIABLE if there is none
+ @param variable2 handle of the second variable, NO_VARIABLE if there is none
+ @param sense relation between the difference and the right hand side
+ @param rhs right hand side
+ */
+void init_difference(LinearConstraint *constraint, int variable1, int variable2, ConstraintSense sense,
+                     long long int rhs);
+
+/**
+ Add a variable with the given coefficient into a linear constraint, unless it is NO_VARIABLE
+
+ @param constraint pointer to the constraint
+ @param variable handle of the variable
+ @param value coefficient of the variable
+ @return 0 if done correctly, error code otherwise
+ */
+int add_linear_term(LinearConstraint *constraint, int variable, long long int value);
@@ -0,0 +1,324 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Bindings.c                                                                                                         *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 18/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Scheduler.h"
+#include "Driver.h"
+#include "Bindings.h"
+
+/* PRIVATE FUNCTIONS */
+
+/**
+ Build in memory the network given as arrays
+
+ @param network pointer to the network given as arrays
+ @return 0 if done correctly, error code otherwise
+ */
+int build_network_arrays(NetworkArrays *network) {
+    
+    int path_start = 0, receivers_start = 0;
+    
+    if (create_network() < 0) {
+        return ERROR_BUILDING_NETWORK;
+    }
+    if (set_switch_minimum_time(network->switch_minimum_time) < 0) {
+        return ERROR_BUILDING_NETWORK;
+    }
+    if (network->protocol_period > 0) {
+        if (set_protocol_period(network->protocol_period) < 0 || set_protocol_time(network->protocol_time) < 0) {
+            return ERROR_BUILDING_NETWORK;
+        }
+    }
+    
+    for (int node_it = 0; node_it < network->num_nodes; node_it++) {
+        if (add_network_node(network->node_types[node_it],
+                             network->node_precisions != NULL ? network->node_precisions[node_it] : 0) < 0) {
+            return ERROR_BUILDING_NETWORK;
+        }
+    }
+    for (int link_it = 0; link_it < network->num_links; link_it++) {
+        if (add_network_link(network->link_sources[link_it], network->link_destinations[link_it],
+                             network->link_speeds[link_it], network->link_types[link_it]) < 0) {
+            return ERROR_BUILDING_NETWORK;
+        }
+    }
+    
+    // Paths not given are computed from the links
+    for (int path_it = 0; path_it < network->num_paths; path_it++) {
+        if (add_path(network->path_senders[path_it], network->path_receivers[path_it],
+                     &network->path_links[path_start], network->path_lengths[path_it]) < 0) {
+            return ERROR_BUILDING_NETWORK;
+        }
+        path_start += network->path_lengths[path_it];
+    }
+    if (network->num_paths == 0) {
+        if (compute_network_paths(network->shortest_path, network->max_paths) < 0) {
+            return ERROR_BUILDING_NETWORK;
+        }
+    }
+    
+    for (int frame_it = 0; frame_it < network->num_frames; frame_it++) {
+        if (add_network_frame(network->frame_periods[frame_it], network->frame_deadlines[frame_it],
+                              network->frame_sizes[frame_it], network->frame_starting_times[frame_it],
+                              network->frame_end_to_ends[frame_it], network->frame_senders[frame_it],
+                              &network->frame_receivers[receivers_start],
+                              network->frame_num_receivers[frame_it]) < 0) {
+            return ERROR_BUILDING_NETWORK;
+        }
+        receivers_start += network->frame_num_receivers[frame_it];
+    }
+    // The priorities are set once all frames are added, as the array of frames moves while it grows
+    if (network->frame_priorities != NULL) {
+        for (int frame_it = 0; frame_it < network->num_frames; frame_it++) {
+            if (set_priority(get_frame(frame_it), network->frame_priorities[frame_it]) < 0) {
+                return ERROR_BUILDING_NETWORK;
+            }
+        }
+    }
+    
+    if (finalize_network() < 0) {
+        return ERROR_BUILDING_NETWORK;
+    }
+    return 0;
+}
+
+/**
+ Send through the pipe the result of the schedule and, if it was found, the schedule of the network
+
+ @param pipe_fd pipe to write the schedule
+ @param result 0 if the schedule was found, error code otherwise
+ @return 0 if done correctly, error code otherwise
+ */
+int send_schedule_arrays(int pipe_fd, int result) {
+    
+    Frame *frame_pt;
+    Offset *offset_pt;
+    long long int hyper_period, time;
+    int num_frames, rejected, num_transmissions = 0;
+    int transmission[4];
+    
+    if (write_pipe(pipe_fd, &result, sizeof(int)) < 0) {
+        return SCHEDULE_PROCESS_FAILED;
+    }
+    if (result < 0) {
+        return 0;
+    }
+    hyper_period = get_hyper_period();
+    num_frames = get_num_frames();
+    if (write_pipe(pipe_fd, &hyper_period, sizeof(long long int)) < 0 ||
+        write_pipe(pipe_fd, &num_frames, sizeof(int)) < 0) {
+        return SCHEDULE_PROCESS_FAILED;
+    }
+    for (int frame_it = 0; frame_it < num_frames; frame_it++) {
+        rejected = get_rejected(get_frame(frame_it));
+        if (write_pipe(pipe_fd, &rejected, sizeof(int)) < 0) {
+            return SCHEDULE_PROCESS_FAILED;
+        }
+    }
+    
+    // Only the offsets in the chosen paths of the frames not rejected are transmitted, as in the schedule xml
+    for (int frame_it = 0; frame_it < num_frames; frame_it++) {
+        frame_pt = get_frame(frame_it);
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            if (get_rejected(frame_pt) == 0 && get_offset_chosen(offset_pt) == 1) {
+                num_transmissions += get_num_instances(offset_pt) * get_num_replicas(offset_pt);
+            }
+            offset_pt = get_next_offset(offset_pt);
+        }
+    }
+    if (write_pipe(pipe_fd, &num_transmissions, sizeof(int)) < 0) {
+        return SCHEDULE_PROCESS_FAILED;
+    }
+    for (int frame_it = 0; frame_it < num_frames; frame_it++) {
+        frame_pt = get_frame(frame_it);
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            if (get_rejected(frame_pt) == 0 && get_offset_chosen(offset_pt) == 1) {
+                for (int instance = 0; instance < get_num_instances(offset_pt); instance++) {
+                    for (int replica = 0; replica < get_num_replicas(offset_pt); replica++) {
+                        transmission[0] = frame_it;
+                        transmission[1] = get_offset_link(offset_pt);
+                        transmission[2] = instance;
+                        transmission[3] = replica;
+                        time = get_offset(offset_pt, instance, replica);
+                        if (write_pipe(pipe_fd, transmission, sizeof(int) * 4) < 0 ||
+                            write_pipe(pipe_fd, &time, sizeof(long long int)) < 0) {
+                            return SCHEDULE_PROCESS_FAILED;
+                        }
+                    }
+                }
+            }
+            offset_pt = get_next_offset(offset_pt);
+        }
+    }
+    return 0;
+}
+
+/**
+ Receive from the pipe the result of the schedule and, if it was found, the schedule of the network. The sizes sent are
+ checked before allocating the arrays, so a broken process cannot make the caller allocate an arbitrary amount
+
+ @param pipe_fd pipe to read the schedule
+ @param num_frames number of frames of the network given to the process
+ @param schedule pointer to save the schedule
+ @return 0 if the schedule was found, error code otherwise
+ */
+int receive_schedule_arrays(int pipe_fd, int num_frames, ScheduleArrays *schedule) {
+    
+    int result;
+    int transmission[4];
+    
+    if (read_pipe(pipe_fd, &result, sizeof(int)) < 0) {
+        printf("The process of the schedule finished without a result\n");
+        return SCHEDULE_PROCESS_FAILED;
+    }
+    if (result < 0) {
+        return result;
+    }
+    if (read_pipe(pipe_fd, &schedule->hyper_period, sizeof(long long int)) < 0 ||
+        read_pipe(pipe_fd, &schedule->num_frames, sizeof(int)) < 0) {
+        return SCHEDULE_PROCESS_FAILED;
+    }
+    if (schedule->num_frames != num_frames) {
+        printf("The process of the schedule sent %d frames instead of %d\n", schedule->num_frames, num_frames);
+        return SCHEDULE_PROCESS_FAILED;
+    }
+    schedule->rejected = malloc(sizeof(int) * num_frames);
+    if (num_frames > 0 && schedule->rejected == NULL) {
+        printf("Error allocating the schedule\n");
+        return SCHEDULE_PROCESS_FAILED;
+    }
+    if (read_pipe(pipe_fd, schedule->rejected, sizeof(int) * num_frames) < 0 ||
+        read_pipe(pipe_fd, &schedule->num_transmissions, sizeof(int)) < 0) {
+        return SCHEDULE_PROCESS_FAILED;
+    }
+    if (schedule->num_transmissions < 0) {
+        printf("The process of the schedule sent a negative number of transmissions\n");
+        return SCHEDULE_PROCESS_FAILED;
+    }
+    schedule->transmission_frames = malloc(sizeof(int) * schedule->num_transmissions);
+    schedule->transmission_links = malloc(sizeof(int) * schedule->num_transmissions);
+    schedule->transmission_instances = malloc(sizeof(int) * schedule->num_transmissions);
+    schedule->transmission_replicas = malloc(sizeof(int) * schedule->num_transmissions);
+    schedule->transmission_times = malloc(sizeof(long long int) * schedule->num_transmissions);
+    if (schedule->num_transmissions > 0 &&
+        (schedule->transmission_frames == NULL || schedule->transmission_links == NULL ||
+         schedule->transmission_instances == NULL || schedule->transmission_replicas == NULL ||
+         schedule->transmission_times == NULL)) {
+        printf("Error allocating the schedule\n");
+        return SCHEDULE_PROCESS_FAILED;
+    }
+    for (int transmission_it = 0; transmission_it < schedule->num_transmissions; transmission_it++) {
+        if (read_pipe(pipe_fd, transmission, sizeof(int) * 4) < 0 ||
+            read_pipe(pipe_fd, &schedule->transmission_times[transmission_it], sizeof(long long int)) < 0) {
+            return SCHEDULE_PROCESS_FAILED;
+        }
+        schedule->transmission_frames[transmission_it] = transmission[0];
+        schedule->transmission_links[transmission_it] = transmission[1];
+        schedule->transmission_instances[transmission_it] = transmission[2];
+        schedule->transmission_replicas[transmission_it] = transmission[3];
+    }
+    return 0;
+}
+
+/* PUBLIC FUNCTIONS */
+
+/**
+ Schedule the network given as arrays with the schedule configuration given as a xml in memory. The network is built,
+ prepared and solved in a child process, which sends the schedule back, so nothing is left in this process and no
+ file is read or written. The pareto mode is not supported, as it finds several schedules
+
+ @param network pointer to the network given as arrays
+ @param configuration xml of the schedule configuration
+ @param configuration_size number of bytes of the xml
+ @param mode scheduling mode, KEEP_CONFIGURATION_MODE to use the one of the configuration
+ @param quiet 1 to hide the output of the scheduler, 0 to print it
+ @param schedule pointer to save the schedule, its arrays have to be freed with free_schedule_arrays()
+ @return 0 if the schedule was found, error code of the scheduler or of the bindings otherwise
+ */
+int schedule_network_arrays(NetworkArrays *network, char *configuration, int configuration_size, int mode, int quiet,
+                            ScheduleArrays *schedule) {
+    
+    int pipe_fds[2];
+    int result, null_fd;
+    pid_t solver_pid;
+    
+    memset(schedule, 0, sizeof(ScheduleArrays));
+    if (pipe(pipe_fds) < 0) {
+        printf("Error creating the pipe of the schedule\n");
+        return ERROR_CREATING_PROCESS;
+    }
+    // Anything still in the buffer would be printed by both processes
+    fflush(stdout);
+    solver_pid = fork();
+    if (solver_pid < 0) {
+        printf("Error creating the process of the schedule\n");
+        close(pipe_fds[0]);
+        close(pipe_fds[1]);
+        return ERROR_CREATING_PROCESS;
+    }
+    
+    if (solver_pid == 0) {
+        close(pipe_fds[0]);
+        if (quiet == 1) {
+            null_fd = open("/dev/null", O_WRONLY);
+            if (null_fd >= 0) {
+                dup2(null_fd, STDOUT_FILENO);
+                dup2(null_fd, STDERR_FILENO);
+                close(null_fd);
+            }
+        }
+        result = build_network_arrays(network);
+        if (result == 0) {
+            result = prepare_network_from_memory(configuration, configuration_size);
+        }
+        if (result == 0 && mode != KEEP_CONFIGURATION_MODE) {
+            set_schedule_mode(mode);
+        }
+        if (result == 0 && get_schedule_mode() == pareto_mode) {
+            printf("The pareto mode cannot be scheduled without files\n");
+            result = PARETO_NOT_SUPPORTED;
+        }
+        // The schedule file is written nowhere, the schedule is sent through the pipe
+        if (result == 0) {
+            result = solve_network("/dev/null");
+        }
+        // If the schedule cannot be sent, the caller finds the pipe closed before the end
+        result = send_schedule_arrays(pipe_fds[1], result);
+        close(pipe_fds[1]);
+        fflush(stdout);
+        _exit(result < 0 ? 1 : 0);
+    }
+    
+    close(pipe_fds[1]);
+    result = receive_schedule_arrays(pipe_fds[0], network->num_frames, schedule);
+    close(pipe_fds[0]);
+    waitpid(solver_pid, NULL, 0);
+    if (result < 0) {
+        free_schedule_arrays(schedule);
+    }
+    return result;
+}
+
+/**
+ Free the arrays of a schedule given by schedule_network_arrays()
+
+ @param schedule pointer to the schedule
+ */
+void free_schedule_arrays(ScheduleArrays *schedule) {
+    
+    free(schedule->rejected);
+    free(schedule->transmission_frames);
+    free(schedule->transmission_links);
+    free(schedule->transmission_instances);
+    free(schedule->transmission_replicas);
+    free(schedule->transmission_times);
+    memset(schedule, 0, sizeof(ScheduleArrays));
+}
@@ -0,0 +1,112 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Bindings.h                                                                                                         *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 18/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Package that contains the bindings used by other languages, such as the Python Network Generator, to schedule a    *
+ *  network without files. The network is given as arrays and built in memory, the schedule configuration is given as  *
+ *  a xml in memory, and the schedule is returned as arrays. Every network is scheduled in its own process, as the     *
+ *  network and the scheduler are kept in global variables that are never freed, so the caller can schedule as many    *
+ *  networks as needed. That is also why only the whole schedule is exported: the functions that build the network     *
+ *  and the ones that schedule it accept a single network per process (NETWORK_ALREADY_LOADED), so a caller using them *
+ *  directly could never schedule a second network.                                                                    *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef Bindings_h
+#define Bindings_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#endif /* Bindings_h */
+
+/* ERROR CODE DEFINITIONS */
+
+#define ERROR_CREATING_PROCESS -1
+#define ERROR_BUILDING_NETWORK -2
+#define SCHEDULE_PROCESS_FAILED -3
+#define PARETO_NOT_SUPPORTED -4
+
+/* STRUCT DEFINITIONS */
+
+/**
+ Network given as arrays, with the nodes, links and frames identified by their index. The receivers of the frames and
+ the links of the paths are given one list after the other in a single array
+ */
+typedef struct NetworkArrays {
+    int num_nodes;                      // Number of nodes in the network
+    int *node_types;                    // Type of every node (NodeType)
+    long long int *node_precisions;     // Synchronization precision in ns of every node, NULL if all are synced
+    int num_links;                      // Number of links in the network
+    int *link_sources;                  // Node that transmits in every link
+    int *link_destinations;             // Node that receives from every link
+    int *link_speeds;                   // Speed of every link in MB/s
+    int *link_types;                    // Type of every link (LinkType)
+    int num_paths;                      // Number of paths given, if 0 they are computed from the links
+    int *path_senders;                  // Sender end system of every path
+    int *path_receivers;                // Receiver end system of every path
+    int *path_lengths;                  // Number of links of every path
+    int *path_links;                    // Links of all the paths
+    int shortest_path;                  // If the paths are computed, 1 for only the shortest one, 0 for all of them
+    int max_paths;                      // If all the paths are computed, maximum number of them, 0 if there is no limit
+    int num_frames;                     // Number of frames in the network
+    long long int *frame_periods;       // Period of every frame in ns
+    long long int *frame_deadlines;     // Deadline of every frame in ns
+    int *frame_sizes;                   // Size of every frame in bytes
+    long long int *frame_starting_times;    // Starting time of every frame in ns
+    long long int *frame_end_to_ends;   // End to end delay of every frame in ns
+    int *frame_senders;                 // Sender end system of every frame
+    int *frame_num_receivers;           // Number of receivers of every frame
+    int *frame_receivers;               // Receivers of all the frames
+    int *frame_priorities;              // Priority of every frame, NULL if all have the same priority
+    long long int switch_minimum_time;  // Minimum time in ns that a frame has to stay in a switch
+    long long int protocol_period;      // Self-Healing Protocol period in ns, 0 if there is no protocol
+    long long int protocol_time;        // Self-Healing Protocol time in ns
+}NetworkArrays;
+
+/**
+ Schedule of a network given as arrays, with one transmission for every replica of every instance of every frame in
+ the links of its chosen paths
+ */
+typedef struct ScheduleArrays {
+    long long int hyper_period;         // Hyper-period of the schedule in ns
+    int num_frames;                     // Number of frames in the network
+    int *rejected;                      // 1 if the frame could not be scheduled, 0 otherwise
+    int num_transmissions;              // Number of transmissions in the schedule
+    int *transmission_frames;           // Frame of every transmission
+    int *transmission_links;            // Link of every transmission
+    int *transmission_instances;        // Instance of the frame of every transmission
+    int *transmission_replicas;         // Replica of the instance of every transmission
+    long long int *transmission_times;  // Time in ns of every transmission
+}ScheduleArrays;
+
+/**
+ Schedule the network given as arrays with the schedule configuration given as a xml in memory. The network is built,
+ prepared and solved in a child process, which sends the schedule back, so nothing is left in this process and no
+ file is read or written. The pareto mode is not supported, as it finds several schedules
+
+ @param network pointer to the network given as arrays
+ @param configuration xml of the schedule configuration
+ @param configuration_size number of bytes of the xml
+ @param mode scheduling mode, KEEP_CONFIGURATION_MODE to use the one of the configuration
+ @param quiet 1 to hide the output of the scheduler, 0 to print it
+ @param schedule pointer to save the schedule, its arrays have to be freed with free_schedule_arrays()
+ @return 0 if the schedule was found, error code of the scheduler or of the bindings otherwise
+ */
+int schedule_network_arrays(NetworkArrays *network, char *configuration, int configuration_size, int mode, int quiet,
+                            ScheduleArrays *schedule);
+
+/**
+ Free the arrays of a schedule given by schedule_network_arrays()
+
+ @param schedule pointer to the schedule
+ */
+void free_schedule_arrays(ScheduleArrays *schedule);
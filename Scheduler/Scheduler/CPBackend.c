@@ -0,0 +1,2098 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  CPBackend.c                                                                                                        *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Description in CPBackend.h                                                                                         *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Backend.h"
+#include "CPBackend.h"
+
+/* VARIABLES */
+
+long long int *cp_lower = NULL;     // Current lower bound of every variable
+long long int *cp_upper = NULL;     // Current upper bound of every variable
+long long int *cp_root_lower = NULL;    // Lower bound of every variable when a search starts
+long long int *cp_root_upper = NULL;    // Upper bound of every variable when a search starts
+long long int *cp_created_lower = NULL; // Lower bound of every variable when it was created
+int *cp_lower_entry = NULL;         // Last entry of the trail that changed every lower bound, -1 if none
+int *cp_upper_entry = NULL;         // Last entry of the trail that changed every upper bound, -1 if none
+VariableDomain *cp_domains = NULL;  // Domain of every variable
+double *cp_variable_activity = NULL;    // Conflicts where every variable took part, decayed over time
+char *cp_ordered = NULL;            // 1 if the variable is ordered by a disjunction or a resource (an offset)
+int *cp_update_stamp = NULL;        // Propagation where the changes of every variable were counted
+int *cp_update_count = NULL;        // Changes of the bounds of every variable in the current propagation
+CPWatchList *cp_watches = NULL;     // Constraints woken up when the bounds of every variable change
+long long int *cp_solution = NULL;  // Value of every variable in the best solution found, NULL if there is none
+int cp_num_variables = 0;           // Number of variables, the handle of a variable is its index
+int cp_variables_capacity = 0;      // Number of variables allocated
+CPConstraint *cp_constraints = NULL;    // Constraints of the model
+int cp_num_constraints = 0;         // Number of constraints of the model
+int cp_constraints_capacity = 0;    // Number of constraints allocated
+int *cp_objectives = NULL;          // Constraint of every objective, from the most to the least important
+int cp_num_objectives = 0;          // Number of objectives
+int *cp_queue = NULL;               // Circular queue with the constraints to propagate
+char *cp_in_queue = NULL;           // 1 if the constraint is in the queue
+int cp_queue_head = 0;              // Position of the first constraint of the queue
+int cp_queue_size = 0;              // Number of constraints in the queue
+CPTrailEntry *cp_trail = NULL;      // Changes done since the search started, in the order they were done
+int *cp_entry_stamp = NULL;         // Analysis where every entry of the trail was visited
+int cp_trail_size = 0;              // Number of changes in the trail
+int cp_trail_capacity = 0;          // Number of changes allocated in the trail
+int *cp_level_start = NULL;         // Entry of the decision of every level
+CPDecision *cp_level_decision = NULL;   // Decision of every level
+char *cp_level_marks = NULL;        // Levels that caused the current conflict
+int cp_level = 0;                   // Current decision level, 0 is the root
+int cp_levels_capacity = 0;         // Number of levels allocated
+int cp_propagation_stamp = 0;       // Current propagation, to count the changes of every variable
+int cp_analysis_stamp = 0;          // Current analysis, to visit every entry of the trail once
+int cp_conflict_constraint = -1;    // Constraint that failed in the last conflict, -1 if it was not a constraint
+int *cp_conflict_entries = NULL;    // Entries of the trail that explain the last conflict without a constraint
+int cp_num_conflict_entries = 0;    // Number of entries that explain the last conflict
+int cp_conflict_capacity = 0;       // Number of entries allocated to explain a conflict
+int *cp_lower_head = NULL;          // Last entry of every lower bound before the entry analyzed in a conflict
+int *cp_upper_head = NULL;          // Last entry of every upper bound before the entry analyzed in a conflict
+int *cp_excluded_head = NULL;       // Last entry of the rows excluded of every constraint before the entry analyzed
+long long int *cp_scratch = NULL;   // Scratch memory of the resource propagation
+int *cp_scratch_index = NULL;       // Scratch memory of the resource propagation to sort the tasks
+int cp_scratch_capacity = 0;        // Number of tasks of the largest resource
+long long int *cp_sort_keys = NULL; // Keys used to sort the tasks of a resource
+double cp_activity_increment = 1.0; // Activity added in every conflict, increased to decay the older ones
+long long int cp_num_failures = 0;  // Number of failures of the current solve
+int cp_num_restarts = 0;            // Number of restarts of the current solve
+clock_t cp_deadline;                // Clock when the current solve has to stop
+
+/* PRIVATE FUNCTIONS */
+
+/**
+ Integer division rounded towards minus infinity
+
+ @param a dividend
+ @param b divisor, not 0
+ @return floor of a / b
+ */
+long long int cp_floor_division(long long int a, long long int b) {
+    
+    long long int quotient = a / b;
+    
+    if (a % b != 0 && ((a < 0) != (b < 0))) {
+        quotient--;
+    }
+    return quotient;
+}
+
+/**
+ Integer division rounded towards plus infinity
+
+ @param a dividend
+ @param b divisor, not 0
+ @return ceiling of a / b
+ */
+long long int cp_ceil_division(long long int a, long long int b) {
+    
+    return -cp_floor_division(-a, b);
+}
+
+/**
+ Get the luby sequence (1, 1, 2, 1, 1, 2, 4, ...) that scales the failures between restarts
+
+ @param index position in the sequence, starting at 0
+ @return value of the sequence
+ */
+long long int cp_luby(long long int index) {
+    
+    long long int size = 1;
+    int sequence = 0;
+    
+    while (size < index + 1) {
+        sequence++;
+        size = 2 * size + 1;
+    }
+    while (size - 1 != index) {
+        size = (size - 1) >> 1;
+        sequence--;
+        index = index % size;
+    }
+    return 1LL << sequence;
+}
+
+/**
+ Compare two tasks by their key, to sort the tasks of a resource
+
+ @param first pointer to the index of the first task
+ @param second pointer to the index of the second task
+ @return negative if the first goes before, positive if after, 0 if they have the same key
+ */
+int cp_compare_keys(const void *first, const void *second) {
+    
+    long long int key1 = cp_sort_keys[*(const int *) first];
+    long long int key2 = cp_sort_keys[*(const int *) second];
+    
+    return (key1 > key2) - (key1 < key2);
+}
+
+/**
+ Sort the indexes of the tasks by the given keys
+
+ @param num_tasks number of tasks
+ @param keys key of every task
+ @param order array to save the indexes of the tasks sorted
+ */
+void cp_sort_tasks(int num_tasks, long long int *keys, int *order) {
+    
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        order[task_it] = task_it;
+    }
+    cp_sort_keys = keys;
+    qsort(order, num_tasks, sizeof(int), cp_compare_keys);
+}
+
+/**
+ Append a value into a dynamic array of integers, growing it if it is full
+
+ @param array pointer to the array
+ @param size pointer to the number of values of the array
+ @param capacity pointer to the number of values allocated
+ @param value value to append
+ */
+void cp_append(int **array, int *size, int *capacity, int value) {
+    
+    if (*size == *capacity) {
+        *capacity = *capacity == 0 ? 64 : *capacity * 2;
+        *array = realloc(*array, sizeof(int) * *capacity);
+    }
+    (*array)[*size] = value;
+    (*size)++;
+}
+
+/**
+ Create a new constraint of the given type with all its fields empty
+
+ @param type type of the constraint
+ @return index of the constraint
+ */
+int cp_new_constraint(CPConstraintType type) {
+    
+    CPConstraint *constraint_pt;
+    
+    if (cp_num_constraints == cp_constraints_capacity) {
+        cp_constraints_capacity = cp_constraints_capacity == 0 ? 1024 : cp_constraints_capacity * 2;
+        cp_constraints = realloc(cp_constraints, sizeof(CPConstraint) * cp_constraints_capacity);
+    }
+    constraint_pt = &cp_constraints[cp_num_constraints];
+    memset(constraint_pt, 0, sizeof(CPConstraint));
+    constraint_pt->type = type;
+    constraint_pt->result = NO_VARIABLE;
+    constraint_pt->excluded_entry = -1;
+    cp_num_constraints++;
+    return cp_num_constraints - 1;
+}
+
+/**
+ Watch a variable from a constraint, so the constraint is woken up when the bounds of the variable change
+
+ @param constraint index of the constraint
+ @param variable handle of the variable
+ */
+void cp_watch(int constraint, int variable) {
+    
+    CPConstraint *constraint_pt = &cp_constraints[constraint];
+    CPWatchList *watch_pt = &cp_watches[variable];
+    
+    // Most constraints only watch a few variables, so the array starts small and doubles when it is full
+    if (constraint_pt->num_variables == constraint_pt->variables_capacity) {
+        constraint_pt->variables_capacity = constraint_pt->variables_capacity == 0 ? 4 :
+                                            constraint_pt->variables_capacity * 2;
+        constraint_pt->variables = realloc(constraint_pt->variables, sizeof(int) * constraint_pt->variables_capacity);
+    }
+    constraint_pt->variables[constraint_pt->num_variables] = variable;
+    constraint_pt->num_variables++;
+    cp_append(&watch_pt->constraints, &watch_pt->num_constraints, &watch_pt->capacity, constraint);
+    if (constraint_pt->type == cp_disjunction_constraint || constraint_pt->type == cp_resource_constraint) {
+        cp_ordered[variable] = 1;
+    }
+}
+
+/**
+ Check that the variables and coefficients of a linear row can be propagated without overflows
+
+ @param row pointer to the linear row
+ @return 0 if it is valid, error code otherwise
+ */
+int cp_check_row(LinearConstraint *row) {
+    
+    for (int term_it = 0; term_it < row->num_variables; term_it++) {
+        if (row->variables[term_it] < 0 || row->variables[term_it] >= cp_num_variables) {
+            return CP_VARIABLE_OUT_OF_RANGE;
+        }
+        if (llabs(row->values[term_it]) > CP_MAX_COEFFICIENT) {
+            printf("The CP engine only has coefficients up to %d\n", CP_MAX_COEFFICIENT);
+            return CP_COEFFICIENT_TOO_LARGE;
+        }
+    }
+    if (llabs(row->rhs) > CP_INFINITY) {
+        return CP_COEFFICIENT_TOO_LARGE;
+    }
+    return 0;
+}
+
+/**
+ Add the given linear rows and guards into a constraint, watching all their variables
+
+ @param constraint index of the constraint
+ @param num_rows number of rows
+ @param rows array with the rows
+ @param num_guards number of guards
+ @param guards array with the guard literals
+ @param guard_values array with the value of every guard that activates the rows
+ */
+void cp_set_rows(int constraint, int num_rows, LinearConstraint *rows, int num_guards, int *guards,
+                 int *guard_values) {
+    
+    CPConstraint *constraint_pt = &cp_constraints[constraint];
+    
+    constraint_pt->num_rows = num_rows;
+    constraint_pt->rows = malloc(sizeof(LinearConstraint) * num_rows);
+    memcpy(constraint_pt->rows, rows, sizeof(LinearConstraint) * num_rows);
+    constraint_pt->num_guards = num_guards;
+    constraint_pt->guards = malloc(sizeof(int) * (num_guards + 1));
+    constraint_pt->guard_values = malloc(sizeof(int) * (num_guards + 1));
+    for (int guard_it = 0; guard_it < num_guards; guard_it++) {
+        constraint_pt->guards[guard_it] = guards[guard_it];
+        constraint_pt->guard_values[guard_it] = guard_values[guard_it];
+        cp_watch(constraint, guards[guard_it]);
+    }
+    for (int row_it = 0; row_it < num_rows; row_it++) {
+        for (int term_it = 0; term_it < rows[row_it].num_variables; term_it++) {
+            cp_watch(constraint, rows[row_it].variables[term_it]);
+        }
+    }
+}
+
+/**
+ Add a constraint into the queue of constraints to propagate, unless it is already there
+
+ @param constraint index of the constraint
+ */
+void cp_enqueue(int constraint) {
+    
+    if (cp_in_queue[constraint] == 1) {
+        return;
+    }
+    cp_in_queue[constraint] = 1;
+    cp_queue[(cp_queue_head + cp_queue_size) % cp_num_constraints] = constraint;
+    cp_queue_size++;
+}
+
+/**
+ Empty the queue of constraints to propagate, after a conflict
+ */
+void cp_clear_queue(void) {
+    
+    while (cp_queue_size > 0) {
+        cp_in_queue[cp_queue[cp_queue_head]] = 0;
+        cp_queue_head = (cp_queue_head + 1) % cp_num_constraints;
+        cp_queue_size--;
+    }
+    cp_queue_head = 0;
+}
+
+/**
+ Save a change into the trail
+
+ @param type what was changed
+ @param index variable or constraint changed
+ @param old_value value before the change
+ @param previous previous entry of the same bound or constraint
+ @param reason constraint that propagated the change, CP_DECISION or CP_REFUTATION
+ @return index of the entry
+ */
+int cp_push_entry(CPTrailType type, int index, long long int old_value, int previous, int reason) {
+    
+    CPTrailEntry *entry_pt;
+    
+    if (cp_trail_size == cp_trail_capacity) {
+        cp_trail_capacity = cp_trail_capacity == 0 ? 4096 : cp_trail_capacity * 2;
+        cp_trail = realloc(cp_trail, sizeof(CPTrailEntry) * cp_trail_capacity);
+        cp_entry_stamp = realloc(cp_entry_stamp, sizeof(int) * cp_trail_capacity);
+    }
+    entry_pt = &cp_trail[cp_trail_size];
+    entry_pt->type = type;
+    entry_pt->index = index;
+    entry_pt->old_value = old_value;
+    entry_pt->previous = previous;
+    entry_pt->level = cp_level;
+    entry_pt->reason = reason;
+    entry_pt->antecedent = -1;
+    entry_pt->num_antecedents = 0;
+    entry_pt->antecedents = NULL;
+    cp_entry_stamp[cp_trail_size] = 0;
+    cp_trail_size++;
+    return cp_trail_size - 1;
+}
+
+/**
+ Look for a positive cycle of difference rows that keeps moving the bound of the given entry. Following the entries
+ that fixed every bound, if we arrive to an older entry of the same bound, the rows of the cycle imply that the
+ variable is larger than itself, so the cycle would move the bound forever. The entries of the cycle explain the
+ conflict
+
+ @param entry entry of the trail that changed the bound
+ @return 1 if there is a cycle, 0 otherwise
+ */
+int cp_find_cycle(int entry) {
+    
+    int current = cp_trail[entry].antecedent;
+    int steps = 0;
+    
+    while (current >= 0 && steps <= 2 * cp_num_variables) {
+        if (cp_trail[current].index == cp_trail[entry].index && cp_trail[current].type == cp_trail[entry].type) {
+            // Save the entries of the cycle to explain the conflict
+            for (int cycle_it = entry; cycle_it != current; cycle_it = cp_trail[cycle_it].antecedent) {
+                cp_append(&cp_conflict_entries, &cp_num_conflict_entries, &cp_conflict_capacity, cycle_it);
+            }
+            return 1;
+        }
+        current = cp_trail[current].antecedent;
+        steps++;
+    }
+    return 0;
+}
+
+/**
+ Wake up the constraints of a variable that changed, and look for a positive cycle if it changed too many times
+
+ @param variable handle of the variable
+ @param entry entry of the trail of the change
+ @return 0 if done correctly, CP_CONFLICT if a positive cycle was found
+ */
+int cp_notify_change(int variable, int entry) {
+    
+    CPWatchList *watch_pt = &cp_watches[variable];
+    
+    for (int watch_it = 0; watch_it < watch_pt->num_constraints; watch_it++) {
+        cp_enqueue(watch_pt->constraints[watch_it]);
+    }
+    if (cp_update_stamp[variable] != cp_propagation_stamp) {
+        cp_update_stamp[variable] = cp_propagation_stamp;
+        cp_update_count[variable] = 0;
+    }
+    cp_update_count[variable]++;
+    if (cp_update_count[variable] > CP_CYCLE_UPDATES && cp_trail[entry].antecedent >= 0 && cp_find_cycle(entry)) {
+        return CP_CONFLICT;
+    }
+    return 0;
+}
+
+/**
+ Increase the lower bound of a variable
+
+ @param variable handle of the variable
+ @param value new lower bound
+ @param reason constraint that propagated it, CP_DECISION or CP_REFUTATION
+ @param antecedent entry that fixed the bound through a difference row, -1 if none
+ @return 0 if done correctly, CP_CONFLICT if the domain is empty
+ */
+int cp_set_lower(int variable, long long int value, int reason, int antecedent) {
+    
+    int entry;
+    
+    if (value <= cp_lower[variable]) {
+        return 0;
+    }
+    if (value > cp_upper[variable]) {
+        return CP_CONFLICT;
+    }
+    entry = cp_push_entry(cp_lower_change, variable, cp_lower[variable], cp_lower_entry[variable], reason);
+    cp_trail[entry].antecedent = antecedent;
+    cp_lower_entry[variable] = entry;
+    cp_lower[variable] = value;
+    return cp_notify_change(variable, entry);
+}
+
+/**
+ Decrease the upper bound of a variable
+
+ @param variable handle of the variable
+ @param value new upper bound
+ @param reason constraint that propagated it, CP_DECISION or CP_REFUTATION
+ @param antecedent entry that fixed the bound through a difference row, -1 if none
+ @return 0 if done correctly, CP_CONFLICT if the domain is empty
+ */
+int cp_set_upper(int variable, long long int value, int reason, int antecedent) {
+    
+    int entry;
+    
+    if (value >= cp_upper[variable]) {
+        return 0;
+    }
+    if (value < cp_lower[variable]) {
+        return CP_CONFLICT;
+    }
+    entry = cp_push_entry(cp_upper_change, variable, cp_upper[variable], cp_upper_entry[variable], reason);
+    cp_trail[entry].antecedent = antecedent;
+    cp_upper_entry[variable] = entry;
+    cp_upper[variable] = value;
+    return cp_notify_change(variable, entry);
+}
+
+/**
+ Exclude rows of a disjunction
+
+ @param constraint index of the disjunction
+ @param excluded mask with the rows to exclude
+ @param reason CP_DECISION or CP_REFUTATION
+ */
+void cp_exclude_rows(int constraint, unsigned int excluded, int reason) {
+    
+    CPConstraint *constraint_pt = &cp_constraints[constraint];
+    int entry;
+    
+    if ((constraint_pt->excluded | excluded) == constraint_pt->excluded) {
+        return;
+    }
+    entry = cp_push_entry(cp_excluded_change, constraint, constraint_pt->excluded, constraint_pt->excluded_entry,
+                          reason);
+    constraint_pt->excluded_entry = entry;
+    constraint_pt->excluded |= excluded;
+    cp_enqueue(constraint);
+}
+
+/**
+ Undo all the changes of the levels above the given one
+
+ @param level level to go back to
+ */
+void cp_backjump(int level) {
+    
+    CPTrailEntry *entry_pt;
+    
+    while (cp_trail_size > 0 && cp_trail[cp_trail_size - 1].level > level) {
+        cp_trail_size--;
+        entry_pt = &cp_trail[cp_trail_size];
+        switch (entry_pt->type) {
+            case cp_lower_change:
+                cp_lower[entry_pt->index] = entry_pt->old_value;
+                cp_lower_entry[entry_pt->index] = entry_pt->previous;
+                break;
+            case cp_upper_change:
+                cp_upper[entry_pt->index] = entry_pt->old_value;
+                cp_upper_entry[entry_pt->index] = entry_pt->previous;
+                break;
+            case cp_excluded_change:
+                cp_constraints[entry_pt->index].excluded = (unsigned int) entry_pt->old_value;
+                cp_constraints[entry_pt->index].excluded_entry = entry_pt->previous;
+                break;
+            default:
+                break;
+        }
+        free(entry_pt->antecedents);
+    }
+    cp_level = level;
+}
+
+/**
+ Mark an entry of the trail as a cause of the current conflict, unless it was done at the root
+
+ @param entry entry of the trail, -1 if none
+ @param pending pointer to the number of marked entries that were not analyzed yet
+ */
+void cp_mark_entry(int entry, int *pending) {
+    
+    if (entry >= 0 && cp_trail[entry].level > 0 && cp_entry_stamp[entry] != cp_analysis_stamp) {
+        cp_entry_stamp[entry] = cp_analysis_stamp;
+        (*pending)++;
+    }
+}
+
+/**
+ Mark the entries that a constraint used, which are the bounds of all its variables and the rows excluded if it is a
+ disjunction. The heads are the last entries of every bound before the entry being analyzed
+
+ @param constraint index of the constraint
+ @param pending pointer to the number of marked entries that were not analyzed yet
+ */
+void cp_mark_antecedents(int constraint, int *pending) {
+    
+    CPConstraint *constraint_pt = &cp_constraints[constraint];
+    int variable;
+    
+    for (int variable_it = 0; variable_it < constraint_pt->num_variables; variable_it++) {
+        variable = constraint_pt->variables[variable_it];
+        cp_variable_activity[variable] += cp_activity_increment;
+        cp_mark_entry(cp_lower_head[variable], pending);
+        cp_mark_entry(cp_upper_head[variable], pending);
+    }
+    if (constraint_pt->type == cp_disjunction_constraint) {
+        cp_mark_entry(cp_excluded_head[constraint], pending);
+    }
+    constraint_pt->activity += cp_activity_increment;
+}
+
+/**
+ Find the decision levels that caused the last conflict, following the reasons of all the entries that explain it
+ until the decisions. Every level that caused it is marked in the level marks.
+ The reasons only use older entries, so the trail is analyzed once from the newest entry, and the heads of every bound
+ go back while the entries are passed
+
+ @return highest level that caused the conflict, 0 if it does not depend on any decision
+ */
+int cp_analyze_conflict(void) {
+    
+    CPTrailEntry *entry_pt;
+    int pending = 0;
+    int highest = 0;
+    
+    cp_analysis_stamp++;
+    memset(cp_level_marks, 0, sizeof(char) * (cp_level + 1));
+    memcpy(cp_lower_head, cp_lower_entry, sizeof(int) * cp_num_variables);
+    memcpy(cp_upper_head, cp_upper_entry, sizeof(int) * cp_num_variables);
+    for (int constraint_it = 0; constraint_it < cp_num_constraints; constraint_it++) {
+        cp_excluded_head[constraint_it] = cp_constraints[constraint_it].excluded_entry;
+    }
+    for (int entry_it = 0; entry_it < cp_num_conflict_entries; entry_it++) {
+        cp_mark_entry(cp_conflict_entries[entry_it], &pending);
+    }
+    cp_num_conflict_entries = 0;
+    if (cp_conflict_constraint >= 0) {
+        cp_mark_antecedents(cp_conflict_constraint, &pending);
+    }
+    
+    for (int entry = cp_trail_size - 1; entry >= 0 && pending > 0; entry--) {
+        entry_pt = &cp_trail[entry];
+        switch (entry_pt->type) {
+            case cp_lower_change:
+                cp_lower_head[entry_pt->index] = entry_pt->previous;
+                break;
+            case cp_upper_change:
+                cp_upper_head[entry_pt->index] = entry_pt->previous;
+                break;
+            default:
+                cp_excluded_head[entry_pt->index] = entry_pt->previous;
+                break;
+        }
+        if (cp_entry_stamp[entry] != cp_analysis_stamp) {
+            continue;
+        }
+        pending--;
+        if (entry_pt->reason == CP_DECISION) {
+            cp_level_marks[entry_pt->level] = 1;
+            if (entry_pt->level > highest) {
+                highest = entry_pt->level;
+            }
+        } else if (entry_pt->reason == CP_REFUTATION) {
+            for (int antecedent_it = 0; antecedent_it < entry_pt->num_antecedents; antecedent_it++) {
+                cp_mark_entry(entry_pt->antecedents[antecedent_it], &pending);
+            }
+        } else {
+            cp_mark_antecedents(entry_pt->reason, &pending);
+        }
+    }
+    
+    // Newer conflicts are more important, so the activity added grows instead of decaying all the old ones
+    cp_activity_increment *= 1.05;
+    if (cp_activity_increment > 1e100) {
+        for (int variable_it = 0; variable_it < cp_num_variables; variable_it++) {
+            cp_variable_activity[variable_it] *= 1e-100;
+        }
+        for (int constraint_it = 0; constraint_it < cp_num_constraints; constraint_it++) {
+            cp_constraints[constraint_it].activity *= 1e-100;
+        }
+        cp_activity_increment *= 1e-100;
+    }
+    return highest;
+}
+
+/**
+ Get the minimum value of a term of a linear row
+
+ @param value coefficient of the term
+ @param variable handle of the variable of the term
+ @return minimum value of the term
+ */
+long long int cp_term_min(long long int value, int variable) {
+    
+    return value > 0 ? value * cp_lower[variable] : value * cp_upper[variable];
+}
+
+/**
+ Get the maximum value of a term of a linear row
+
+ @param value coefficient of the term
+ @param variable handle of the variable of the term
+ @return maximum value of the term
+ */
+long long int cp_term_max(long long int value, int variable) {
+    
+    return value > 0 ? value * cp_upper[variable] : value * cp_lower[variable];
+}
+
+/**
+ Check if a linear row can still hold with the current bounds
+
+ @param row pointer to the row
+ @return 1 if it can hold, 0 otherwise
+ */
+int cp_row_possible(LinearConstraint *row) {
+    
+    long long int min = 0, max = 0;
+    
+    for (int term_it = 0; term_it < row->num_variables; term_it++) {
+        min += cp_term_min(row->values[term_it], row->variables[term_it]);
+        max += cp_term_max(row->values[term_it], row->variables[term_it]);
+    }
+    switch (row->sense) {
+        case sense_greater_equal:
+            return max >= row->rhs;
+        case sense_less_equal:
+            return min <= row->rhs;
+        default:
+            return min <= row->rhs && max >= row->rhs;
+    }
+}
+
+/**
+ Check if a linear row holds with any value of the current bounds
+
+ @param row pointer to the row
+ @return 1 if it always holds, 0 otherwise
+ */
+int cp_row_entailed(LinearConstraint *row) {
+    
+    long long int min = 0, max = 0;
+    
+    for (int term_it = 0; term_it < row->num_variables; term_it++) {
+        min += cp_term_min(row->values[term_it], row->variables[term_it]);
+        max += cp_term_max(row->values[term_it], row->variables[term_it]);
+    }
+    switch (row->sense) {
+        case sense_greater_equal:
+            return min >= row->rhs;
+        case sense_less_equal:
+            return max <= row->rhs;
+        default:
+            return min == row->rhs && max == row->rhs;
+    }
+}
+
+/**
+ Get how far a linear row is from failing with the current bounds, to choose the row of a disjunction
+
+ @param row pointer to the row
+ @return slack of the row, larger if it is easier to hold
+ */
+long long int cp_row_slack(LinearConstraint *row) {
+    
+    long long int min = 0, max = 0;
+    
+    for (int term_it = 0; term_it < row->num_variables; term_it++) {
+        min += cp_term_min(row->values[term_it], row->variables[term_it]);
+        max += cp_term_max(row->values[term_it], row->variables[term_it]);
+    }
+    switch (row->sense) {
+        case sense_greater_equal:
+            return max - row->rhs;
+        case sense_less_equal:
+            return row->rhs - min;
+        default:
+            return 0;
+    }
+}
+
+/**
+ Propagate the bounds of the variables of a linear row sign * (sum) >= sign * rhs.
+ Every new bound of a variable with coefficient 1 or -1 saves as antecedent the most recent bound of another of them
+ that fixed it. The bound grows at least as fast as its antecedent, so if the antecedents lead back to an older bound
+ of the same variable, there is a positive cycle of precedences
+
+ @param row pointer to the row
+ @param sign 1 to propagate the row as it is, -1 to propagate it multiplied by -1
+ @param reason constraint of the row
+ @return 0 if done correctly, CP_CONFLICT if the row cannot hold
+ */
+int cp_propagate_greater(LinearConstraint *row, int sign, int reason) {
+    
+    long long int max = 0, rest, need, value, other_value;
+    int variable, other, antecedent, entry;
+    int result;
+    
+    for (int term_it = 0; term_it < row->num_variables; term_it++) {
+        max += cp_term_max(sign * row->values[term_it], row->variables[term_it]);
+    }
+    if (max < sign * row->rhs) {
+        return CP_CONFLICT;
+    }
+    for (int term_it = 0; term_it < row->num_variables; term_it++) {
+        variable = row->variables[term_it];
+        value = sign * row->values[term_it];
+        rest = max - cp_term_max(value, variable);
+        need = sign * row->rhs - rest;
+        antecedent = -1;
+        for (int other_it = 0; other_it < row->num_variables && llabs(value) == 1; other_it++) {
+            other = row->variables[other_it];
+            other_value = sign * row->values[other_it];
+            if (other_it == term_it || other == variable || llabs(other_value) != 1) {
+                continue;
+            }
+            // The other variable fixed the bound with its upper bound if its coefficient is positive
+            entry = other_value > 0 ? cp_upper_entry[other] : cp_lower_entry[other];
+            if (entry > antecedent) {
+                antecedent = entry;
+            }
+        }
+        if (value > 0) {
+            result = cp_set_lower(variable, cp_ceil_division(need, value), reason, antecedent);
+        } else {
+            result = cp_set_upper(variable, cp_floor_division(need, value), reason, antecedent);
+        }
+        if (result < 0) {
+            return result;
+        }
+    }
+    return 0;
+}
+
+/**
+ Propagate the bounds of the variables of a linear row
+
+ @param row pointer to the row
+ @param reason constraint of the row
+ @return 0 if done correctly, CP_CONFLICT if the row cannot hold
+ */
+int cp_propagate_row(LinearConstraint *row, int reason) {
+    
+    if (row->sense != sense_less_equal && cp_propagate_greater(row, 1, reason) < 0) {
+        return CP_CONFLICT;
+    }
+    if (row->sense != sense_greater_equal && cp_propagate_greater(row, -1, reason) < 0) {
+        return CP_CONFLICT;
+    }
+    return 0;
+}
+
+/**
+ Propagate a disjunction. If a guard does not have its value, nothing has to hold. If no row can hold, the last guard
+ without value gets the opposite one, and if only one row can hold and all guards have their value, it is propagated
+
+ @param constraint index of the disjunction
+ @return 0 if done correctly, CP_CONFLICT if it cannot hold
+ */
+int cp_propagate_disjunction(int constraint) {
+    
+    CPConstraint *constraint_pt = &cp_constraints[constraint];
+    int guard, value;
+    int free_guard = -1, num_free_guards = 0;
+    int possible = -1, num_possible = 0;
+    
+    for (int guard_it = 0; guard_it < constraint_pt->num_guards; guard_it++) {
+        guard = constraint_pt->guards[guard_it];
+        value = constraint_pt->guard_values[guard_it];
+        if (cp_lower[guard] != cp_upper[guard]) {
+            free_guard = guard_it;
+            num_free_guards++;
+        } else if (cp_lower[guard] != value) {
+            return 0;                   // The rows do not have to hold
+        }
+    }
+    for (int row_it = 0; row_it < constraint_pt->num_rows; row_it++) {
+        if ((constraint_pt->excluded >> row_it) & 1) {
+            continue;
+        }
+        if (num_free_guards == 0 && cp_row_entailed(&constraint_pt->rows[row_it])) {
+            return 0;                   // It already holds
+        }
+        if (cp_row_possible(&constraint_pt->rows[row_it])) {
+            possible = row_it;
+            num_possible++;
+        }
+    }
+    
+    if (num_possible == 0) {
+        if (num_free_guards == 0) {
+            return CP_CONFLICT;
+        }
+        if (num_free_guards == 1) {     // The guard has to deactivate the rows
+            guard = constraint_pt->guards[free_guard];
+            value = 1 - constraint_pt->guard_values[free_guard];
+            return value == 1 ? cp_set_lower(guard, 1, constraint, -1) : cp_set_upper(guard, 0, constraint, -1);
+        }
+        return 0;
+    }
+    if (num_possible == 1 && num_free_guards == 0) {
+        return cp_propagate_row(&constraint_pt->rows[possible], constraint);
+    }
+    return 0;
+}
+
+/**
+ Propagate that the result literal is the disjunction of the literals
+
+ @param constraint index of the constraint
+ @return 0 if done correctly, CP_CONFLICT if it cannot hold
+ */
+int cp_propagate_or(int constraint) {
+    
+    CPConstraint *constraint_pt = &cp_constraints[constraint];
+    int literal, free_literal = -1;
+    int num_free = 0, num_true = 0;
+    
+    for (int literal_it = 0; literal_it < constraint_pt->num_literals; literal_it++) {
+        literal = constraint_pt->literals[literal_it];
+        if (cp_lower[literal] == 1) {
+            num_true++;
+        } else if (cp_upper[literal] == 1) {
+            free_literal = literal;
+            num_free++;
+        }
+    }
+    if (num_true > 0) {
+        return cp_set_lower(constraint_pt->result, 1, constraint, -1);
+    }
+    if (num_free == 0) {
+        return cp_set_upper(constraint_pt->result, 0, constraint, -1);
+    }
+    if (cp_upper[constraint_pt->result] == 0) {
+        for (int literal_it = 0; literal_it < constraint_pt->num_literals; literal_it++) {
+            if (cp_set_upper(constraint_pt->literals[literal_it], 0, constraint, -1) < 0) {
+                return CP_CONFLICT;
+            }
+        }
+        return 0;
+    }
+    if (cp_lower[constraint_pt->result] == 1 && num_free == 1) {
+        return cp_set_lower(free_literal, 1, constraint, -1);
+    }
+    return 0;
+}
+
+/**
+ Propagate that exactly one of the literals is true
+
+ @param constraint index of the constraint
+ @return 0 if done correctly, CP_CONFLICT if it cannot hold
+ */
+int cp_propagate_exactly_one(int constraint) {
+    
+    CPConstraint *constraint_pt = &cp_constraints[constraint];
+    int literal, true_literal = -1, free_literal = -1;
+    int num_free = 0, num_true = 0;
+    
+    for (int literal_it = 0; literal_it < constraint_pt->num_literals; literal_it++) {
+        literal = constraint_pt->literals[literal_it];
+        if (cp_lower[literal] == 1) {
+            true_literal = literal;
+            num_true++;
+        } else if (cp_upper[literal] == 1) {
+            free_literal = literal;
+            num_free++;
+        }
+    }
+    if (num_true > 1 || (num_true == 0 && num_free == 0)) {
+        return CP_CONFLICT;
+    }
+    if (num_true == 1) {
+        for (int literal_it = 0; literal_it < constraint_pt->num_literals; literal_it++) {
+            literal = constraint_pt->literals[literal_it];
+            if (literal != true_literal && cp_set_upper(literal, 0, constraint, -1) < 0) {
+                return CP_CONFLICT;
+            }
+        }
+        return 0;
+    }
+    if (num_free == 1) {
+        return cp_set_lower(free_literal, 1, constraint, -1);
+    }
+    return 0;
+}
+
+/**
+ Timetabling of a disjunctive resource. The compulsory part of a task is the time it is transmitted whatever its start
+ is, from its latest start to its earliest end. No other task can overlap it, so tasks are pushed after the compulsory
+ parts they would overlap
+
+ @param num_tasks number of tasks
+ @param est earliest start of every task
+ @param lct latest completion of every task
+ @param duration duration of every task
+ @param new_est array where the new earliest starts are saved
+ @param source array where the task whose earliest end gave every new earliest start is saved
+ @param order array to sort the tasks
+ @return 0 if done correctly, CP_CONFLICT if two compulsory parts overlap
+ */
+int cp_timetable(int num_tasks, long long int *est, long long int *lct, long long int *duration,
+                 long long int *new_est, int *source, int *order) {
+    
+    long long int *lst = &cp_scratch[8 * cp_scratch_capacity];
+    long long int last_end = -CP_INFINITY, start;
+    int task, part, start_part;
+    
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        lst[task_it] = lct[task_it] - duration[task_it];
+    }
+    cp_sort_tasks(num_tasks, lst, order);
+    
+    // Compulsory parts sorted by their start never overlap, or the resource is overloaded
+    for (int order_it = 0; order_it < num_tasks; order_it++) {
+        task = order[order_it];
+        if (lst[task] < est[task] + duration[task]) {
+            if (lst[task] < last_end) {
+                return CP_CONFLICT;
+            }
+            last_end = est[task] + duration[task];
+        }
+    }
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        start = est[task_it];
+        start_part = -1;
+        for (int order_it = 0; order_it < num_tasks; order_it++) {
+            part = order[order_it];
+            if (part == task_it || lst[part] >= est[part] + duration[part]) {
+                continue;
+            }
+            if (start < est[part] + duration[part] && start + duration[task_it] > lst[part]) {
+                start = est[part] + duration[part];
+                start_part = part;
+            }
+        }
+        if (start > new_est[task_it]) {
+            new_est[task_it] = start;
+            source[task_it] = start_part;
+        }
+    }
+    return 0;
+}
+
+/**
+ Edge finding of a disjunctive resource. For every set of tasks that have to end before the latest completion of one
+ of them, if a task out of the set cannot end before such completion, it has to go after all of them, so it starts
+ after the earliest end of the set. The earliest end of a set is the largest earliest start of a subset plus the
+ durations of the tasks that start later. The same sets detect when the resource is overloaded
+
+ @param num_tasks number of tasks
+ @param est earliest start of every task
+ @param lct latest completion of every task
+ @param duration duration of every task
+ @param new_est array where the new earliest starts are saved
+ @param source array where the task whose earliest start gave every new earliest start is saved
+ @param order array to sort the tasks
+ @return 0 if done correctly, CP_CONFLICT if the resource is overloaded
+ */
+int cp_edge_finding(int num_tasks, long long int *est, long long int *lct, long long int *duration,
+                    long long int *new_est, int *source, int *order) {
+    
+    int *by_lct = &order[num_tasks];
+    long long int *suffix = &cp_scratch[8 * cp_scratch_capacity];
+    long long int *prefix = &cp_scratch[9 * cp_scratch_capacity];
+    long long int sum, best, ect, end;
+    int last, task, best_task;
+    
+    cp_sort_tasks(num_tasks, lct, by_lct);
+    cp_sort_tasks(num_tasks, est, order);
+    for (int set_it = 0; set_it < num_tasks; set_it++) {
+        // The tasks with the same latest completion are in the same set
+        last = by_lct[set_it];
+        if (set_it + 1 < num_tasks && lct[by_lct[set_it + 1]] == lct[last]) {
+            continue;
+        }
+    
+        // Durations of the tasks of the set that start at the same time or later than every position
+        sum = 0;
+        for (int order_it = num_tasks - 1; order_it >= 0; order_it--) {
+            task = order[order_it];
+            if (lct[task] <= lct[last]) {
+                sum += duration[task];
+            }
+            suffix[order_it] = sum;
+        }
+        best = -CP_INFINITY;
+        best_task = -1;
+        for (int order_it = 0; order_it < num_tasks; order_it++) {
+            task = order[order_it];
+            if (lct[task] <= lct[last] && est[task] + suffix[order_it] > best) {
+                best = est[task] + suffix[order_it];
+                best_task = task;
+            }
+            prefix[order_it] = best;
+        }
+        ect = best;
+        if (ect > lct[last]) {
+            return CP_CONFLICT;
+        }
+    
+        // Earliest end of the set with every task out of the set
+        for (int order_it = 0; order_it < num_tasks; order_it++) {
+            task = order[order_it];
+            if (lct[task] <= lct[last]) {
+                continue;
+            }
+            end = est[task] + suffix[order_it] + duration[task];
+            if (order_it > 0 && prefix[order_it - 1] > -CP_INFINITY &&
+                prefix[order_it - 1] + duration[task] > end) {
+                end = prefix[order_it - 1] + duration[task];
+            }
+            if (end > lct[last] && ect > new_est[task]) {
+                new_est[task] = ect;
+                source[task] = best_task;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ Not-last of a disjunctive resource. If a task cannot start after the earliest end of a set of other tasks, it cannot
+ be the last one of them, so it has to end before the latest start of the set. The earliest end of the set is bounded
+ with its earliest start plus its durations
+
+ @param num_tasks number of tasks
+ @param est earliest start of every task
+ @param lct latest completion of every task
+ @param duration duration of every task
+ @param new_lct array where the new latest completions are saved
+ @param source array where the task whose latest start gave every new latest completion is saved
+ @param order array to sort the tasks
+ */
+void cp_not_last(int num_tasks, long long int *est, long long int *lct, long long int *duration,
+                 long long int *new_lct, int *source, int *order) {
+    
+    long long int *lst = &cp_scratch[8 * cp_scratch_capacity];
+    long long int min_est, sum;
+    int task;
+    
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        lst[task_it] = lct[task_it] - duration[task_it];
+    }
+    cp_sort_tasks(num_tasks, lst, order);
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        min_est = CP_INFINITY;
+        sum = 0;
+        for (int order_it = 0; order_it < num_tasks; order_it++) {
+            task = order[order_it];
+            if (task == task_it) {
+                continue;
+            }
+            if (lst[task] >= new_lct[task_it]) {
+                break;                  // The set cannot reduce the latest completion anymore
+            }
+            if (est[task] < min_est) {
+                min_est = est[task];
+            }
+            sum += duration[task];
+            if (min_est + sum > lst[task_it]) {
+                new_lct[task_it] = lst[task];
+                source[task_it] = task;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ Propagate a disjunctive resource with timetabling, edge finding and not-last, and the same rules in the mirrored
+ resource (times multiplied by -1) for the latest completions and not-first.
+ Every new bound saves the bound of the task that gave it as antecedent, as the difference rows do, so a cycle of
+ precedences and resources that keeps pushing the same bound is detected instead of moving it one task at a time
+
+ @param constraint index of the resource
+ @return 0 if done correctly, CP_CONFLICT if the resource is overloaded
+ */
+int cp_propagate_resource(int constraint) {
+    
+    CPConstraint *constraint_pt = &cp_constraints[constraint];
+    int num_tasks = constraint_pt->num_tasks;
+    long long int *est = &cp_scratch[0];
+    long long int *lct = &cp_scratch[cp_scratch_capacity];
+    long long int *new_est = &cp_scratch[2 * cp_scratch_capacity];
+    long long int *new_lct = &cp_scratch[3 * cp_scratch_capacity];
+    long long int *mirror_est = &cp_scratch[4 * cp_scratch_capacity];
+    long long int *mirror_lct = &cp_scratch[5 * cp_scratch_capacity];
+    long long int *mirror_new_est = &cp_scratch[6 * cp_scratch_capacity];
+    long long int *mirror_new_lct = &cp_scratch[7 * cp_scratch_capacity];
+    long long int *duration = constraint_pt->durations;
+    int *order = cp_scratch_index;
+    int *est_source = &cp_scratch_index[2 * cp_scratch_capacity];
+    int *lct_source = &cp_scratch_index[3 * cp_scratch_capacity];
+    int *mirror_est_source = &cp_scratch_index[4 * cp_scratch_capacity];
+    int *mirror_lct_source = &cp_scratch_index[5 * cp_scratch_capacity];
+    int variable, lower_antecedent, upper_antecedent;
+    
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        variable = constraint_pt->tasks[task_it];
+        est_source[task_it] = -1;
+        lct_source[task_it] = -1;
+        mirror_est_source[task_it] = -1;
+        mirror_lct_source[task_it] = -1;
+        est[task_it] = cp_lower[variable];
+        lct[task_it] = cp_upper[variable] + duration[task_it];
+        new_est[task_it] = est[task_it];
+        new_lct[task_it] = lct[task_it];
+        mirror_est[task_it] = -lct[task_it];
+        mirror_lct[task_it] = -est[task_it];
+        mirror_new_est[task_it] = mirror_est[task_it];
+        mirror_new_lct[task_it] = mirror_lct[task_it];
+    }
+    
+    if (cp_timetable(num_tasks, est, lct, duration, new_est, est_source, order) < 0 ||
+        cp_timetable(num_tasks, mirror_est, mirror_lct, duration, mirror_new_est, mirror_est_source, order) < 0 ||
+        cp_edge_finding(num_tasks, est, lct, duration, new_est, est_source, order) < 0 ||
+        cp_edge_finding(num_tasks, mirror_est, mirror_lct, duration, mirror_new_est, mirror_est_source, order) < 0) {
+        return CP_CONFLICT;
+    }
+    cp_not_last(num_tasks, est, lct, duration, new_lct, lct_source, order);
+    cp_not_last(num_tasks, mirror_est, mirror_lct, duration, mirror_new_lct, mirror_lct_source, order);
+    
+    // Earliest starts come from lower bounds and latest completions from upper bounds (the mirrored ones swapped).
+    // The antecedents are taken before applying any bound, as all the rules used the same bounds
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        if (-mirror_new_lct[task_it] > new_est[task_it]) {
+            new_est[task_it] = -mirror_new_lct[task_it];
+            est_source[task_it] = mirror_lct_source[task_it];
+        }
+        if (-mirror_new_est[task_it] < new_lct[task_it]) {
+            new_lct[task_it] = -mirror_new_est[task_it];
+            lct_source[task_it] = mirror_est_source[task_it];
+        }
+        if (est_source[task_it] >= 0) {
+            est_source[task_it] = cp_lower_entry[constraint_pt->tasks[est_source[task_it]]];
+        }
+        if (lct_source[task_it] >= 0) {
+            lct_source[task_it] = cp_upper_entry[constraint_pt->tasks[lct_source[task_it]]];
+        }
+    }
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        variable = constraint_pt->tasks[task_it];
+        lower_antecedent = est_source[task_it];
+        upper_antecedent = lct_source[task_it];
+        if (cp_set_lower(variable, new_est[task_it], constraint, lower_antecedent) < 0 ||
+            cp_set_upper(variable, new_lct[task_it] - duration[task_it], constraint, upper_antecedent) < 0) {
+            return CP_CONFLICT;
+        }
+    }
+    return 0;
+}
+
+/**
+ Propagate that the weighted sum of an objective reaches its bound, or improves it if it is strict
+
+ @param constraint index of the objective
+ @return 0 if done correctly, CP_CONFLICT if it cannot hold
+ */
+int cp_propagate_objective(int constraint) {
+    
+    CPConstraint *constraint_pt = &cp_constraints[constraint];
+    double need, max = 0.0, rest, weight;
+    int variable, other, antecedent, entry;
+    
+    if (constraint_pt->active == 0) {
+        return 0;
+    }
+    need = constraint_pt->bound + (constraint_pt->strict == 1 ? 1.0 : -1.0) * CP_EPSILON *
+           (1.0 + fabs(constraint_pt->bound));
+    for (int term_it = 0; term_it < constraint_pt->num_tasks; term_it++) {
+        variable = constraint_pt->tasks[term_it];
+        weight = constraint_pt->weights[term_it];
+        max += weight * (weight > 0 ? cp_upper[variable] : cp_lower[variable]);
+    }
+    if (max < need) {
+        return CP_CONFLICT;
+    }
+    for (int term_it = 0; term_it < constraint_pt->num_tasks; term_it++) {
+        variable = constraint_pt->tasks[term_it];
+        weight = constraint_pt->weights[term_it];
+        if (weight == 0.0) {
+            continue;
+        }
+        rest = max - weight * (weight > 0 ? cp_upper[variable] : cp_lower[variable]);
+        // As in the linear rows, terms with weight 1 or -1 save the most recent bound of another of them
+        antecedent = -1;
+        for (int other_it = 0; other_it < constraint_pt->num_tasks && fabs(weight) == 1.0; other_it++) {
+            other = constraint_pt->tasks[other_it];
+            if (other_it == term_it || other == variable || fabs(constraint_pt->weights[other_it]) != 1.0) {
+                continue;
+            }
+            entry = constraint_pt->weights[other_it] > 0 ? cp_upper_entry[other] : cp_lower_entry[other];
+            if (entry > antecedent) {
+                antecedent = entry;
+            }
+        }
+        if (weight > 0 && cp_set_lower(variable, (long long int) ceil((need - rest) / weight - 1e-9),
+                                       constraint, antecedent) < 0) {
+            return CP_CONFLICT;
+        }
+        if (weight < 0 && cp_set_upper(variable, (long long int) floor((need - rest) / weight + 1e-9),
+                                       constraint, antecedent) < 0) {
+            return CP_CONFLICT;
+        }
+    }
+    return 0;
+}
+
+/**
+ Propagate all the constraints of the queue until none of them changes any bound
+
+ @return 0 if done correctly, CP_CONFLICT if a constraint cannot hold (saved in the conflict constraint)
+ */
+int cp_propagate(void) {
+    
+    int constraint;
+    int result = 0;
+    
+    cp_propagation_stamp++;
+    while (cp_queue_size > 0) {
+        constraint = cp_queue[cp_queue_head];
+        cp_queue_head = (cp_queue_head + 1) % cp_num_constraints;
+        cp_queue_size--;
+        cp_in_queue[constraint] = 0;
+        switch (cp_constraints[constraint].type) {
+            case cp_linear_constraint:
+                result = cp_propagate_row(&cp_constraints[constraint].rows[0], constraint);
+                break;
+            case cp_disjunction_constraint:
+                result = cp_propagate_disjunction(constraint);
+                break;
+            case cp_or_constraint:
+                result = cp_propagate_or(constraint);
+                break;
+            case cp_exactly_one_constraint:
+                result = cp_propagate_exactly_one(constraint);
+                break;
+            case cp_resource_constraint:
+                result = cp_propagate_resource(constraint);
+                break;
+            case cp_objective_constraint:
+                result = cp_propagate_objective(constraint);
+                break;
+            default:
+                break;
+        }
+        if (result < 0) {
+            cp_conflict_constraint = constraint;
+            cp_clear_queue();
+            return CP_CONFLICT;
+        }
+    }
+    return 0;
+}
+
+/**
+ Apply a decision of the search, or its refutation with the decisions that caused it
+
+ @param decision pointer to the decision
+ @param reason CP_DECISION or CP_REFUTATION
+ @param num_antecedents number of decisions that caused the refutation
+ @param antecedents entries of the decisions that caused the refutation
+ @return 0 if done correctly, CP_CONFLICT if the refutation empties the domain (explained in the conflict entries)
+ */
+int cp_apply_decision(CPDecision *decision, int reason, int num_antecedents, int *antecedents) {
+    
+    int position = cp_trail_size;
+    int result = 0;
+    
+    switch (decision->type) {
+        case cp_lower_decision:
+            result = cp_set_lower(decision->index, decision->value, reason, -1);
+            if (result < 0) {
+                cp_append(&cp_conflict_entries, &cp_num_conflict_entries, &cp_conflict_capacity,
+                          cp_upper_entry[decision->index]);
+            }
+            break;
+        case cp_upper_decision:
+            result = cp_set_upper(decision->index, decision->value, reason, -1);
+            if (result < 0) {
+                cp_append(&cp_conflict_entries, &cp_num_conflict_entries, &cp_conflict_capacity,
+                          cp_lower_entry[decision->index]);
+            }
+            break;
+        case cp_choose_decision:
+            cp_exclude_rows(decision->index, ~(1u << decision->value), reason);
+            break;
+        case cp_exclude_decision:
+            cp_exclude_rows(decision->index, 1u << decision->value, reason);
+            break;
+        default:
+            break;
+    }
+    if (result < 0) {
+        // The refutation did not change anything, so the decisions that caused it explain the conflict
+        cp_conflict_constraint = -1;
+        for (int antecedent_it = 0; antecedent_it < num_antecedents; antecedent_it++) {
+            cp_append(&cp_conflict_entries, &cp_num_conflict_entries, &cp_conflict_capacity,
+                      antecedents[antecedent_it]);
+        }
+        return CP_CONFLICT;
+    }
+    if (reason == CP_REFUTATION && cp_trail_size > position && num_antecedents > 0) {
+        cp_trail[position].num_antecedents = num_antecedents;
+        cp_trail[position].antecedents = malloc(sizeof(int) * num_antecedents);
+        memcpy(cp_trail[position].antecedents, antecedents, sizeof(int) * num_antecedents);
+    }
+    return 0;
+}
+
+/**
+ Get the refutation of a decision
+
+ @param decision pointer to the decision
+ @param refutation pointer to save the refutation
+ */
+void cp_refute_decision(CPDecision *decision, CPDecision *refutation) {
+    
+    refutation->index = decision->index;
+    switch (decision->type) {
+        case cp_lower_decision:
+            refutation->type = cp_upper_decision;
+            refutation->value = decision->value - 1;
+            break;
+        case cp_upper_decision:
+            refutation->type = cp_lower_decision;
+            refutation->value = decision->value + 1;
+            break;
+        case cp_choose_decision:
+            refutation->type = cp_exclude_decision;
+            refutation->value = decision->value;
+            break;
+        default:
+            refutation->type = cp_choose_decision;
+            refutation->value = decision->value;
+            break;
+    }
+}
+
+/**
+ Choose the next decision of the search. First the literals (the paths), then the order of the disjunctions with more
+ conflicts, choosing the row with more slack, and last the smallest start of the variables left, offsets first
+
+ @param decision pointer to save the decision
+ @return 1 if there is a decision, 0 if all variables are fixed and the current bounds are a solution
+ */
+int cp_next_decision(CPDecision *decision) {
+    
+    CPConstraint *constraint_pt;
+    double best_activity = -1.0;
+    long long int best_slack, slack;
+    int best = -1, best_row = -1, num_possible, guards_hold;
+    
+    // Literals with more conflicts first, the true value chooses the path
+    for (int variable_it = 0; variable_it < cp_num_variables; variable_it++) {
+        if (cp_domains[variable_it] == boolean_domain && cp_lower[variable_it] != cp_upper[variable_it] &&
+            cp_variable_activity[variable_it] > best_activity) {
+            best = variable_it;
+            best_activity = cp_variable_activity[variable_it];
+        }
+    }
+    if (best >= 0) {
+        decision->type = cp_lower_decision;
+        decision->index = best;
+        decision->value = 1;
+        return 1;
+    }
+    
+    // Disjunctions that are still open, with more conflicts first
+    for (int constraint_it = 0; constraint_it < cp_num_constraints; constraint_it++) {
+        constraint_pt = &cp_constraints[constraint_it];
+        if (constraint_pt->type != cp_disjunction_constraint || constraint_pt->num_rows < 2 ||
+            constraint_pt->activity <= best_activity) {
+            continue;
+        }
+        guards_hold = 1;
+        for (int guard_it = 0; guard_it < constraint_pt->num_guards; guard_it++) {
+            if (cp_lower[constraint_pt->guards[guard_it]] != constraint_pt->guard_values[guard_it] ||
+                cp_upper[constraint_pt->guards[guard_it]] != constraint_pt->guard_values[guard_it]) {
+                guards_hold = 0;
+            }
+        }
+        if (guards_hold == 0) {
+            continue;
+        }
+        num_possible = 0;
+        for (int row_it = 0; row_it < constraint_pt->num_rows && num_possible >= 0; row_it++) {
+            if ((constraint_pt->excluded >> row_it) & 1) {
+                continue;
+            }
+            if (cp_row_entailed(&constraint_pt->rows[row_it])) {
+                num_possible = -1;      // It already holds
+            } else if (cp_row_possible(&constraint_pt->rows[row_it])) {
+                num_possible++;
+            }
+        }
+        if (num_possible > 1) {
+            best = constraint_it;
+            best_activity = constraint_pt->activity;
+        }
+    }
+    if (best >= 0) {
+        constraint_pt = &cp_constraints[best];
+        best_slack = -CP_INFINITY;
+        for (int row_it = 0; row_it < constraint_pt->num_rows; row_it++) {
+            if (((constraint_pt->excluded >> row_it) & 1) == 0 && cp_row_possible(&constraint_pt->rows[row_it])) {
+                slack = cp_row_slack(&constraint_pt->rows[row_it]);
+                if (slack > best_slack) {
+                    best_slack = slack;
+                    best_row = row_it;
+                }
+            }
+        }
+        decision->type = cp_choose_decision;
+        decision->index = best;
+        decision->value = best_row;
+        return 1;
+    }
+    
+    // Variables left at their earliest time, the smallest first. The ordered ones (offsets) go before the rest (as
+    // the latencies), which only depend on them and get their value when all the offsets have one
+    for (int variable_it = 0; variable_it < cp_num_variables; variable_it++) {
+        if (cp_lower[variable_it] != cp_upper[variable_it] &&
+            (best < 0 || cp_ordered[variable_it] > cp_ordered[best] ||
+             (cp_ordered[variable_it] == cp_ordered[best] && cp_lower[variable_it] < cp_lower[best]))) {
+            best = variable_it;
+        }
+    }
+    if (best >= 0) {
+        decision->type = cp_upper_decision;
+        decision->index = best;
+        decision->value = cp_lower[best];
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ Reset the search to the root bounds, with all the constraints in the queue to propagate them again
+ */
+void cp_reset_search(void) {
+    
+    cp_backjump(-1);
+    cp_level = 0;
+    for (int variable_it = 0; variable_it < cp_num_variables; variable_it++) {
+        cp_lower[variable_it] = cp_root_lower[variable_it];
+        cp_upper[variable_it] = cp_root_upper[variable_it];
+        cp_lower_entry[variable_it] = -1;
+        cp_upper_entry[variable_it] = -1;
+        cp_update_stamp[variable_it] = 0;
+    }
+    cp_lower_head = realloc(cp_lower_head, sizeof(int) * (cp_num_variables + 1));
+    cp_upper_head = realloc(cp_upper_head, sizeof(int) * (cp_num_variables + 1));
+    cp_excluded_head = realloc(cp_excluded_head, sizeof(int) * (cp_num_constraints + 1));
+    free(cp_queue);
+    free(cp_in_queue);
+    cp_queue = malloc(sizeof(int) * (cp_num_constraints + 1));
+    cp_in_queue = calloc(cp_num_constraints + 1, sizeof(char));
+    cp_queue_head = 0;
+    cp_queue_size = 0;
+    for (int constraint_it = 0; constraint_it < cp_num_constraints; constraint_it++) {
+        cp_constraints[constraint_it].excluded = 0;
+        cp_constraints[constraint_it].excluded_entry = -1;
+        cp_enqueue(constraint_it);
+    }
+    cp_num_conflict_entries = 0;
+}
+
+/**
+ Search a solution with the current objective bounds. Every conflict is explained with the decisions that caused it,
+ the search backjumps to the most recent of them but the last one, and the last one is refuted there. The refutation
+ only depends on the rest of decisions, so it is kept until one of them is undone. The search restarts from the root
+ when the failures reach the luby sequence
+
+ @param max_failures failures before giving up the search, 0 to only stop at the time limit
+ @return result of the search
+ */
+CPSearchResult cp_search(long long int max_failures) {
+    
+    CPDecision decision, refutation;
+    int *antecedents = NULL;
+    int num_antecedents = 0, antecedents_capacity = 0;
+    int conflict, highest, second;
+    long long int search_failures = 0;
+    long long int restart_failures = 0;
+    long long int restart_limit = CP_RESTART_BASE * cp_luby(cp_num_restarts);
+    
+    cp_reset_search();
+    conflict = cp_propagate();
+    while (1) {
+        if (clock() > cp_deadline) {
+            free(antecedents);
+            return cp_time_limit;
+        }
+        if (conflict == 0) {
+            conflict = cp_propagate();
+        }
+        if (conflict < 0) {
+            cp_num_failures++;
+            search_failures++;
+            restart_failures++;
+            if (cp_level == 0) {
+                free(antecedents);
+                return cp_infeasible;
+            }
+            highest = cp_analyze_conflict();
+            if (highest == 0) {
+                free(antecedents);
+                return cp_infeasible;
+            }
+            if (max_failures > 0 && search_failures >= max_failures) {
+                free(antecedents);
+                return cp_failure_limit;
+            }
+            // The refutation of the last decision depends on the rest of decisions of the conflict
+            second = 0;
+            num_antecedents = 0;
+            for (int level_it = 1; level_it < highest; level_it++) {
+                if (cp_level_marks[level_it] == 1) {
+                    second = level_it;
+                    cp_append(&antecedents, &num_antecedents, &antecedents_capacity, cp_level_start[level_it]);
+                }
+            }
+            cp_refute_decision(&cp_level_decision[highest], &refutation);
+            cp_conflict_constraint = -1;
+            cp_num_conflict_entries = 0;
+            if (restart_failures >= restart_limit) {
+                cp_num_restarts++;
+                restart_failures = 0;
+                restart_limit = CP_RESTART_BASE * cp_luby(cp_num_restarts);
+                cp_backjump(0);
+                // Only refutations of the root are kept after a restart
+                if (second != 0) {
+                    conflict = 0;
+                    continue;
+                }
+            } else {
+                cp_backjump(second);
+            }
+            conflict = cp_apply_decision(&refutation, CP_REFUTATION, num_antecedents, antecedents);
+            continue;
+        }
+    
+        if (cp_next_decision(&decision) == 0) {
+            free(antecedents);
+            return cp_feasible;
+        }
+        if (cp_level + 1 >= cp_levels_capacity) {
+            cp_levels_capacity = cp_levels_capacity == 0 ? 1024 : cp_levels_capacity * 2;
+            cp_level_start = realloc(cp_level_start, sizeof(int) * cp_levels_capacity);
+            cp_level_decision = realloc(cp_level_decision, sizeof(CPDecision) * cp_levels_capacity);
+            cp_level_marks = realloc(cp_level_marks, sizeof(char) * cp_levels_capacity);
+        }
+        cp_level++;
+        cp_level_start[cp_level] = cp_trail_size;
+        cp_level_decision[cp_level] = decision;
+        conflict = cp_apply_decision(&decision, CP_DECISION, 0, NULL);
+    }
+}
+
+/**
+ Get the value of an objective with the current bounds, all of them fixed
+
+ @param objective index of the objective
+ @return weighted sum of the objective
+ */
+double cp_objective_value(int objective) {
+    
+    CPConstraint *constraint_pt = &cp_constraints[cp_objectives[objective]];
+    double value = 0.0;
+    
+    for (int term_it = 0; term_it < constraint_pt->num_tasks; term_it++) {
+        value += constraint_pt->weights[term_it] * cp_lower[constraint_pt->tasks[term_it]];
+    }
+    return value;
+}
+
+/**
+ Get the largest value an objective can have with the bounds of the variables when the search starts
+
+ @param objective index of the objective
+ @return limit of the weighted sum of the objective
+ */
+double cp_objective_limit(int objective) {
+    
+    CPConstraint *constraint_pt = &cp_constraints[cp_objectives[objective]];
+    double limit = 0.0, weight;
+    int variable;
+    
+    for (int term_it = 0; term_it < constraint_pt->num_tasks; term_it++) {
+        variable = constraint_pt->tasks[term_it];
+        weight = constraint_pt->weights[term_it];
+        limit += weight * (weight > 0 ? cp_root_upper[variable] : cp_root_lower[variable]);
+    }
+    return limit;
+}
+
+/**
+ Free the model of the engine, it can be called several times, the number of constraints is kept until a new
+ model is created to report it
+ */
+void cp_destroy(void) {
+    
+    CPConstraint *constraint_pt;
+    
+    cp_backjump(-1);
+    for (int constraint_it = 0; constraint_it < cp_num_constraints; constraint_it++) {
+        constraint_pt = &cp_constraints[constraint_it];
+        free(constraint_pt->rows);
+        free(constraint_pt->guards);
+        free(constraint_pt->guard_values);
+        free(constraint_pt->literals);
+        free(constraint_pt->tasks);
+        free(constraint_pt->durations);
+        free(constraint_pt->weights);
+        free(constraint_pt->variables);
+        memset(constraint_pt, 0, sizeof(CPConstraint));
+    }
+    for (int variable_it = 0; variable_it < cp_num_variables; variable_it++) {
+        free(cp_watches[variable_it].constraints);
+    }
+    cp_num_variables = 0;
+    cp_num_objectives = 0;
+    free(cp_objectives);
+    cp_objectives = NULL;
+    free(cp_solution);
+    cp_solution = NULL;
+    cp_trail_size = 0;
+    cp_level = 0;
+}
+
+/**
+ Create an empty model, freeing the previous one
+
+ @return 0 if done correctly
+ */
+int cp_create(void) {
+    
+    cp_destroy();
+    cp_num_constraints = 0;
+    cp_activity_increment = 1.0;
+    return 0;
+}
+
+/**
+ Create a variable of the engine, its bounds are clamped to the largest bound of the engine
+
+ @param lower lower bound
+ @param upper upper bound
+ @param domain domain of the variable
+ @param index index of the variable in the optimizator, not used
+ @param name name of the variable, not used
+ @return handle of the variable
+ */
+int cp_new_var(long long int lower, long long int upper, VariableDomain domain, int index, char *name) {
+    
+    int variable = cp_num_variables;
+    
+    (void) index;
+    (void) name;
+    if (cp_num_variables == cp_variables_capacity) {
+        cp_variables_capacity = cp_variables_capacity == 0 ? 1024 : cp_variables_capacity * 2;
+        cp_lower = realloc(cp_lower, sizeof(long long int) * cp_variables_capacity);
+        cp_upper = realloc(cp_upper, sizeof(long long int) * cp_variables_capacity);
+        cp_root_lower = realloc(cp_root_lower, sizeof(long long int) * cp_variables_capacity);
+        cp_root_upper = realloc(cp_root_upper, sizeof(long long int) * cp_variables_capacity);
+        cp_created_lower = realloc(cp_created_lower, sizeof(long long int) * cp_variables_capacity);
+        cp_lower_entry = realloc(cp_lower_entry, sizeof(int) * cp_variables_capacity);
+        cp_upper_entry = realloc(cp_upper_entry, sizeof(int) * cp_variables_capacity);
+        cp_domains = realloc(cp_domains, sizeof(VariableDomain) * cp_variables_capacity);
+        cp_variable_activity = realloc(cp_variable_activity, sizeof(double) * cp_variables_capacity);
+        cp_ordered = realloc(cp_ordered, sizeof(char) * cp_variables_capacity);
+        cp_update_stamp = realloc(cp_update_stamp, sizeof(int) * cp_variables_capacity);
+        cp_update_count = realloc(cp_update_count, sizeof(int) * cp_variables_capacity);
+        cp_watches = realloc(cp_watches, sizeof(CPWatchList) * cp_variables_capacity);
+    }
+    if (domain == boolean_domain) {
+        lower = lower > 0 ? 1 : 0;
+        upper = upper < 1 ? 0 : 1;
+    }
+    lower = lower < -CP_INFINITY ? -CP_INFINITY : lower;
+    upper = upper > CP_INFINITY ? CP_INFINITY : upper;
+    cp_lower[variable] = lower;
+    cp_upper[variable] = upper;
+    cp_root_lower[variable] = lower;
+    cp_root_upper[variable] = upper;
+    cp_created_lower[variable] = lower;
+    cp_lower_entry[variable] = -1;
+    cp_upper_entry[variable] = -1;
+    cp_domains[variable] = domain;
+    cp_variable_activity[variable] = 0.0;
+    cp_ordered[variable] = 0;
+    cp_update_stamp[variable] = 0;
+    cp_update_count[variable] = 0;
+    cp_watches[variable].num_constraints = 0;
+    cp_watches[variable].capacity = 0;
+    cp_watches[variable].constraints = NULL;
+    cp_num_variables++;
+    return variable;
+}
+
+/**
+ Add a linear row that always holds
+
+ @param constraint pointer to the linear row
+ @return 0 if done correctly, error code otherwise
+ */
+int cp_add_diff(LinearConstraint *constraint) {
+    
+    int result = cp_check_row(constraint);
+    
+    if (result < 0) {
+        return result;
+    }
+    cp_set_rows(cp_new_constraint(cp_linear_constraint), 1, constraint, 0, NULL, NULL);
+    return 0;
+}
+
+/**
+ Add a linear row that only holds when the literal has the given value
+
+ @param literal handle of the literal
+ @param value value of the literal that activates the row
+ @param constraint pointer to the linear row
+ @return 0 if done correctly, error code otherwise
+ */
+int cp_add_guarded(int literal, int value, LinearConstraint *constraint) {
+    
+    int result = cp_check_row(constraint);
+    
+    if (result < 0) {
+        return result;
+    }
+    if (literal < 0 || literal >= cp_num_variables) {
+        return CP_VARIABLE_OUT_OF_RANGE;
+    }
+    cp_set_rows(cp_new_constraint(cp_disjunction_constraint), 1, constraint, 1, &literal, &value);
+    return 0;
+}
+
+/**
+ Add that at least one of the rows holds, unless any of the guard literals is false
+
+ @param num_constraints number of rows
+ @param constraints array with the rows
+ @param num_guards number of guards
+ @param guards array with the guard literals
+ @return 0 if done correctly, error code otherwise
+ */
+int cp_add_disjunction(int num_constraints, LinearConstraint *constraints, int num_guards, int *guards) {
+    
+    int *values;
+    int result;
+    
+    if (num_constraints > CP_MAX_ALTERNATIVES) {
+        printf("The CP engine only has disjunctions of up to %d rows\n", CP_MAX_ALTERNATIVES);
+        return CP_TOO_MANY_ALTERNATIVES;
+    }
+    for (int row_it = 0; row_it < num_constraints; row_it++) {
+        result = cp_check_row(&constraints[row_it]);
+        if (result < 0) {
+            return result;
+        }
+    }
+    values = malloc(sizeof(int) * (num_guards + 1));
+    for (int guard_it = 0; guard_it < num_guards; guard_it++) {
+        if (guards[guard_it] < 0 || guards[guard_it] >= cp_num_variables) {
+            free(values);
+            return CP_VARIABLE_OUT_OF_RANGE;
+        }
+        values[guard_it] = 1;
+    }
+    cp_set_rows(cp_new_constraint(cp_disjunction_constraint), num_constraints, constraints, num_guards, guards,
+                values);
+    free(values);
+    return 0;
+}
+
+/**
+ Add a constraint over literals, or and exactly one
+
+ @param type type of the constraint
+ @param result handle of the result literal, NO_VARIABLE if there is none
+ @param num_literals number of literals
+ @param literals array with the literals
+ @return 0 if done correctly, error code otherwise
+ */
+int cp_add_literals(CPConstraintType type, int result, int num_literals, int *literals) {
+    
+    int constraint;
+    
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        if (literals[literal_it] < 0 || literals[literal_it] >= cp_num_variables) {
+            return CP_VARIABLE_OUT_OF_RANGE;
+        }
+    }
+    constraint = cp_new_constraint(type);
+    cp_constraints[constraint].result = result;
+    cp_constraints[constraint].num_literals = num_literals;
+    cp_constraints[constraint].literals = malloc(sizeof(int) * (num_literals + 1));
+    memcpy(cp_constraints[constraint].literals, literals, sizeof(int) * num_literals);
+    if (result != NO_VARIABLE) {
+        cp_watch(constraint, result);
+    }
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        cp_watch(constraint, literals[literal_it]);
+    }
+    return 0;
+}
+
+/**
+ Add that the result literal is true if and only if any of the literals is true
+
+ @param result handle of the result literal
+ @param num_literals number of literals
+ @param literals array with the literals
+ @return 0 if done correctly, error code otherwise
+ */
+int cp_add_or(int result, int num_literals, int *literals) {
+    
+    if (result < 0 || result >= cp_num_variables) {
+        return CP_VARIABLE_OUT_OF_RANGE;
+    }
+    return cp_add_literals(cp_or_constraint, result, num_literals, literals);
+}
+
+/**
+ Add that exactly one of the literals is true
+
+ @param num_literals number of literals
+ @param literals array with the literals
+ @return 0 if done correctly, error code otherwise
+ */
+int cp_add_exactly_one(int num_literals, int *literals) {
+    
+    return cp_add_literals(cp_exactly_one_constraint, NO_VARIABLE, num_literals, literals);
+}
+
+/**
+ Add a disjunctive resource, the tasks never overlap
+
+ @param num_tasks number of tasks
+ @param variables start variable of every task
+ @param durations duration of every task
+ @return 0 if done correctly, error code otherwise
+ */
+int cp_add_resource(int num_tasks, int *variables, long long int *durations) {
+    
+    int constraint;
+    
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        if (variables[task_it] < 0 || variables[task_it] >= cp_num_variables) {
+            return CP_VARIABLE_OUT_OF_RANGE;
+        }
+    }
+    constraint = cp_new_constraint(cp_resource_constraint);
+    cp_constraints[constraint].num_tasks = num_tasks;
+    cp_constraints[constraint].tasks = malloc(sizeof(int) * (num_tasks + 1));
+    cp_constraints[constraint].durations = malloc(sizeof(long long int) * (num_tasks + 1));
+    memcpy(cp_constraints[constraint].tasks, variables, sizeof(int) * num_tasks);
+    memcpy(cp_constraints[constraint].durations, durations, sizeof(long long int) * num_tasks);
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        cp_watch(constraint, variables[task_it]);
+    }
+    
+    // The scratch memory has ten arrays of long long integers and six of integers per task
+    if (num_tasks > cp_scratch_capacity) {
+        cp_scratch_capacity = num_tasks;
+        cp_scratch = realloc(cp_scratch, sizeof(long long int) * 10 * cp_scratch_capacity);
+        cp_scratch_index = realloc(cp_scratch_index, sizeof(int) * 6 * cp_scratch_capacity);
+    }
+    return 0;
+}
+
+/**
+ Add an objective to maximize, less important than the previous ones. It is a constraint that is only enforced while
+ optimizing, to look for solutions better than the best one found
+
+ @param num_variables number of variables
+ @param variables array with the variables
+ @param values array with the weight of every variable
+ @return 0 if done correctly, error code otherwise
+ */
+int cp_set_objective(int num_variables, int *variables, double *values) {
+    
+    int constraint;
+    
+    for (int variable_it = 0; variable_it < num_variables; variable_it++) {
+        if (variables[variable_it] < 0 || variables[variable_it] >= cp_num_variables) {
+            return CP_VARIABLE_OUT_OF_RANGE;
+        }
+    }
+    constraint = cp_new_constraint(cp_objective_constraint);
+    cp_constraints[constraint].num_tasks = num_variables;
+    cp_constraints[constraint].tasks = malloc(sizeof(int) * (num_variables + 1));
+    cp_constraints[constraint].weights = malloc(sizeof(double) * (num_variables + 1));
+    memcpy(cp_constraints[constraint].tasks, variables, sizeof(int) * num_variables);
+    memcpy(cp_constraints[constraint].weights, values, sizeof(double) * num_variables);
+    for (int variable_it = 0; variable_it < num_variables; variable_it++) {
+        cp_watch(constraint, variables[variable_it]);
+    }
+    cp_objectives = realloc(cp_objectives, sizeof(int) * (cp_num_objectives + 1));
+    cp_objectives[cp_num_objectives] = constraint;
+    cp_num_objectives++;
+    return 0;
+}
+
+/**
+ Change the lower bound of a variable for the next searches
+
+ @param variable handle of the variable
+ @param lower new lower bound
+ @return 0 if done correctly, error code otherwise
+ */
+int cp_set_lower_bound(int variable, long long int lower) {
+    
+    if (variable < 0 || variable >= cp_num_variables) {
+        return CP_VARIABLE_OUT_OF_RANGE;
+    }
+    cp_root_lower[variable] = lower > cp_created_lower[variable] ? lower : cp_created_lower[variable];
+    return 0;
+}
+
+/**
+ Solve the model with the given time limit. The objectives are optimized lexicographically with a dichotomic search,
+ every search asks for a value of the objective halfway between the best solution found and the limit that is known to
+ be impossible. A solution raises the best value and an infeasible search lowers the limit, while a search that fails
+ too many times only halves the next step. Close to the best value, the last search has to improve it without limit of
+ failures, and if it cannot, the objective keeps its best value while the next one is optimized. Asking every time to
+ improve the best solution would move the objective one nanosecond at a time
+
+ @param time limit time in seconds
+ @return 1 if a solution was found, SOLUTION_NOT_PROVEN if the time limit stopped the search after finding one, 0 if
+ there is none, BACKEND_TIME_LIMIT if the time limit stopped it before finding any
+ */
+int cp_solve(int time) {
+    
+    CPConstraint *objective_pt;
+    CPSearchResult result = cp_infeasible;
+    double best = 0.0, limit = 0.0, probe = 0.0, target;
+    int found = 0;
+    
+    cp_deadline = clock() + (clock_t) time * CLOCKS_PER_SEC;
+    cp_num_failures = 0;
+    cp_num_restarts = 0;
+    free(cp_solution);
+    cp_solution = malloc(sizeof(long long int) * (cp_num_variables + 1));
+    for (int objective_it = 0; objective_it < cp_num_objectives; objective_it++) {
+        cp_constraints[cp_objectives[objective_it]].active = 0;
+    }
+    
+    // Any solution first, then every objective improves it
+    result = cp_search(0);
+    if (result == cp_feasible) {
+        found = 1;
+        memcpy(cp_solution, cp_lower, sizeof(long long int) * cp_num_variables);
+    }
+    for (int objective_it = 0; objective_it < cp_num_objectives && result == cp_feasible; objective_it++) {
+        objective_pt = &cp_constraints[cp_objectives[objective_it]];
+        best = cp_objective_value(objective_it);
+        limit = cp_objective_limit(objective_it) + 1.0;
+        probe = limit;
+        objective_pt->active = 1;
+        while (1) {
+            if (probe - best <= 1.0 + CP_EPSILON * (1.0 + fabs(best))) {
+                target = best;
+                objective_pt->strict = 1;
+            } else {
+                target = best + ceil((probe - best) / 2);
+                objective_pt->strict = 0;
+            }
+            objective_pt->bound = target;
+            result = cp_search(objective_pt->strict == 1 ? 0 : CP_PROBE_FAILURES);
+            if (result == cp_time_limit || (result == cp_infeasible && objective_pt->strict == 1)) {
+                break;
+            }
+            if (result == cp_failure_limit) {
+                probe = target;
+            } else if (result == cp_infeasible) {
+                limit = target;
+                probe = target;
+            } else {
+                memcpy(cp_solution, cp_lower, sizeof(long long int) * cp_num_variables);
+                best = cp_objective_value(objective_it);
+                probe = limit;
+            }
+        }
+        // The objective keeps its best value for the next ones
+        objective_pt->bound = best;
+        objective_pt->strict = 0;
+        if (result == cp_infeasible) {
+            result = cp_feasible;
+        }
+    }
+    if (get_backend_statistics() == 1) {
+        printf("The CP engine found %s after %lld failures and %d restarts\n",
+               found == 0 ? "no solution" : (result == cp_time_limit ? "a solution" : "the best solution"),
+               cp_num_failures, cp_num_restarts);
+    }
+    
+    cp_reset_search();
+    if (found == 0) {
+        free(cp_solution);
+        cp_solution = NULL;
+        return result == cp_time_limit ? BACKEND_TIME_LIMIT : 0;
+    }
+    return result == cp_time_limit ? SOLUTION_NOT_PROVEN : 1;
+}
+
+/**
+ Get the value of a variable in the best solution found
+
+ @param variable handle of the variable
+ @param value pointer to save the value
+ @return 0 if done correctly, error code otherwise
+ */
+int cp_get_value(int variable, long long int *value) {
+    
+    if (cp_solution == NULL) {
+        return NO_CP_SOLUTION;
+    }
+    if (variable < 0 || variable >= cp_num_variables) {
+        return CP_VARIABLE_OUT_OF_RANGE;
+    }
+    *value = cp_solution[variable];
+    return 0;
+}
+
+/**
+ Get the number of constraints of the model
+
+ @return number of constraints
+ */
+long long int cp_get_num_constraints(void) {
+    
+    return cp_num_constraints;
+}
+
+/* PUBLIC FUNCTIONS */
+
+/**
+ Get the built in backend of the CP engine, which finds the schedule with its own propagation and search
+
+ @return pointer to the backend
+ */
+SolverBackend * get_cp_backend(void) {
+    
+    static SolverBackend cp_backend = {
+        .version = BACKEND_INTERFACE_VERSION,
+        .name = "cp",
+        .distances = 0,
+        .create = cp_create,
+        .open_export = NULL,
+        .new_var = cp_new_var,
+        .add_diff = cp_add_diff,
+        .add_guarded = cp_add_guarded,
+        .add_disjunction = cp_add_disjunction,
+        .add_or = cp_add_or,
+        .add_exactly_one = cp_add_exactly_one,
+        .add_resource = cp_add_resource,
+        .set_objective = cp_set_objective,
+        .set_lower_bound = cp_set_lower_bound,
+        .solve = cp_solve,
+        .solve_assuming = NULL,
+        .tune = NULL,
+        .get_value = cp_get_value,
+        .get_num_constraints = cp_get_num_constraints,
+        .destroy = cp_destroy
+    };
+    
+    return &cp_backend;
+}
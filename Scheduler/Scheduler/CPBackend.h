@@ -0,0 +1,149 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  CPBackend.h                                                                                                        *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Package that contains the native constraint programming engine. Variables are integer intervals, every link is a   *
+ *  disjunctive resource propagated with timetabling, edge finding and not-first/not-last, and the precedences of the  *
+ *  paths are difference rows propagated until a fixpoint. The search branches on the order of the disjunctions,       *
+ *  backjumps to the decisions that caused every conflict and restarts following the luby sequence.                    *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef CPBackend_h
+#define CPBackend_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#endif /* CPBackend_h */
+
+/* ERROR CODE DEFINITIONS */
+
+#define CP_VARIABLE_OUT_OF_RANGE -1
+#define CP_COEFFICIENT_TOO_LARGE -2
+#define CP_TOO_MANY_ALTERNATIVES -3
+#define NO_CP_SOLUTION -4
+#define CP_CONFLICT -5
+
+/* CODE DEFINITIONS */
+
+#define CP_INFINITY (1LL << 50)             // Largest absolute bound, larger bounds are clamped so sums never overflow
+#define CP_MAX_COEFFICIENT 1024             // Largest absolute coefficient of a linear row
+#define CP_MAX_ALTERNATIVES 31              // Largest number of rows of a disjunction (bits of the excluded mask)
+#define CP_DECISION -1                      // Reason of a change done by a decision of the search
+#define CP_REFUTATION -2                    // Reason of a change done by refuting a decision that failed
+#define CP_RESTART_BASE 100                 // Failures before the first restart, scaled by the luby sequence
+#define CP_PROBE_FAILURES 5000              // Failures before giving up a value of the objective and halving the step
+#define CP_CYCLE_UPDATES 3                  // Changes of a bound in one propagation before looking for a cycle
+#define CP_EPSILON 1e-6                     // Relative improvement needed in an objective with real weights
+
+/* STRUCT DEFINITIONS */
+
+/**
+ Types of the constraints of the engine
+ */
+typedef enum CPConstraintType {
+    cp_linear_constraint,               // Linear row that always holds
+    cp_disjunction_constraint,          // At least one row holds if all the guards have their value
+    cp_or_constraint,                   // The result literal is the disjunction of the literals
+    cp_exactly_one_constraint,          // Exactly one of the literals is true
+    cp_resource_constraint,             // Tasks of a disjunctive resource that can never overlap
+    cp_objective_constraint             // Weighted sum larger than the best solution found, only while optimizing
+}CPConstraintType;
+
+/**
+ Constraint of the engine, only the fields of its type are used
+ */
+typedef struct CPConstraint {
+    CPConstraintType type;              // Type of the constraint
+    int num_rows;                       // Number of rows (linear and disjunction)
+    LinearConstraint *rows;             // Linear rows (linear and disjunction)
+    int num_guards;                     // Number of guards (disjunction)
+    int *guards;                        // Literals that activate the rows (disjunction)
+    int *guard_values;                  // Value of every guard that activates the rows (disjunction)
+    int result;                         // Literal with the result (or)
+    int num_literals;                   // Number of literals (or and exactly one)
+    int *literals;                      // Literals (or and exactly one)
+    int num_tasks;                      // Number of tasks (resource and objective)
+    int *tasks;                         // Start variable of every task, or variable of every term (objective)
+    long long int *durations;           // Duration of every task (resource)
+    double *weights;                    // Weight of every term (objective)
+    int active;                         // 1 if the bound of the objective is enforced (objective)
+    int strict;                         // 1 if the sum has to improve the bound, 0 if it only has to reach it
+    double bound;                       // Bound of the weighted sum (objective)
+    unsigned int excluded;              // Rows excluded by the search (disjunction)
+    int excluded_entry;                 // Last entry of the trail that changed the excluded rows, -1 if none
+    int num_variables;                  // Number of variables watched by the constraint
+    int variables_capacity;             // Number of watched variables allocated
+    int *variables;                     // Variables watched by the constraint, to wake it up and explain it
+    double activity;                    // Conflicts where the constraint took part, decayed over time
+}CPConstraint;
+
+/**
+ Constraints that have to be woken up when the bounds of a variable change
+ */
+typedef struct CPWatchList {
+    int num_constraints;
+    int capacity;
+    int *constraints;
+}CPWatchList;
+
+/**
+ Types of the changes saved in the trail
+ */
+typedef enum CPTrailType {
+    cp_lower_change,                    // Lower bound of a variable
+    cp_upper_change,                    // Upper bound of a variable
+    cp_excluded_change                  // Rows excluded of a disjunction
+}CPTrailType;
+
+/**
+ Change saved in the trail, so it can be undone when backjumping and explained when analyzing a conflict
+ */
+typedef struct CPTrailEntry {
+    CPTrailType type;                   // What was changed
+    int index;                          // Variable or constraint changed
+    long long int old_value;            // Value before the change
+    int previous;                       // Previous entry of the same bound or constraint, -1 if none
+    int level;                          // Decision level of the change
+    int reason;                         // Constraint that propagated it, CP_DECISION or CP_REFUTATION
+    int antecedent;                     // Entry that fixed the bound through a difference row, -1 if none
+    int num_antecedents;                // Number of decisions that caused a refutation
+    int *antecedents;                   // Entries of the decisions that caused a refutation
+}CPTrailEntry;
+
+/**
+ Types of the decisions of the search, every one is refuted with the next one
+ */
+typedef enum CPDecisionType {
+    cp_lower_decision,                  // The variable is at least the value
+    cp_upper_decision,                  // The variable is at most the value
+    cp_choose_decision,                 // The disjunction only keeps the row of the value
+    cp_exclude_decision                 // The disjunction excludes the row of the value
+}CPDecisionType;
+
+/**
+ Decision of the search
+ */
+typedef struct CPDecision {
+    CPDecisionType type;
+    int index;                          // Variable or constraint
+    long long int value;                // Bound or row
+}CPDecision;
+
+/**
+ Result of a search of the engine
+ */
+typedef enum CPSearchResult {
+    cp_infeasible,                      // There is no solution
+    cp_feasible,                        // A solution was found
+    cp_failure_limit,                   // The search failed too many times before knowing it
+    cp_time_limit                       // The time limit was reached before knowing it
+}CPSearchResult;
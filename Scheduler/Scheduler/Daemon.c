@@ -0,0 +1,956 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Daemon.c                                                                                                           *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 18/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Scheduler.h"
+#include "Daemon.h"
+
+/* VARIABLES */
+
+NetworkProcess *network_processes = NULL;   // Processes with the networks kept in memory
+int num_network_processes = 0;              // Number of networks kept in memory
+DaemonClient *clients = NULL;               // Clients whose requests are being received
+int num_clients = 0;                        // Number of clients whose requests are being received
+long long int num_requests_served = 0;      // Number of requests received since the daemon started
+volatile sig_atomic_t daemon_running = 1;   // 0 once the daemon has to stop
+
+/* PRIVATE FUNCTIONS */
+
+/**
+ Stop the daemon when it receives a signal to finish
+
+ @param signal_number number of the signal received
+ */
+void stop_daemon(int signal_number) {
+    
+    (void) signal_number;
+    daemon_running = 0;
+}
+
+/**
+ Hash the bytes of a network xml with FNV-1a, to know if the network is already in memory
+
+ @param network bytes of the network xml
+ @param size number of bytes
+ @return hash of the network
+ */
+unsigned long long int hash_network(char *network, long long int size) {
+    
+    unsigned long long int hash = 14695981039346656037ULL;
+    
+    for (long long int byte_it = 0; byte_it < size; byte_it++) {
+        hash ^= (unsigned char) network[byte_it];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ Write the given bytes in a new temporary file, as the parsers of the scheduler read files
+
+ @param data bytes to write, NULL to create an empty file
+ @param size number of bytes
+ @param filename template of the name of the file, replaced with the name of the file created
+ @return 0 if done correctly, error code otherwise
+ */
+int write_temporary_file(char *data, long long int size, char *filename) {
+    
+    int file;
+    
+    file = mkstemp(filename);
+    if (file < 0) {
+        printf("Error creating a temporary file\n");
+        return ERROR_STARTING_NETWORK;
+    }
+    if (data != NULL && write_pipe(file, data, size) < 0) {
+        printf("Error writing a temporary file\n");
+        close(file);
+        unlink(filename);
+        return ERROR_STARTING_NETWORK;
+    }
+    close(file);
+    return 0;
+}
+
+/**
+ Read all the bytes of a file
+
+ @param filename name of the file
+ @param size pointer to save the number of bytes read
+ @return bytes of the file that have to be freed, NULL if the file cannot be read
+ */
+char * read_file(char *filename, long long int *size) {
+    
+    FILE *file;
+    char *data;
+    
+    file = fopen(filename, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    *size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    data = malloc(*size + 1);
+    if (fread(data, 1, *size, file) != (size_t) *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    return data;
+}
+
+/**
+ Send the response of a request to the client
+
+ @param client socket of the client
+ @param done 1 if the request was done, 0 if there was an error
+ @param data bytes of the response
+ @param size number of bytes
+ @return 0 if done correctly, error code otherwise
+ */
+int send_response(int client, int done, char *data, long long int size) {
+    
+    char line[DAEMON_MAX_HEADER];
+    
+    sprintf(line, "%s %lld\n", done == 1 ? "ok" : "error", size);
+    if (write_pipe(client, line, strlen(line)) < 0 || write_pipe(client, data, size) < 0) {
+        return ERROR_SENDING_REQUEST;
+    }
+    return 0;
+}
+
+/**
+ Send an error as the response of a request to the client
+
+ @param client socket of the client
+ @param message text of the error
+ @return 0 if done correctly, error code otherwise
+ */
+int send_error(int client, char *message) {
+    
+    return send_response(client, 0, message, strlen(message));
+}
+
+/**
+ Send a request to the process of its network. The socket of the client is passed to the process, so the response is
+ sent directly from the process that solves it
+
+ @param channel socket of the process of the network
+ @param command command of the request
+ @param configuration bytes of the schedule configuration xml
+ @param size number of bytes of the configuration
+ @param client socket of the client
+ @return 0 if done correctly, error code otherwise
+ */
+int send_client(int channel, DaemonCommand command, char *configuration, long long int size, int client) {
+    
+    struct msghdr message;
+    struct iovec vector;
+    struct cmsghdr *control_pt;
+    char control[CMSG_SPACE(sizeof(int))];
+    long long int header[2];            // Command and size of the configuration
+    
+    header[0] = command;
+    header[1] = size;
+    memset(&message, 0, sizeof(message));
+    memset(control, 0, sizeof(control));
+    vector.iov_base = header;
+    vector.iov_len = sizeof(header);
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    control_pt = CMSG_FIRSTHDR(&message);
+    control_pt->cmsg_level = SOL_SOCKET;
+    control_pt->cmsg_type = SCM_RIGHTS;
+    control_pt->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(control_pt), &client, sizeof(int));
+    
+    if (sendmsg(channel, &message, 0) != sizeof(header) || write_pipe(channel, configuration, size) < 0) {
+        return ERROR_SENDING_REQUEST;
+    }
+    return 0;
+}
+
+/**
+ Receive a request in the process of its network
+
+ @param channel socket of the process of the network
+ @param command pointer to save the command of the request
+ @param configuration pointer to save the bytes of the schedule configuration xml, they have to be freed
+ @param size pointer to save the number of bytes of the configuration
+ @param client pointer to save the socket of the client
+ @return 0 if done correctly, error code if the daemon closed the channel
+ */
+int receive_client(int channel, DaemonCommand *command, char **configuration, long long int *size, int *client) {
+    
+    struct msghdr message;
+    struct iovec vector;
+    struct cmsghdr *control_pt;
+    char control[CMSG_SPACE(sizeof(int))];
+    long long int header[2];            // Command and size of the configuration
+    ssize_t received;
+    
+    memset(&message, 0, sizeof(message));
+    vector.iov_base = header;
+    vector.iov_len = sizeof(header);
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    received = recvmsg(channel, &message, 0);
+    control_pt = CMSG_FIRSTHDR(&message);
+    if (received <= 0 || control_pt == NULL || control_pt->cmsg_type != SCM_RIGHTS) {
+        return ERROR_READING_REQUEST;
+    }
+    memcpy(client, CMSG_DATA(control_pt), sizeof(int));
+    // The stream can split the header, the rest of it comes without the socket
+    if (received < (ssize_t) sizeof(header) &&
+        read_pipe(channel, (char*) header + received, sizeof(header) - received) < 0) {
+        close(*client);
+        return ERROR_READING_REQUEST;
+    }
+    *command = (DaemonCommand) header[0];
+    *size = header[1];
+    *configuration = malloc(*size + 1);
+    if (read_pipe(channel, *configuration, *size) < 0) {
+        free(*configuration);
+        close(*client);
+        return ERROR_READING_REQUEST;
+    }
+    return 0;
+}
+
+/**
+ Schedule the network prepared and send the schedule xml to the client
+
+ @param client socket of the client
+ */
+void answer_schedule(int client) {
+    
+    char schedule_file[] = DAEMON_TEMPORARY_FILE;
+    char *schedule;
+    long long int size;
+    
+    // The pareto front writes a file for every point, the response only has one schedule
+    if (get_schedule_mode() == pareto_mode) {
+        send_error(client, "The pareto mode is not supported by the daemon\n");
+        return;
+    }
+    if (write_temporary_file(NULL, 0, schedule_file) < 0) {
+        send_error(client, "Error creating the schedule file\n");
+        return;
+    }
+    if (solve_network(schedule_file) < 0) {
+        send_error(client, "No schedule was found\n");
+    } else if ((schedule = read_file(schedule_file, &size)) == NULL) {
+        send_error(client, "Error reading the schedule file\n");
+    } else {
+        send_response(client, 1, schedule, size);
+        free(schedule);
+    }
+    unlink(schedule_file);
+}
+
+/**
+ Check the network prepared without solving it and send a report to the client
+
+ @param client socket of the client
+ */
+void answer_validation(int client) {
+    
+    char report[DAEMON_MAX_HEADER * 2];
+    int valid;
+    
+    valid = validate_network();
+    sprintf(report, "%s\nframes %d\nlinks %d\nhyperperiod %lld\nutilization %f\n", valid == 0 ? "valid" : "not valid",
+            get_num_frames(), get_num_links(), get_hyper_period(), get_max_link_utilization());
+    send_response(client, 1, report, strlen(report));
+}
+
+/**
+ Schedule the largest subset of frames of the network prepared and send to the client the number of frames admitted
+ and the rejected ones
+
+ @param client socket of the client
+ */
+void answer_admission(int client) {
+    
+    char schedule_file[] = DAEMON_TEMPORARY_FILE;
+    char *report;
+    int length, num_admitted = 0;
+    
+    if (write_temporary_file(NULL, 0, schedule_file) < 0) {
+        send_error(client, "Error creating the schedule file\n");
+        return;
+    }
+    set_schedule_mode(subset_mode);
+    if (solve_network(schedule_file) < 0) {
+        send_error(client, "The frames could not be admitted\n");
+        unlink(schedule_file);
+        return;
+    }
+    unlink(schedule_file);
+    
+    report = malloc(DAEMON_MAX_HEADER + 12 * get_num_frames());
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        if (get_rejected(get_frame(frame_it)) == 0) {
+            num_admitted++;
+        }
+    }
+    length = sprintf(report, "admitted %d of %d\nrejected", num_admitted, get_num_frames());
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        if (get_rejected(get_frame(frame_it)) == 1) {
+            length += sprintf(&report[length], " %d", frame_it);
+        }
+    }
+    length += sprintf(&report[length], "\n");
+    send_response(client, 1, report, length);
+    free(report);
+}
+
+/**
+ Answer a request in the process forked from the one of its network, that has the network parsed
+
+ @param command command of the request
+ @param configuration bytes of the schedule configuration xml
+ @param size number of bytes of the configuration
+ @param client socket of the client
+ */
+void answer_request(DaemonCommand command, char *configuration, long long int size, int client) {
+    
+    char configuration_file[] = DAEMON_TEMPORARY_FILE;
+    int result;
+    
+    if (write_temporary_file(configuration, size, configuration_file) < 0) {
+        send_error(client, "Error saving the schedule configuration\n");
+        return;
+    }
+    result = prepare_network(configuration_file);
+    unlink(configuration_file);
+    if (result < 0) {
+        send_error(client, "Error reading the schedule configuration\n");
+        return;
+    }
+    
+    switch (command) {
+        case schedule_command:
+            answer_schedule(client);
+            break;
+        case validate_command:
+            answer_validation(client);
+            break;
+        case admission_command:
+            answer_admission(client);
+            break;
+        default:
+            send_error(client, "Command not recognized\n");
+            break;
+    }
+}
+
+/**
+ Wait the processes of the requests that finished and send one byte to the daemon for every one of them, so the daemon
+ frees their workers even if they stopped before answering
+
+ @param channel socket of the daemon
+ @param request_pids processes of the requests being solved, the finished ones are removed
+ @param num_requests number of requests being solved
+ @return number of requests still being solved
+ */
+int reap_requests(int channel, pid_t *request_pids, int num_requests) {
+    
+    char finished = 1;
+    int status;
+    
+    for (int request_it = num_requests - 1; request_it >= 0; request_it--) {
+        if (waitpid(request_pids[request_it], &status, WNOHANG) == request_pids[request_it]) {
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+                printf("The process of a request stopped before finishing\n");
+            }
+            write_pipe(channel, &finished, 1);
+            num_requests--;
+            request_pids[request_it] = request_pids[num_requests];
+        }
+    }
+    return num_requests;
+}
+
+/**
+ Parse a network and keep it in memory answering its requests until the daemon closes the channel. Every request is
+ answered in a process forked from this one, so the parsed network is never modified. The processes of the requests
+ are waited here, and one byte is sent to the daemon for every one that finishes
+
+ @param channel socket of the daemon
+ @param network_file name of the file with the network xml, removed once it is parsed
+ */
+void serve_network(int channel, char *network_file) {
+    
+    struct pollfd polled;
+    DaemonCommand command;
+    char *configuration;
+    long long int size;
+    int client, status;
+    pid_t solver_pid;
+    pid_t *request_pids = NULL;                 // Processes of the requests being solved
+    int num_requests = 0, requests_capacity = 0;
+    char finished = 1;
+    
+    status = parse_network_xml(network_file) < 0 ? ERROR_STARTING_NETWORK : 0;
+    unlink(network_file);
+    // The configurations come from the clients, they cannot load libraries or write files in the machine
+    set_restricted_configuration(1);
+    if (write_pipe(channel, &status, sizeof(int)) < 0 || status < 0) {
+        return;
+    }
+    
+    polled.fd = channel;
+    polled.events = POLLIN;
+    while (1) {
+        // The requests that finished are checked every interval, as no signal interrupts the reads of the channel
+        num_requests = reap_requests(channel, request_pids, num_requests);
+        polled.revents = 0;
+        if (poll(&polled, 1, DAEMON_REAP_INTERVAL) <= 0) {
+            continue;
+        }
+        if (receive_client(channel, &command, &configuration, &size, &client) < 0) {
+            break;
+        }
+        // The children inherit the buffer of the standard output, it has to be empty before forking
+        fflush(stdout);
+        solver_pid = fork();
+        if (solver_pid == 0) {
+            close(channel);
+            answer_request(command, configuration, size, client);
+            close(client);
+            fflush(stdout);
+            _exit(0);
+        }
+        if (solver_pid < 0) {
+            send_error(client, "Error creating the process of the request\n");
+            write_pipe(channel, &finished, 1);
+        } else {
+            if (num_requests == requests_capacity) {
+                requests_capacity = requests_capacity == 0 ? 16 : requests_capacity * 2;
+                request_pids = realloc(request_pids, sizeof(pid_t) * requests_capacity);
+            }
+            request_pids[num_requests] = solver_pid;
+            num_requests++;
+        }
+        close(client);
+        free(configuration);
+    }
+    
+    // The daemon closed the channel, the requests being solved still send their responses
+    for (int request_it = 0; request_it < num_requests; request_it++) {
+        waitpid(request_pids[request_it], NULL, 0);
+    }
+    free(request_pids);
+}
+
+/**
+ Start the process that keeps a new network in memory. The network is parsed in the background, the process sends
+ its status through its channel once it is done
+
+ @param network bytes of the network xml, kept by the process if it is started
+ @param size number of bytes
+ @param hash hash of the network
+ @param listen_socket socket where the daemon listens, closed in the process of the network
+ @return position of the process of the network, error code if it could not be started
+ */
+int start_network_process(char *network, long long int size, unsigned long long int hash, int listen_socket) {
+    
+    NetworkProcess *process_pt;
+    char network_file[] = DAEMON_TEMPORARY_FILE;
+    int channels[2];
+    
+    if (write_temporary_file(network, size, network_file) < 0) {
+        return ERROR_STARTING_NETWORK;
+    }
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, channels) < 0) {
+        printf("Error creating the channel of the network\n");
+        unlink(network_file);
+        return ERROR_STARTING_NETWORK;
+    }
+    
+    fflush(stdout);
+    process_pt = &network_processes[num_network_processes];
+    process_pt->pid = fork();
+    if (process_pt->pid == 0) {
+        // The process only keeps its own channel, so it knows when the daemon closes it
+        close(channels[0]);
+        close(listen_socket);
+        for (int client_it = 0; client_it < num_clients; client_it++) {
+            close(clients[client_it].socket);
+        }
+        for (int process_it = 0; process_it < num_network_processes; process_it++) {
+            close(network_processes[process_it].channel);
+        }
+        serve_network(channels[1], network_file);
+        close(channels[1]);
+        fflush(stdout);
+        _exit(0);
+    }
+    close(channels[1]);
+    if (process_pt->pid < 0) {
+        printf("Error starting the process of the network\n");
+        close(channels[0]);
+        unlink(network_file);
+        return ERROR_STARTING_NETWORK;
+    }
+    
+    process_pt->channel = channels[0];
+    process_pt->started = 0;
+    process_pt->hash = hash;
+    process_pt->size = size;
+    process_pt->network = network;
+    process_pt->num_requests = 0;
+    process_pt->last_used = 0;
+    num_network_processes++;
+    return num_network_processes - 1;
+}
+
+/**
+ Stop the process of a network and remove it from the networks in memory
+
+ @param process_it position of the process of the network
+ */
+void stop_network_process(int process_it) {
+    
+    close(network_processes[process_it].channel);
+    waitpid(network_processes[process_it].pid, NULL, 0);
+    free(network_processes[process_it].network);
+    num_network_processes--;
+    network_processes[process_it] = network_processes[num_network_processes];
+}
+
+/**
+ Find the process with the given network in memory. If the network is not in memory, it is parsed in a new process,
+ and the least recently used network without requests is removed if there are too many networks
+
+ @param network bytes of the network xml, kept by the process if a new one is started
+ @param size number of bytes
+ @param listen_socket socket where the daemon listens
+ @param num_networks maximum number of networks kept in memory
+ @return position of the process of the network, error code otherwise
+ */
+int find_network_process(char *network, long long int size, int listen_socket, int num_networks) {
+    
+    NetworkProcess *process_pt;
+    unsigned long long int hash;
+    int evicted = -1;
+    
+    hash = hash_network(network, size);
+    for (int process_it = 0; process_it < num_network_processes; process_it++) {
+        process_pt = &network_processes[process_it];
+        // The hash only discards the different networks quickly, the bytes decide
+        if (process_pt->hash == hash && process_pt->size == size && memcmp(process_pt->network, network, size) == 0) {
+            return process_it;
+        }
+    }
+    
+    if (num_network_processes == num_networks) {
+        for (int process_it = 0; process_it < num_network_processes; process_it++) {
+            process_pt = &network_processes[process_it];
+            if (process_pt->started == 1 && process_pt->num_requests == 0 &&
+                (evicted < 0 || process_pt->last_used < network_processes[evicted].last_used)) {
+                evicted = process_it;
+            }
+        }
+        if (evicted < 0) {
+            return ERROR_STARTING_NETWORK;
+        }
+        stop_network_process(evicted);
+    }
+    return start_network_process(network, size, hash, listen_socket);
+}
+
+/**
+ Close the socket of a client and remove it from the clients whose requests are being received
+
+ @param client_it position of the client
+ */
+void close_client(int client_it) {
+    
+    close(clients[client_it].socket);
+    free(clients[client_it].network);
+    free(clients[client_it].configuration);
+    num_clients--;
+    clients[client_it] = clients[num_clients];
+}
+
+/**
+ Send an error to a client and remove it from the clients whose requests are being received
+
+ @param client_it position of the client
+ @param message text of the error
+ */
+void drop_client(int client_it, char *message) {
+    
+    send_error(clients[client_it].socket, message);
+    close_client(client_it);
+}
+
+/**
+ Send the request of a client to the process of its network, which answers it directly, and remove the client
+
+ @param client_it position of the client
+ @param process_it position of the process of its network, that already parsed it
+ */
+void forward_client(int client_it, int process_it) {
+    
+    DaemonClient *client_pt = &clients[client_it];
+    NetworkProcess *process_pt = &network_processes[process_it];
+    
+    if (send_client(process_pt->channel, client_pt->command, client_pt->configuration, client_pt->configuration_size,
+                    client_pt->socket) < 0) {
+        send_error(client_pt->socket, "Error sending the request to the process of the network\n");
+    } else {
+        num_requests_served++;
+        process_pt->num_requests++;
+        process_pt->last_used = num_requests_served;
+    }
+    close_client(client_it);
+}
+
+/**
+ Find the process of the network of a client that was received completely. The request is sent to the process if its
+ network is parsed, otherwise the client waits until it is
+
+ @param client_it position of the client
+ @param listen_socket socket where the daemon listens
+ @param num_networks maximum number of networks kept in memory
+ */
+void dispatch_client(int client_it, int listen_socket, int num_networks) {
+    
+    DaemonClient *client_pt = &clients[client_it];
+    int process_it;
+    
+    process_it = find_network_process(client_pt->network, client_pt->network_size, listen_socket, num_networks);
+    if (process_it < 0) {
+        drop_client(client_it, "Error starting the process of the network\n");
+        return;
+    }
+    // A new process keeps the bytes of its network to compare them with the next requests
+    if (network_processes[process_it].network == client_pt->network) {
+        client_pt->network = NULL;
+    }
+    client_pt->state = waiting_state;
+    client_pt->network_pid = network_processes[process_it].pid;
+    if (network_processes[process_it].started == 1) {
+        forward_client(client_it, process_it);
+    }
+}
+
+/**
+ Read the header of the request of a client, and prepare the arrays where the network and the configuration are saved
+
+ @param client_it position of the client, removed if the header is wrong
+ */
+void read_client_header(int client_it) {
+    
+    DaemonClient *client_pt = &clients[client_it];
+    char command_name[DAEMON_MAX_HEADER];
+    
+    if (sscanf(client_pt->header, "%s %lld %lld", command_name, &client_pt->network_size,
+               &client_pt->configuration_size) != 3 ||
+        client_pt->network_size <= 0 || client_pt->network_size > DAEMON_MAX_PAYLOAD ||
+        client_pt->configuration_size <= 0 || client_pt->configuration_size > DAEMON_MAX_PAYLOAD) {
+        drop_client(client_it, "The header of the request is wrongly constructed\n");
+        return;
+    }
+    if (strcmp(command_name, "schedule") == 0) {
+        client_pt->command = schedule_command;
+    } else if (strcmp(command_name, "validate") == 0) {
+        client_pt->command = validate_command;
+    } else if (strcmp(command_name, "admission") == 0) {
+        client_pt->command = admission_command;
+    } else {
+        drop_client(client_it, "Command not recognized\n");
+        return;
+    }
+    client_pt->network = malloc(client_pt->network_size + 1);
+    client_pt->configuration = malloc(client_pt->configuration_size + 1);
+    client_pt->received = 0;
+    client_pt->state = payload_state;
+}
+
+/**
+ Receive the bytes that a client sent, without waiting for more. Once the request is received completely, it is sent
+ to the process of its network
+
+ @param client_it position of the client
+ @param listen_socket socket where the daemon listens
+ @param num_networks maximum number of networks kept in memory
+ */
+void read_client(int client_it, int listen_socket, int num_networks) {
+    
+    DaemonClient *client_pt = &clients[client_it];
+    long long int remaining;
+    ssize_t received;
+    
+    client_pt->deadline = time(NULL) + DAEMON_READ_TIMEOUT;
+    if (client_pt->state == header_state) {
+        // The header is read byte by byte, so the bytes of the network are never read with it
+        received = read(client_pt->socket, &client_pt->header[client_pt->header_size], 1);
+        if (received <= 0) {
+            close_client(client_it);
+        } else if (client_pt->header[client_pt->header_size] == '\n') {
+            client_pt->header[client_pt->header_size] = '\0';
+            read_client_header(client_it);
+        } else if (++client_pt->header_size == DAEMON_MAX_HEADER - 1) {
+            drop_client(client_it, "The header of the request is wrongly constructed\n");
+        }
+        return;
+    }
+    
+    // The network and the configuration are read as they arrive, one after the other
+    if (client_pt->received < client_pt->network_size) {
+        remaining = client_pt->network_size - client_pt->received;
+        received = read(client_pt->socket, &client_pt->network[client_pt->received], remaining);
+    } else {
+        remaining = client_pt->network_size + client_pt->configuration_size - client_pt->received;
+        received = read(client_pt->socket, &client_pt->configuration[client_pt->received - client_pt->network_size],
+                        remaining);
+    }
+    if (received <= 0) {
+        drop_client(client_it, "The request was not received completely\n");
+        return;
+    }
+    client_pt->received += received;
+    if (client_pt->received == client_pt->network_size + client_pt->configuration_size) {
+        dispatch_client(client_it, listen_socket, num_networks);
+    }
+}
+
+/**
+ Receive the status of a network that was being parsed, and send it the requests of the clients waiting for it. If
+ the network could not be parsed, the clients receive an error and its process is removed
+
+ @param process_it position of the process of the network
+ */
+void receive_started(int process_it) {
+    
+    NetworkProcess *process_pt = &network_processes[process_it];
+    int status;
+    
+    if (read_pipe(process_pt->channel, &status, sizeof(int)) < 0) {
+        status = ERROR_STARTING_NETWORK;
+    }
+    process_pt->started = 1;
+    // From the last one, as a client removed is replaced by the last one
+    for (int client_it = num_clients - 1; client_it >= 0; client_it--) {
+        if (clients[client_it].state == waiting_state && clients[client_it].network_pid == process_pt->pid) {
+            if (status < 0) {
+                drop_client(client_it, "Error parsing the network\n");
+            } else {
+                forward_client(client_it, process_it);
+            }
+        }
+    }
+    if (status < 0) {
+        printf("Error parsing the network of a request\n");
+        stop_network_process(process_it);
+    }
+}
+
+/**
+ Receive the requests of a network that finished. If the process of the network stopped, it is removed
+
+ @param process_it position of the process of the network
+ */
+void receive_finished(int process_it) {
+    
+    char finished[100];
+    ssize_t received;
+    
+    if (network_processes[process_it].started == 0) {
+        receive_started(process_it);
+        return;
+    }
+    received = read(network_processes[process_it].channel, finished, sizeof(finished));
+    if (received > 0) {
+        network_processes[process_it].num_requests -= (int) received;
+        return;
+    }
+    if (received < 0 && errno == EINTR) {
+        return;
+    }
+    printf("The process of a network stopped, it is removed\n");
+    stop_network_process(process_it);
+}
+
+/**
+ Accept a new client, whose request is received as its bytes arrive
+
+ @param listen_socket socket where the daemon listens
+ */
+void accept_client(int listen_socket) {
+    
+    DaemonClient *client_pt;
+    int client;
+    
+    client = accept(listen_socket, NULL, NULL);
+    if (client < 0) {
+        return;
+    }
+    client_pt = &clients[num_clients];
+    memset(client_pt, 0, sizeof(DaemonClient));
+    client_pt->socket = client;
+    client_pt->state = header_state;
+    client_pt->deadline = time(NULL) + DAEMON_READ_TIMEOUT;
+    num_clients++;
+}
+
+/* PUBLIC FUNCTIONS */
+
+/**
+ Run the scheduler daemon until it receives SIGINT or SIGTERM. Every request is a line with the command (schedule,
+ validate or admission), the size of the network xml and the size of the schedule configuration xml separated by
+ spaces, followed by both files. The response is a line with ok or error and the size of the response, followed by
+ the response (the schedule xml or a text report)
+
+ @param socket_path path of the Unix-domain socket, a previous file there is removed
+ @param num_workers maximum number of requests solved at the same time, one per processor if it is 0
+ @param num_networks maximum number of networks kept in memory, DAEMON_DEFAULT_NETWORKS if it is 0
+ @return 0 if the daemon stopped correctly, error code otherwise
+ */
+int run_daemon(char *socket_path, int num_workers, int num_networks) {
+    
+    struct sockaddr_un address;
+    struct sigaction action;
+    struct pollfd *polled;
+    int listen_socket;
+    int num_polled, num_running, listen_it, num_processes_polled;
+    
+    if (num_workers <= 0) {
+        num_workers = (int) sysconf(_SC_NPROCESSORS_ONLN);
+        if (num_workers < 1) {
+            num_workers = 1;
+        }
+    }
+    if (num_networks <= 0) {
+        num_networks = DAEMON_DEFAULT_NETWORKS;
+    }
+    // With a network per worker there is always a network without requests that can be removed for a new one
+    if (num_networks < num_workers) {
+        num_networks = num_workers;
+    }
+    
+    if (strlen(socket_path) >= sizeof(address.sun_path)) {
+        printf("The path of the socket is too long\n");
+        return ERROR_CREATING_SOCKET;
+    }
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socket_path);
+    unlink(socket_path);
+    listen_socket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_socket < 0 || bind(listen_socket, (struct sockaddr*) &address, sizeof(address)) < 0 ||
+        listen(listen_socket, SOMAXCONN) < 0) {
+        printf("Error creating the socket %s\n", socket_path);
+        if (listen_socket >= 0) {
+            close(listen_socket);
+        }
+        return ERROR_CREATING_SOCKET;
+    }
+    
+    // The signals interrupt the wait of the daemon so it can stop, and a client that closes its socket early only
+    // makes its response fail
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = stop_daemon;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+    daemon_running = 1;
+    
+    network_processes = malloc(sizeof(NetworkProcess) * num_networks);
+    clients = malloc(sizeof(DaemonClient) * num_workers);
+    polled = malloc(sizeof(struct pollfd) * (num_networks + num_workers + 1));
+    printf("Listening in %s with %d workers and %d networks in memory\n", socket_path, num_workers, num_networks);
+    fflush(stdout);
+    
+    while (daemon_running == 1) {
+        // The requests only are accepted while there are free workers, the rest wait in the socket. The clients
+        // being received also take a worker, as their requests are solved next
+        num_running = num_clients;
+        for (int process_it = 0; process_it < num_network_processes; process_it++) {
+            polled[process_it].fd = network_processes[process_it].channel;
+            polled[process_it].events = POLLIN;
+            polled[process_it].revents = 0;
+            num_running += network_processes[process_it].num_requests;
+        }
+        num_processes_polled = num_network_processes;
+        num_polled = num_network_processes;
+        for (int client_it = 0; client_it < num_clients; client_it++) {
+            // The clients waiting for their network do not send more bytes
+            polled[num_polled].fd = clients[client_it].state == waiting_state ? -1 : clients[client_it].socket;
+            polled[num_polled].events = POLLIN;
+            polled[num_polled].revents = 0;
+            num_polled++;
+        }
+        listen_it = -1;
+        if (num_running < num_workers) {
+            listen_it = num_polled;
+            polled[listen_it].fd = listen_socket;
+            polled[listen_it].events = POLLIN;
+            polled[listen_it].revents = 0;
+            num_polled++;
+        }
+        if (poll(polled, num_polled, num_clients > 0 ? DAEMON_POLL_INTERVAL : -1) < 0) {
+            continue;
+        }
+        
+        // From the last one, as a process that stopped is replaced by the last one
+        for (int process_it = num_network_processes - 1; process_it >= 0; process_it--) {
+            if (polled[process_it].revents != 0) {
+                receive_finished(process_it);
+            }
+        }
+        // The clients are searched by their socket, as the previous ones could have been removed
+        for (int polled_it = num_processes_polled; polled_it < num_polled; polled_it++) {
+            if (polled_it == listen_it || polled[polled_it].fd < 0 || polled[polled_it].revents == 0) {
+                continue;
+            }
+            for (int client_it = 0; client_it < num_clients; client_it++) {
+                if (clients[client_it].socket == polled[polled_it].fd && clients[client_it].state != waiting_state) {
+                    read_client(client_it, listen_socket, num_networks);
+                    break;
+                }
+            }
+        }
+        for (int client_it = num_clients - 1; client_it >= 0; client_it--) {
+            if (clients[client_it].state != waiting_state && clients[client_it].deadline < time(NULL)) {
+                drop_client(client_it, "The request was not received in time\n");
+            }
+        }
+        if (listen_it >= 0 && (polled[listen_it].revents & POLLIN) != 0) {
+            accept_client(listen_socket);
+        }
+        fflush(stdout);
+    }
+    
+    printf("Stopping the daemon\n");
+    while (num_clients > 0) {
+        close_client(num_clients - 1);
+    }
+    while (num_network_processes > 0) {
+        stop_network_process(num_network_processes - 1);
+    }
+    close(listen_socket);
+    unlink(socket_path);
+    free(network_processes);
+    network_processes = NULL;
+    free(clients);
+    clients = NULL;
+    free(polled);
+    
+    return 0;
+}
@@ -0,0 +1,115 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Daemon.h                                                                                                           *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 18/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Package that contains the scheduler daemon. It listens in a Unix-domain socket and every network received is       *
+ *  parsed once in its own process, which stays alive with the network in memory. The next requests of the same        *
+ *  network are solved in a process forked from it, so they only read the configuration and solve. At most one request *
+ *  per worker is solved at the same time, the rest wait in the socket.                                                *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef Daemon_h
+#define Daemon_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <time.h>
+
+#endif /* Daemon_h */
+
+/* ERROR CODE DEFINITIONS */
+
+#define ERROR_CREATING_SOCKET -1
+#define ERROR_READING_REQUEST -2
+#define ERROR_STARTING_NETWORK -3
+#define ERROR_SENDING_REQUEST -4
+
+/* CODE DEFINITIONS */
+
+#define DAEMON_DEFAULT_NETWORKS 16          // Networks kept in memory if it is not configured
+#define DAEMON_MAX_PAYLOAD (1LL << 28)      // Largest network or configuration accepted in bytes
+#define DAEMON_MAX_HEADER 200               // Largest line of the header of a request
+#define DAEMON_READ_TIMEOUT 10              // Seconds waiting the bytes of a request before dropping it
+#define DAEMON_POLL_INTERVAL 1000           // Milliseconds between checks of the clients that stopped sending
+#define DAEMON_REAP_INTERVAL 100            // Milliseconds between checks of the requests finished in a network
+#define DAEMON_TEMPORARY_FILE "/tmp/organic_scheduler_XXXXXX"   // Template of the files given to the parsers
+
+/* STRUCT DEFINITIONS */
+
+/**
+ Commands that the daemon can answer
+ */
+typedef enum DaemonCommand {
+    schedule_command,                   // Schedule the network, the response is the schedule xml
+    validate_command,                   // Check the network without solving it, the response is a text report
+    admission_command                   // Schedule the largest subset of frames, the response lists the rejected ones
+}DaemonCommand;
+
+/**
+ State of a client of the daemon until its request is sent to the process of its network
+ */
+typedef enum ClientState {
+    header_state,                       // Receiving the line of the header
+    payload_state,                      // Receiving the network xml and the schedule configuration xml
+    waiting_state                       // Waiting until the process of its network parses it
+}ClientState;
+
+/**
+ Client whose request is being received. The daemon receives the bytes as they arrive, so a slow client or a network
+ being parsed never stops the rest of requests
+ */
+typedef struct DaemonClient {
+    int socket;                         // Socket of the client
+    ClientState state;                  // What the daemon is waiting from the client
+    time_t deadline;                    // Time when the client is dropped if no more bytes arrive
+    char header[DAEMON_MAX_HEADER];     // Line of the header received until now
+    int header_size;                    // Number of bytes of the header received
+    DaemonCommand command;              // Command of the request
+    char *network;                      // Bytes of the network xml, NULL once they are kept by its process
+    long long int network_size;         // Size of the network xml
+    char *configuration;                // Bytes of the schedule configuration xml
+    long long int configuration_size;   // Size of the schedule configuration xml
+    long long int received;             // Bytes of the network and the configuration received
+    pid_t network_pid;                  // Process of its network when it is waiting
+}DaemonClient;
+
+/**
+ Process that keeps a parsed network in memory
+ */
+typedef struct NetworkProcess {
+    pid_t pid;                          // Process with the network
+    int channel;                        // Socket to send it the requests and receive when they finish
+    int started;                        // 1 once the network is parsed, 0 while the process is parsing it
+    unsigned long long int hash;        // Hash of the network xml
+    long long int size;                 // Size of the network xml
+    char *network;                      // Bytes of the network xml, to tell apart networks with the same hash
+    int num_requests;                   // Requests of the network being solved
+    long long int last_used;            // Number of the last request of the network, to evict the least used one
+}NetworkProcess;
+
+/**
+ Run the scheduler daemon until it receives SIGINT or SIGTERM. Every request is a line with the command (schedule,
+ validate or admission), the size of the network xml and the size of the schedule configuration xml separated by
+ spaces, followed by both files. The response is a line with ok or error and the size of the response, followed by
+ the response (the schedule xml or a text report)
+
+ @param socket_path path of the Unix-domain socket, a previous file there is removed
+ @param num_workers maximum number of requests solved at the same time, one per processor if it is 0
+ @param num_networks maximum number of networks kept in memory, DAEMON_DEFAULT_NETWORKS if it is 0
+ @return 0 if the daemon stopped correctly, error code otherwise
+ */
+int run_daemon(char *socket_path, int num_workers, int num_networks);
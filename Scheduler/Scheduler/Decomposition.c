@@ -0,0 +1,318 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Decomposition.c                                                                                                    *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Description in Decomposition.h                                                                                     *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Decomposition.h"
+#include "Network.h"
+
+/* VARIABLES */
+
+#define ROUTING_CAPACITY 1000000            // Capacity of a link in the master, utilizations are in parts per million
+
+Z3_context routing_context = NULL;          // Context of the master problem, independent of the scheduler one
+Z3_solver routing_solver;                   // Solver of the master problem, it keeps the cuts between iterations
+Z3_ast ***routing_selectors = NULL;         // Selector of every path of every receiver of every frame
+
+/* PRIVATE FUNCTIONS */
+
+/**
+ Find the group of the given frame, compressing the path to it on the way
+
+ @param parent parent of every frame in the groups
+ @param frame_id identifier of the frame
+ @return identifier of the frame that represents the group
+ */
+int find_routing_component(int *parent, int frame_id) {
+    
+    while (parent[frame_id] != frame_id) {
+        parent[frame_id] = parent[parent[frame_id]];
+        frame_id = parent[frame_id];
+    }
+    return frame_id;
+}
+
+/* PUBLIC FUNCTIONS */
+
+/**
+ Create the master problem with one boolean selector for every path of every receiver of every frame. Every receiver
+ uses exactly one path, and the utilization of the frames that use a link cannot exceed its capacity.
+ Every frame counts once in a link, even if several of its receivers use it
+
+ @return 0 if done correctly, error code otherwise
+ */
+int init_routing_master(void) {
+    
+    Z3_config configuration;
+    Frame *frame_pt;
+    Path *path_pt;
+    Z3_ast **link_users;                    // Literals of the frames that use every link
+    int **link_weights;                     // Utilization in parts per million of every frame that uses every link
+    int *num_link_users;                    // Number of frames that can use every link
+    Z3_ast *frame_link_used;                // Literal of every link used by the current frame, NULL if it cannot
+    int sender, receiver, num_paths, link;
+    char name[100];
+    
+    free_routing_master();
+    configuration = Z3_mk_config();
+    routing_context = Z3_mk_context(configuration);
+    Z3_del_config(configuration);
+    routing_solver = Z3_mk_solver(routing_context);
+    Z3_solver_inc_ref(routing_context, routing_solver);
+    
+    link_users = malloc(sizeof(Z3_ast *) * get_num_links());
+    link_weights = malloc(sizeof(int *) * get_num_links());
+    num_link_users = calloc(get_num_links(), sizeof(int));
+    frame_link_used = malloc(sizeof(Z3_ast) * get_num_links());
+    for (int link_it = 0; link_it < get_num_links(); link_it++) {
+        link_users[link_it] = malloc(sizeof(Z3_ast) * get_num_frames());
+        link_weights[link_it] = malloc(sizeof(int) * get_num_frames());
+    }
+    
+    routing_selectors = calloc(get_num_frames(), sizeof(Z3_ast **));
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        sender = get_sender_id(frame_pt);
+        routing_selectors[frame_it] = calloc(get_num_receivers(frame_pt), sizeof(Z3_ast *));
+        for (int link_it = 0; link_it < get_num_links(); link_it++) {
+            frame_link_used[link_it] = NULL;
+        }
+        for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+            receiver = get_receiver_id(frame_pt, receiver_it);
+            num_paths = get_num_paths(sender, receiver);
+            if (num_paths <= 0) {
+                printf("There is no path between the sender and the receiver of the frame %d\n", frame_it);
+                return NO_ROUTING_MASTER;
+            }
+            routing_selectors[frame_it][receiver_it] = malloc(sizeof(Z3_ast) * num_paths);
+            for (int path_it = 0; path_it < num_paths; path_it++) {
+                sprintf(name, "R_%d_%d_%d", frame_it, receiver_it, path_it);
+                routing_selectors[frame_it][receiver_it][path_it] =
+                    Z3_mk_const(routing_context, Z3_mk_string_symbol(routing_context, name),
+                                Z3_mk_bool_sort(routing_context));
+                // A path uses all its links, the literal of a link is only forced true by the paths
+                path_pt = get_path(sender, receiver, path_it);
+                for (int link_it = 0; link_it < path_pt->length; link_it++) {
+                    link = path_pt->path[link_it];
+                    if (frame_link_used[link] == NULL) {
+                        sprintf(name, "L_%d_%d", frame_it, link);
+                        frame_link_used[link] = Z3_mk_const(routing_context,
+                                                            Z3_mk_string_symbol(routing_context, name),
+                                                            Z3_mk_bool_sort(routing_context));
+                        link_users[link][num_link_users[link]] = frame_link_used[link];
+                        link_weights[link][num_link_users[link]] =
+                            (int) ceil(get_frame_link_utilization(frame_pt, link) * ROUTING_CAPACITY);
+                        num_link_users[link]++;
+                    }
+                    Z3_solver_assert(routing_context, routing_solver,
+                                     Z3_mk_implies(routing_context, routing_selectors[frame_it][receiver_it][path_it],
+                                                   frame_link_used[link]));
+                }
+            }
+            // Exactly one path for every receiver
+            Z3_solver_assert(routing_context, routing_solver,
+                             Z3_mk_or(routing_context, num_paths, routing_selectors[frame_it][receiver_it]));
+            if (num_paths > 1) {
+                Z3_solver_assert(routing_context, routing_solver,
+                                 Z3_mk_atmost(routing_context, num_paths, routing_selectors[frame_it][receiver_it], 1));
+            }
+        }
+    }
+    
+    // The frames that use a link cannot exceed its capacity
+    for (int link_it = 0; link_it < get_num_links(); link_it++) {
+        if (num_link_users[link_it] > 0) {
+            Z3_solver_assert(routing_context, routing_solver,
+                             Z3_mk_pble(routing_context, num_link_users[link_it], link_users[link_it],
+                                        link_weights[link_it], ROUTING_CAPACITY));
+        }
+        free(link_users[link_it]);
+        free(link_weights[link_it]);
+    }
+    free(link_users);
+    free(link_weights);
+    free(num_link_users);
+    free(frame_link_used);
+    
+    return 0;
+}
+
+/**
+ Solve the master problem and route every receiver of every frame through the path chosen
+
+ @return 1 if a routing was found, 0 if there is no routing left, error code otherwise
+ */
+int solve_routing_master(void) {
+    
+    Frame *frame_pt;
+    Z3_model model;
+    Z3_ast value;
+    int num_paths;
+    
+    if (routing_context == NULL) {
+        return NO_ROUTING_MASTER;
+    }
+    if (Z3_solver_check(routing_context, routing_solver) != Z3_L_TRUE) {
+        return 0;
+    }
+    
+    model = Z3_solver_get_model(routing_context, routing_solver);
+    Z3_model_inc_ref(routing_context, model);
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+            num_paths = get_num_paths(get_sender_id(frame_pt), get_receiver_id(frame_pt, receiver_it));
+            for (int path_it = 0; path_it < num_paths; path_it++) {
+                if (Z3_model_eval(routing_context, model, routing_selectors[frame_it][receiver_it][path_it], Z3_TRUE,
+                                  &value) == Z3_TRUE && Z3_get_bool_value(routing_context, value) == Z3_L_TRUE) {
+                    set_routed_path(frame_pt, receiver_it, path_it);
+                    break;
+                }
+            }
+        }
+    }
+    Z3_model_dec_ref(routing_context, model);
+    
+    return 1;
+}
+
+/**
+ Add a no-good cut to the master problem, so the given frames cannot be routed again through their current paths at
+ the same time. The frames should be a minimal set that cannot be scheduled together. A cut without frames would
+ make the master infeasible, so it is an error
+
+ @param conflict_frames array with the identifiers of the frames in conflict
+ @param num_conflict_frames number of frames in conflict
+ @return 0 if done correctly, error code otherwise
+ */
+int add_routing_cut(int *conflict_frames, int num_conflict_frames) {
+    
+    Frame *frame_pt;
+    Z3_ast *literals;
+    int num_literals = 0;
+    
+    if (routing_context == NULL) {
+        return NO_ROUTING_MASTER;
+    }
+    if (num_conflict_frames <= 0) {
+        printf("The routing cut has no frames\n");
+        return EMPTY_ROUTING_CUT;
+    }
+    
+    for (int conflict_it = 0; conflict_it < num_conflict_frames; conflict_it++) {
+        if (conflict_frames[conflict_it] < 0 || conflict_frames[conflict_it] >= get_num_frames()) {
+            return CUT_FRAME_OUT_OF_RANGE;
+        }
+        num_literals += get_num_receivers(get_frame(conflict_frames[conflict_it]));
+    }
+    literals = malloc(sizeof(Z3_ast) * num_literals);
+    num_literals = 0;
+    for (int conflict_it = 0; conflict_it < num_conflict_frames; conflict_it++) {
+        frame_pt = get_frame(conflict_frames[conflict_it]);
+        for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+            literals[num_literals] = Z3_mk_not(routing_context, routing_selectors[conflict_frames[conflict_it]]
+                                               [receiver_it][get_routed_path(frame_pt, receiver_it)]);
+            num_literals++;
+        }
+    }
+    Z3_solver_assert(routing_context, routing_solver, Z3_mk_or(routing_context, num_literals, literals));
+    free(literals);
+    
+    return 0;
+}
+
+/**
+ Group the frames that share links in their current routing. Frames of different groups do not share any link, so
+ every group can be scheduled independently
+
+ @param components array to save the group of every frame, from 0 to the number of groups
+ @return number of groups
+ */
+int get_routing_components(int *components) {
+    
+    Frame *frame_pt;
+    Path *path_pt;
+    int *parent;                            // Parent of every frame in the groups
+    int *link_frame;                        // First frame that uses every link, -1 if none
+    int *group;                             // Group of every frame that represents one
+    int link, root1, root2;
+    int num_components = 0;
+    
+    parent = malloc(sizeof(int) * get_num_frames());
+    group = malloc(sizeof(int) * get_num_frames());
+    link_frame = malloc(sizeof(int) * get_num_links());
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        parent[frame_it] = frame_it;
+        group[frame_it] = -1;
+    }
+    for (int link_it = 0; link_it < get_num_links(); link_it++) {
+        link_frame[link_it] = -1;
+    }
+    
+    // Join every frame with the first frame of all the links it uses
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+            path_pt = get_frame_path(frame_pt, receiver_it, 0);
+            for (int link_it = 0; link_it < path_pt->length; link_it++) {
+                link = path_pt->path[link_it];
+                if (link_frame[link] == -1) {
+                    link_frame[link] = frame_it;
+                } else {
+                    root1 = find_routing_component(parent, frame_it);
+                    root2 = find_routing_component(parent, link_frame[link]);
+                    parent[root1 > root2 ? root1 : root2] = root1 > root2 ? root2 : root1;
+                }
+            }
+        }
+    }
+    
+    // Number the groups in the order of their first frame
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        root1 = find_routing_component(parent, frame_it);
+        if (group[root1] == -1) {
+            group[root1] = num_components;
+            num_components++;
+        }
+        components[frame_it] = group[root1];
+    }
+    
+    free(parent);
+    free(group);
+    free(link_frame);
+    return num_components;
+}
+
+/**
+ Free the master problem
+ */
+void free_routing_master(void) {
+    
+    Frame *frame_pt;
+    
+    if (routing_selectors != NULL) {
+        for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+            frame_pt = get_frame(frame_it);
+            if (routing_selectors[frame_it] != NULL) {
+                for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+                    free(routing_selectors[frame_it][receiver_it]);
+                }
+                free(routing_selectors[frame_it]);
+            }
+        }
+        free(routing_selectors);
+    }
+    routing_selectors = NULL;
+    if (routing_context != NULL) {
+        Z3_solver_dec_ref(routing_context, routing_solver);
+        Z3_del_context(routing_context);
+    }
+    routing_context = NULL;
+}
@@ -0,0 +1,72 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Decomposition.h                                                                                                    *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Package that contains the master problem of the logic-based Benders decomposition of the routing and scheduling.   *
+ *  The master chooses one path for every receiver of every frame without exceeding the capacity of any link, and the  *
+ *  scheduler checks the routing. Routings that cannot be scheduled are cut from the master with no-good cuts.         *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef Decomposition_h
+#define Decomposition_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <z3.h>
+
+#endif /* Decomposition_h */
+
+/* ERROR CODE DEFINITIONS */
+
+#define NO_ROUTING_MASTER -1
+#define CUT_FRAME_OUT_OF_RANGE -2
+#define EMPTY_ROUTING_CUT -3
+
+/* CODE DEFINITIONS */
+
+/**
+ Create the master problem with one boolean selector for every path of every receiver of every frame. Every receiver
+ uses exactly one path, and the utilization of the frames that use a link cannot exceed its capacity.
+ Every frame counts once in a link, even if several of its receivers use it
+
+ @return 0 if done correctly, error code otherwise
+ */
+int init_routing_master(void);
+
+/**
+ Solve the master problem and route every receiver of every frame through the path chosen
+
+ @return 1 if a routing was found, 0 if there is no routing left, error code otherwise
+ */
+int solve_routing_master(void);
+
+/**
+ Add a no-good cut to the master problem, so the given frames cannot be routed again through their current paths at
+ the same time. The frames should be a minimal set that cannot be scheduled together. A cut without frames would
+ make the master infeasible, so it is an error
+
+ @param conflict_frames array with the identifiers of the frames in conflict
+ @param num_conflict_frames number of frames in conflict
+ @return 0 if done correctly, error code otherwise
+ */
+int add_routing_cut(int *conflict_frames, int num_conflict_frames);
+
+/**
+ Group the frames that share links in their current routing. Frames of different groups do not share any link, so
+ every group can be scheduled independently
+
+ @param components array to save the group of every frame, from 0 to the number of groups
+ @return number of groups
+ */
+int get_routing_components(int *components);
+
+/**
+ Free the master problem
+ */
+void free_routing_master(void);
@@ -0,0 +1,334 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Driver.c                                                                                                           *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 18/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Scheduler.h"
+#include "Driver.h"
+
+/* PRIVATE FUNCTIONS */
+
+/**
+ Compare two names of files to sort them alphabetically
+
+ @param name1 pointer to the first name
+ @param name2 pointer to the second name
+ @return negative if the first one goes first, positive if the second one goes first, 0 if they are equal
+ */
+int compare_file_names(const void *name1, const void *name2) {
+    
+    return strcmp(*(char**) name1, *(char**) name2);
+}
+
+/**
+ Add a network file to the list of networks of a batch
+
+ @param networks pointer to the list of names of network files
+ @param num_networks pointer to the number of networks in the list
+ @param capacity pointer to the number of names allocated
+ @param name name of the network file
+ */
+void add_batch_network(char ***networks, int *num_networks, int *capacity, char *name) {
+    
+    if (*num_networks == *capacity) {
+        *capacity = *capacity == 0 ? 64 : *capacity * 2;
+        *networks = realloc(*networks, sizeof(char*) * *capacity);
+    }
+    (*networks)[*num_networks] = strdup(name);
+    (*num_networks)++;
+}
+
+/**
+ Read the networks of a batch, all the xml files of a directory sorted by name or the lines of a manifest in order.
+ The empty lines of the manifest and the ones that start with # are skipped
+
+ @param input directory or manifest with the networks
+ @param networks pointer to save the list of names of network files, every name and the list have to be freed
+ @return number of networks, error code otherwise
+ */
+int read_batch_networks(char *input, char ***networks) {
+    
+    DIR *directory;
+    struct dirent *entry;
+    FILE *manifest;
+    char name[MAX_PATH_SIZE];
+    int num_networks = 0, capacity = 0;
+    size_t length;
+    
+    *networks = NULL;
+    directory = opendir(input);
+    if (directory != NULL) {
+        while ((entry = readdir(directory)) != NULL) {
+            length = strlen(entry->d_name);
+            if (length > 4 && strcmp(&entry->d_name[length - 4], ".xml") == 0 &&
+                snprintf(name, MAX_PATH_SIZE, "%s/%s", input, entry->d_name) < MAX_PATH_SIZE) {
+                add_batch_network(networks, &num_networks, &capacity, name);
+            }
+        }
+        closedir(directory);
+        qsort(*networks, num_networks, sizeof(char*), compare_file_names);
+        return num_networks;
+    }
+    
+    manifest = fopen(input, "r");
+    if (manifest == NULL) {
+        printf("The batch %s is not a directory or a manifest\n", input);
+        return BATCH_INPUT_NOT_FOUND;
+    }
+    while (fgets(name, MAX_PATH_SIZE, manifest) != NULL) {
+        name[strcspn(name, "\r\n")] = '\0';
+        if (name[0] != '\0' && name[0] != '#') {
+            add_batch_network(networks, &num_networks, &capacity, name);
+        }
+    }
+    fclose(manifest);
+    return num_networks;
+}
+
+/**
+ Get the name of the output files of a network in the output directory, the name of the network file without its
+ directory and its extension followed by the given suffix
+
+ @param output_directory directory where the outputs are written
+ @param network_file name of the network file
+ @param suffix suffix of the output file
+ @param filename array of MAX_PATH_SIZE where the name is saved
+ */
+void get_output_filename(char *output_directory, char *network_file, char *suffix, char *filename) {
+    
+    char *base;
+    int length;
+    
+    base = strrchr(network_file, '/');
+    base = base == NULL ? network_file : base + 1;
+    length = (int) strlen(base);
+    if (length > 4 && strcmp(&base[length - 4], ".xml") == 0) {
+        length -= 4;
+    }
+    snprintf(filename, MAX_PATH_SIZE, "%s/%.*s%s", output_directory, length, base, suffix);
+}
+
+/**
+ Schedule a network of a batch in a child process. The output of the scheduler goes to its own file and the line of
+ statistics is sent to the parent
+
+ @param network_file name of the network file
+ @param configuration_file name of the file with the schedule configuration
+ @param output_directory directory where the outputs are written
+ @param mode scheduling mode, KEEP_CONFIGURATION_MODE to use the one of the configuration
+ @param memory_limit maximum memory of the process in MB, 0 if there is no limit
+ @param pipe_fd file descriptor of the writing end of the pipe to the parent
+ @return 0 if the schedule was found, error code otherwise
+ */
+int schedule_batch_network(char *network_file, char *configuration_file, char *output_directory, int mode,
+                           long long int memory_limit, int pipe_fd) {
+    
+    struct rlimit limit;
+    char schedule_file[MAX_PATH_SIZE], output_file[MAX_PATH_SIZE];
+    char stats[STATS_LINE_SIZE];
+    int result;
+    
+    get_output_filename(output_directory, network_file, ".log", output_file);
+    get_output_filename(output_directory, network_file, "_Schedule.xml", schedule_file);
+    if (freopen(output_file, "w", stdout) == NULL) {
+        snprintf(stats, STATS_LINE_SIZE, "%s status=failed result=%d\n", network_file, ERROR_CREATING_OUTPUT);
+        write_pipe(pipe_fd, stats, strlen(stats));
+        return ERROR_CREATING_OUTPUT;
+    }
+    // The errors of the parsers go to the same file
+    dup2(fileno(stdout), STDERR_FILENO);
+    if (memory_limit > 0) {
+        limit.rlim_cur = (rlim_t) memory_limit * 1024 * 1024;
+        limit.rlim_max = limit.rlim_cur;
+        setrlimit(RLIMIT_AS, &limit);
+    }
+    result = schedule_with_stats(network_file, configuration_file, schedule_file, mode, stats);
+    write_pipe(pipe_fd, stats, strlen(stats));
+    return result;
+}
+
+/* PUBLIC FUNCTIONS */
+
+/**
+ Schedule a network, write its schedule and fill a line with its statistics: if it was scheduled, the result code,
+ frames, links, maximum utilization of a link, constraints of the last model, rejected frames, seconds and the
+ maximum memory used by the process in KB
+
+ @param network_file name of the file with the description of the network
+ @param configuration_file name of the file with the schedule configuration
+ @param schedule_file name of the file with the scheduled network
+ @param mode scheduling mode, KEEP_CONFIGURATION_MODE to use the one of the configuration
+ @param stats array of STATS_LINE_SIZE where the line of statistics is saved
+ @return 0 if the schedule was found, error code otherwise
+ */
+int schedule_with_stats(char *network_file, char *configuration_file, char *schedule_file, int mode, char *stats) {
+    
+    struct timespec start, end;
+    struct rusage usage;
+    int result, num_rejected = 0;
+    long memory;
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    result = load_network(network_file, configuration_file);
+    if (result == 0) {
+        if (mode != KEEP_CONFIGURATION_MODE) {
+            set_schedule_mode((ScheduleMode) mode);
+        }
+        result = solve_network(schedule_file);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        if (get_rejected(get_frame(frame_it)) == 1) {
+            num_rejected++;
+        }
+    }
+    getrusage(RUSAGE_SELF, &usage);
+    memory = usage.ru_maxrss;
+#ifdef __APPLE__
+    memory /= 1024;                     // macOS gives it in bytes
+#endif
+    snprintf(stats, STATS_LINE_SIZE, "%s status=%s result=%d frames=%d links=%d utilization=%f constraints=%lld "
+             "rejected=%d time=%.3f memory=%ld\n", network_file, result == 0 ? "scheduled" : "failed", result,
+             get_num_frames(), get_num_links(), get_max_link_utilization(), get_num_constraints(), num_rejected,
+             (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9, memory);
+    return result;
+}
+
+/**
+ Schedule a batch of networks, given as a directory (all its xml files) or as a manifest with the name of a network
+ file in every line. Every network is scheduled in its own process, at most the given number of them at the same
+ time, and its schedule and the output of the scheduler are written in the output directory. A line of statistics of
+ every network is written in the stats file when it finishes
+
+ @param input directory or manifest with the networks
+ @param configuration_file name of the file with the schedule configuration of all networks
+ @param output_directory directory where the schedules and the outputs are written, created if it does not exist
+ @param stats_file file where the lines of statistics are written, NULL to write them in the standard output
+ @param mode scheduling mode, KEEP_CONFIGURATION_MODE to use the one of the configuration
+ @param num_workers maximum number of networks scheduled at the same time, one per processor if it is 0
+ @param memory_limit maximum memory of the process of every network in MB, 0 if there is no limit
+ @return number of networks that could not be scheduled, error code otherwise
+ */
+int run_batch(char *input, char *configuration_file, char *output_directory, char *stats_file, int mode,
+              int num_workers, long long int memory_limit) {
+    
+    char **networks;
+    pid_t *workers;                         // Process of every worker, 0 if it is free
+    int *pipes;                             // Reading end of the pipe of every worker
+    int *worker_networks;                   // Network scheduled by every worker
+    int channel[2];
+    FILE *stats;
+    char line[STATS_LINE_SIZE];
+    int num_networks, next_network = 0, num_running = 0, num_failed = 0;
+    int status, worker_it, length;
+    pid_t finished;
+    ssize_t received;
+    
+    num_networks = read_batch_networks(input, &networks);
+    if (num_networks < 0) {
+        return num_networks;
+    }
+    if (mkdir(output_directory, 0755) < 0 && access(output_directory, W_OK) < 0) {
+        printf("Error creating the output directory %s\n", output_directory);
+        return ERROR_CREATING_OUTPUT;
+    }
+    stats = stats_file == NULL ? stdout : fopen(stats_file, "w");
+    if (stats == NULL) {
+        printf("Error creating the stats file %s\n", stats_file);
+        return ERROR_CREATING_OUTPUT;
+    }
+    if (num_workers <= 0) {
+        num_workers = (int) sysconf(_SC_NPROCESSORS_ONLN);
+        if (num_workers < 1) {
+            num_workers = 1;
+        }
+    }
+    workers = calloc(num_workers, sizeof(pid_t));
+    pipes = malloc(sizeof(int) * num_workers);
+    worker_networks = malloc(sizeof(int) * num_workers);
+    
+    while (next_network < num_networks || num_running > 0) {
+        // Start the next networks in the free workers
+        for (worker_it = 0; worker_it < num_workers && next_network < num_networks; worker_it++) {
+            if (workers[worker_it] != 0) {
+                continue;
+            }
+            // The children inherit the buffer of the standard output, it has to be empty before forking
+            fflush(stdout);
+            fflush(stats);
+            if (pipe(channel) < 0) {
+                break;
+            }
+            workers[worker_it] = fork();
+            if (workers[worker_it] == 0) {
+                close(channel[0]);
+                status = schedule_batch_network(networks[next_network], configuration_file, output_directory, mode,
+                                                memory_limit, channel[1]);
+                close(channel[1]);
+                fflush(stdout);
+                _exit(status < 0);
+            }
+            close(channel[1]);
+            if (workers[worker_it] < 0) {
+                close(channel[0]);
+                workers[worker_it] = 0;
+                break;
+            }
+            pipes[worker_it] = channel[0];
+            worker_networks[worker_it] = next_network;
+            next_network++;
+            num_running++;
+        }
+        if (num_running == 0) {
+            printf("Error creating the processes of the batch\n");
+            num_failed = ERROR_CREATING_OUTPUT;
+            break;
+        }
+    
+        // Wait for any worker and write the statistics of its network, a worker that crashed sends nothing
+        finished = waitpid(-1, &status, 0);
+        worker_it = 0;
+        while (worker_it < num_workers && workers[worker_it] != finished) {
+            worker_it++;
+        }
+        if (finished < 0 || worker_it == num_workers) {
+            continue;
+        }
+        length = 0;
+        while (length < STATS_LINE_SIZE - 1 &&
+               (received = read(pipes[worker_it], &line[length], STATS_LINE_SIZE - 1 - length)) > 0) {
+            length += received;
+        }
+        line[length] = '\0';
+        close(pipes[worker_it]);
+        if (length == 0) {
+            snprintf(line, STATS_LINE_SIZE, "%s status=crashed signal=%d\n", networks[worker_networks[worker_it]],
+                     WIFSIGNALED(status) ? WTERMSIG(status) : 0);
+        }
+        if (WIFEXITED(status) == 0 || WEXITSTATUS(status) != 0) {
+            num_failed++;
+        }
+        fputs(line, stats);
+        fflush(stats);
+        workers[worker_it] = 0;
+        num_running--;
+    }
+    
+    if (stats != stdout) {
+        fclose(stats);
+    }
+    for (int network_it = 0; network_it < num_networks; network_it++) {
+        free(networks[network_it]);
+    }
+    free(networks);
+    free(workers);
+    free(pipes);
+    free(worker_networks);
+    return num_failed;
+}
@@ -0,0 +1,73 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Driver.h                                                                                                           *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 18/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Package that contains the drivers of the command line. A network is scheduled writing its schedule and a line with *
+ *  its statistics, and a batch of networks (a directory or a manifest with one network per line) is scheduled with a  *
+ *  process for every network, at most one per worker at the same time and with a limit of memory each.                *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef Driver_h
+#define Driver_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#endif /* Driver_h */
+
+/* ERROR CODE DEFINITIONS */
+
+#define BATCH_INPUT_NOT_FOUND -1
+#define ERROR_CREATING_OUTPUT -2
+
+/* CODE DEFINITIONS */
+
+#define KEEP_CONFIGURATION_MODE -1          // Mode that keeps the one of the schedule configuration
+#define STATS_LINE_SIZE 1000                // Largest line of statistics of a network
+#define MAX_PATH_SIZE 1000                  // Largest path of a file of a batch
+
+/* STRUCT DEFINITIONS */
+
+/**
+ Schedule a network, write its schedule and fill a line with its statistics: if it was scheduled, the result code,
+ frames, links, maximum utilization of a link, constraints of the last model, rejected frames, seconds and the
+ maximum memory used by the process in KB
+
+ @param network_file name of the file with the description of the network
+ @param configuration_file name of the file with the schedule configuration
+ @param schedule_file name of the file with the scheduled network
+ @param mode scheduling mode, KEEP_CONFIGURATION_MODE to use the one of the configuration
+ @param stats array of STATS_LINE_SIZE where the line of statistics is saved
+ @return 0 if the schedule was found, error code otherwise
+ */
+int schedule_with_stats(char *network_file, char *configuration_file, char *schedule_file, int mode, char *stats);
+
+/**
+ Schedule a batch of networks, given as a directory (all its xml files) or as a manifest with the name of a network
+ file in every line. Every network is scheduled in its own process, at most the given number of them at the same
+ time, and its schedule and the output of the scheduler are written in the output directory. A line of statistics of
+ every network is written in the stats file when it finishes
+
+ @param input directory or manifest with the networks
+ @param configuration_file name of the file with the schedule configuration of all networks
+ @param output_directory directory where the schedules and the outputs are written, created if it does not exist
+ @param stats_file file where the lines of statistics are written, NULL to write them in the standard output
+ @param mode scheduling mode, KEEP_CONFIGURATION_MODE to use the one of the configuration
+ @param num_workers maximum number of networks scheduled at the same time, one per processor if it is 0
+ @param memory_limit maximum memory of the process of every network in MB, 0 if there is no limit
+ @return number of networks that could not be scheduled, error code otherwise
+ */
+int run_batch(char *input, char *configuration_file, char *output_directory, char *stats_file, int mode,
+              int num_workers, long long int memory_limit);
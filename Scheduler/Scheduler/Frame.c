@@ -30,6 +30,10 @@ int init_frame(Frame *frame_pt) {
     frame_pt->deadline = -1;
     frame_pt->period = -1;
     frame_pt->size = -1;
+    frame_pt->symmetric_frame = -1;
+    frame_pt->priority = 0;
+    frame_pt->rejected = 0;
+    frame_pt->routed_paths = NULL;
     frame_pt->offset_ls = malloc(sizeof(Offset));
     frame_pt->offset_ls->next_offset_pt = NULL;
     frame_pt->offset_ls->link = -1;
@@ -336,6 +340,188 @@ int get_receiver_id(Frame *frame_pt, int receiver_id) {
 
 }
 
+/**
+ Get the priority class of the frame
+ 
+ @param frame_pt pointer to the frame
+ @return priority of the frame, error code otherwise
+ */
+int get_priority(Frame *frame_pt) {
+    
+    if (frame_pt == NULL) {
+        printf("The frame pointer is null\n");
+        return NULL_FRAME_POINTER;
+    }
+    
+    return frame_pt->priority;
+}
+
+/**
+ Set the priority class of the frame, higher classes are more critical and are scheduled first
+ 
+ @param frame_pt pointer to the frame
+ @param priority priority of the frame
+ @return 0 if done correctly, error code otherwise
+ */
+int set_priority(Frame *frame_pt, int priority) {
+    
+    if (frame_pt == NULL) {
+        printf("The frame pointer is null\n");
+        return NULL_FRAME_POINTER;
+    }
+    if (priority < 0) {
+        printf("The priority should be a natural number\n");
+        return PRIORITY_NOT_NATURAL;
+    }
+    
+    frame_pt->priority = priority;
+    return 0;
+}
+
+/**
+ Get if the frame was left out of the schedule because it could not be scheduled with the rest of frames
+ 
+ @param frame_pt pointer to the frame
+ @return 1 if the frame is rejected, 0 if it is scheduled, error code otherwise
+ */
+int get_rejected(Frame *frame_pt) {
+    
+    if (frame_pt == NULL) {
+        printf("The frame pointer is null\n");
+        return NULL_FRAME_POINTER;
+    }
+    
+    return frame_pt->rejected;
+}
+
+/**
+ Set if the frame was left out of the schedule because it could not be scheduled with the rest of frames
+ 
+ @param frame_pt pointer to the frame
+ @param rejected 1 if the frame is rejected, 0 if it is scheduled
+ @return 0 if done correctly, error code otherwise
+ */
+int set_rejected(Frame *frame_pt, int rejected) {
+    
+    if (frame_pt == NULL) {
+        printf("The frame pointer is null\n");
+        return NULL_FRAME_POINTER;
+    }
+    
+    frame_pt->rejected = rejected;
+    return 0;
+}
+
+/**
+ Get the path chosen for the given receiver of the frame before scheduling
+ 
+ @param frame_pt pointer to the frame
+ @param receiver_it index of the receiver in the frame
+ @return identifier of the path between the sender and the receiver, -1 if the frame was not routed
+ */
+int get_routed_path(Frame *frame_pt, int receiver_it) {
+    
+    if (frame_pt == NULL) {
+        printf("The frame pointer is null\n");
+        return NULL_FRAME_POINTER;
+    }
+    if (frame_pt->routed_paths == NULL || receiver_it < 0 || receiver_it >= frame_pt->num_receivers) {
+        return -1;
+    }
+    
+    return frame_pt->routed_paths[receiver_it];
+}
+
+/**
+ Set the path chosen for the given receiver of the frame before scheduling, so only its offsets are created
+ 
+ @param frame_pt pointer to the frame
+ @param receiver_it index of the receiver in the frame
+ @param path_id identifier of the path between the sender and the receiver
+ @return 0 if done correctly, error code otherwise
+ */
+int set_routed_path(Frame *frame_pt, int receiver_it, int path_id) {
+    
+    if (frame_pt == NULL) {
+        printf("The frame pointer is null\n");
+        return NULL_FRAME_POINTER;
+    }
+    if (receiver_it < 0 || receiver_it >= frame_pt->num_receivers) {
+        printf("The receiver is out of range\n");
+        return RECEIVER_ID_NOT_NATURAL;
+    }
+    if (path_id < 0) {
+        printf("The routed path should be a natural number\n");
+        return ROUTED_PATH_NOT_NATURAL;
+    }
+    
+    // The paths of all receivers are allocated the first time, receivers not routed yet have no path
+    if (frame_pt->routed_paths == NULL) {
+        frame_pt->routed_paths = malloc(sizeof(int) * frame_pt->num_receivers);
+        for (int receiver = 0; receiver < frame_pt->num_receivers; receiver++) {
+            frame_pt->routed_paths[receiver] = -1;
+        }
+    }
+    frame_pt->routed_paths[receiver_it] = path_id;
+    return 0;
+}
+
+/**
+ Remove the paths chosen for all the receivers of the frame and free them, so the frame can use all its paths again
+ 
+ @param frame_pt pointer to the frame
+ @return 0 if done correctly, error code otherwise
+ */
+int clear_routed_paths(Frame *frame_pt) {
+    
+    if (frame_pt == NULL) {
+        printf("The frame pointer is null\n");
+        return NULL_FRAME_POINTER;
+    }
+    
+    free(frame_pt->routed_paths);
+    frame_pt->routed_paths = NULL;
+    return 0;
+}
+
+/**
+ Get the previous frame that is identical to the given one, so both can be ordered to break symmetries
+ 
+ @param frame_pt pointer to the frame
+ @return identifier of the identical frame, -1 if there is none, error code otherwise
+ */
+int get_symmetric_frame(Frame *frame_pt) {
+    
+    if (frame_pt == NULL) {
+        printf("The frame pointer is null\n");
+        return NULL_FRAME_POINTER;
+    }
+    
+    return frame_pt->symmetric_frame;
+}
+
+/**
+ Set the previous frame that is identical to the given one
+ 
+ @param frame_pt pointer to the frame
+ @param frame_id identifier of the identical frame, -1 if there is none
+ @return 0 if done correctly, error code otherwise
+ */
+int set_symmetric_frame(Frame *frame_pt, int frame_id) {
+    
+    if (frame_pt == NULL) {
+        printf("The frame pointer is null\n");
+        return NULL_FRAME_POINTER;
+    }
+    if (frame_id < -1) {
+        printf("The symmetric frame should be a frame identifier or -1\n");
+        return SYMMETRIC_FRAME_NOT_VALID;
+    }
+    
+    frame_pt->symmetric_frame = frame_id;
+    return 0;
+}
+
 int get_num_receivers(Frame *frame_pt) {
     return frame_pt->num_receivers;
 }
@@ -553,7 +739,7 @@ Offset * add_new_offset(Offset *offset_pt, int link) {
     
     // If the link is not in the linked list, we create a new offset and add it, if not we just return the found offset
     if (offset_pt->link != link) {
-        offset_pt->g_offset = NULL;
+        offset_pt->variable = NULL;
         offset_pt->link = link;
         offset_pt->next_offset_pt = malloc(sizeof(Offset));     // We create the next offset as empty
         offset_pt->next_offset_pt->next_offset_pt = NULL;
@@ -562,7 +748,11 @@ Offset * add_new_offset(Offset *offset_pt, int link) {
         offset_pt->num_replicas = 0;
         offset_pt->offset = NULL;
         offset_pt->timeslots = 0;
-        offset_pt->z_offset = NULL;
+        offset_pt->used = -1;
+        offset_pt->chosen = 1;
+        offset_pt->earliest = 0;
+        offset_pt->latest = 0;
+        offset_pt->state = offset_free;
     } else {
         return NULL;
     }
@@ -675,41 +865,41 @@ int set_offset(Offset *offset_pt, int num_instance, int num_replica, long long i
 }
 
 /**
- Get Z3 offset of the given instance and replica
+ Get the variable of the solver with the transmission time of the given instance and replica
  
  @param offset_pt pointer to the offset
  @param num_instance number
  @param num_replica number
- @return Z3_ast offset constraint of z3, NULL if error ocurred
+ @return handle of the variable in the solver, error code otherwise
  */
-Z3_ast get_z3_offset(Offset *offset_pt, int num_instance, int num_replica) {
+int get_offset_variable(Offset *offset_pt, int num_instance, int num_replica) {
     
     if (offset_pt == NULL) {
         printf("The offset pointer is null\n");
-        return NULL;
+        return NULL_OFFSET_POINTER;
     }
     if (num_instance < 0) {
         printf("The number of instances should not be negative\n");
-        return NULL;
+        return NUM_INSTANCES_NOT_NATURAL;
     }
     if (num_replica < 0) {
         printf("The number of replicas should not be negative\n");
-        return NULL;
+        return NUM_REPLICAS_NEGATIVE;
     }
     
-    return offset_pt->z_offset[num_instance][num_replica];
+    return offset_pt->variable[num_instance][num_replica];
 }
 
 /**
- Set a Z3 offset with the given contraint
-
+ Set the variable of the solver with the transmission time of the given instance and replica
+ 
  @param offset_pt pointer to the offset
  @param num_instance number
  @param num_replica number
- @param z3_constraint z3 constraint to add
+ @param variable handle of the variable in the solver
  @return 0 if done correctly, error otherwise
  */
-int set_z3_offset(Offset *offset_pt, int num_instance, int num_replica, Z3_ast z3_constraint) {
+int set_offset_variable(Offset *offset_pt, int num_instance, int num_replica, int variable) {
     
     if (offset_pt == NULL) {
         printf("The offset pointer is null\n");
@@ -724,61 +914,170 @@ int set_z3_offset(Offset *offset_pt, int num_instance, int num_replica, Z3_ast z
         return NUM_REPLICAS_OUT_RANGE;
     }
     
-    offset_pt->z_offset[num_instance][num_replica] = z3_constraint;
+    offset_pt->variable[num_instance][num_replica] = variable;
     return 0;
 }
 
 /**
- Get gurobi offset of the given instance and replica
+ Get the literal of the solver that is true if the offset is used by the chosen paths, shared by all its instances and
+ replicas
  
  @param offset_pt pointer to the offset
- @param num_instance number
- @param num_replica number
- @return long long int offset constraint of gurobi, error code otherwise
+ @return handle of the literal in the solver, error code otherwise
  */
-int get_gurobi_offset(Offset *offset_pt, int num_instance, int num_replica) {
+int get_offset_used(Offset *offset_pt) {
     
     if (offset_pt == NULL) {
         printf("The offset pointer is null\n");
         return NULL_OFFSET_POINTER;
     }
-    if (num_instance < 0) {
-        printf("The number of instances should not be negative\n");
-        return NUM_INSTANCES_NOT_NATURAL;
+    
+    return offset_pt->used;
+}
+
+/**
+ Set the literal of the solver that is true if the offset is used by the chosen paths, so it guards all its constraints
+ 
+ @param offset_pt pointer to the offset
+ @param literal handle of the boolean literal in the solver
+ @return 0 if done correctly, error otherwise
+ */
+int set_offset_used(Offset *offset_pt, int literal) {
+    
+    if (offset_pt == NULL) {
+        printf("The offset pointer is null\n");
+        return NULL_OFFSET_POINTER;
     }
-    if (num_replica < 0) {
-        printf("The number of replicas should not be negative\n");
-        return NUM_REPLICAS_NEGATIVE;
+    
+    offset_pt->used = literal;
+    return 0;
+}
+
+/**
+ Get if the paths of the last schedule found use the offset, so its transmissions are part of the schedule
+ 
+ @param offset_pt pointer to the offset
+ @return 1 if the offset is used, 0 if not, error code otherwise
+ */
+int get_offset_chosen(Offset *offset_pt) {
+    
+    if (offset_pt == NULL) {
+        printf("The offset pointer is null\n");
+        return NULL_OFFSET_POINTER;
     }
     
-    return offset_pt->g_offset[num_instance][num_replica];
+    return offset_pt->chosen;
 }
 
 /**
- Set a Gurobi offset with the given contraint
+ Set if the paths of the last schedule found use the offset, so its transmissions are part of the schedule
  
  @param offset_pt pointer to the offset
- @param num_instance number
- @param num_replica number
- @param gurobi_constraint z3 constraint to add
+ @param chosen 1 if the offset is used, 0 if not
  @return 0 if done correctly, error otherwise
  */
-int set_gurobi_offset(Offset *offset_pt, int num_instance, int num_replica, int gurobi_constraint) {
+int set_offset_chosen(Offset *offset_pt, int chosen) {
     
     if (offset_pt == NULL) {
         printf("The offset pointer is null\n");
         return NULL_OFFSET_POINTER;
     }
-    if (num_instance < 0) {
-        printf("The number of instances should not be negative\n");
-        return NUM_INSTANCES_NOT_NATURAL;
+    
+    offset_pt->chosen = chosen;
+    return 0;
+}
+
+/**
+ Get the earliest transmission time of the instance 0 of the offset
+ 
+ @param offset_pt pointer to the offset
+ @return earliest transmission time in ns, error code otherwise
+ */
+long long int get_offset_earliest(Offset *offset_pt) {
+    
+    if (offset_pt == NULL) {
+        printf("The offset pointer is null\n");
+        return NULL_OFFSET_POINTER;
     }
-    if (num_replica < 0) {
-        printf("The number of replicas should not be negative\n");
-        return NUM_REPLICAS_OUT_RANGE;
+    
+    return offset_pt->earliest;
+}
+
+/**
+ Get the latest transmission time of the instance 0 of the offset
+ 
+ @param offset_pt pointer to the offset
+ @return latest transmission time in ns, error code otherwise
+ */
+long long int get_offset_latest(Offset *offset_pt) {
+    
+    if (offset_pt == NULL) {
+        printf("The offset pointer is null\n");
+        return NULL_OFFSET_POINTER;
+    }
+    
+    return offset_pt->latest;
+}
+
+/**
+ Set the window where the instance 0 of the offset can be transmitted, the rest of instances are shifted by the period
+ 
+ @param offset_pt pointer to the offset
+ @param earliest earliest transmission time in ns
+ @param latest latest transmission time in ns
+ @return 0 if done correctly, error code otherwise
+ */
+int set_offset_window(Offset *offset_pt, long long int earliest, long long int latest) {
+    
+    if (offset_pt == NULL) {
+        printf("The offset pointer is null\n");
+        return NULL_OFFSET_POINTER;
+    }
+    if (earliest < 0) {
+        printf("The transmission time cannot be negative\n");
+        return TRANSMISSION_TIME_NOT_NATURAL;
+    }
+    if (latest < earliest) {
+        printf("The offset window is empty\n");
+        return OFFSET_WINDOW_EMPTY;
+    }
+    
+    offset_pt->earliest = earliest;
+    offset_pt->latest = latest;
+    return 0;
+}
+
+/**
+ Get the state of the offset in the current scheduling stage
+ 
+ @param offset_pt pointer to the offset
+ @return state of the offset, error code otherwise
+ */
+OffsetState get_offset_state(Offset *offset_pt) {
+    
+    if (offset_pt == NULL) {
+        printf("The offset pointer is null\n");
+        return NULL_OFFSET_POINTER;
+    }
+    
+    return offset_pt->state;
+}
+
+/**
+ Set the state of the offset in the current scheduling stage
+ 
+ @param offset_pt pointer to the offset
+ @param state new state of the offset
+ @return 0 if done correctly, error code otherwise
+ */
+int set_offset_state(Offset *offset_pt, OffsetState state) {
+    
+    if (offset_pt == NULL) {
+        printf("The offset pointer is null\n");
+        return NULL_OFFSET_POINTER;
     }
     
-    offset_pt->g_offset[num_instance][num_replica] = gurobi_constraint;
+    offset_pt->state = state;
     return 0;
 }
 
@@ -801,12 +1100,10 @@ int prepare_offset(Offset *offset_pt) {
     
     // Dynamically allocate an array for the offsets of size [num_instance][num_replica + 1]
     offset_pt->offset = malloc(sizeof(long long int *) * offset_pt->num_instances);
-    offset_pt->z_offset = malloc(sizeof(Z3_ast *) * offset_pt->num_instances);
-    offset_pt->g_offset = malloc(sizeof(int *) * offset_pt->num_instances);
+    offset_pt->variable = malloc(sizeof(int *) * offset_pt->num_instances);
     for (int i = 0; i < offset_pt->num_instances; i++) {
         offset_pt->offset[i] = malloc(sizeof(long long int) * (offset_pt->num_replicas));
-        offset_pt->z_offset[i] = malloc(sizeof(Z3_ast) * (offset_pt->num_replicas));
-        offset_pt->g_offset[i] = malloc(sizeof(int) * (offset_pt->num_replicas));
+        offset_pt->variable[i] = malloc(sizeof(int) * (offset_pt->num_replicas));
     }
     return 0;
 }
@@ -15,25 +15,36 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <z3.h>
-#include <gurobi_c.h>
 
 #endif /* Frame_h */
 
 /* STRUCT DEFINITIONS */
 
+/**
+ State of an offset when the network is scheduled in several stages
+ */
+typedef enum OffsetState {
+    offset_free,                        // The solver has to find its transmission time
+    offset_fixed,                       // Its transmission time was found in a previous stage and cannot change
+    offset_excluded                     // It is not part of the current stage
+}OffsetState;
+
 /**
  Structure with information of an appearance of an offset because the period. It has also arrays for all the information
  about its retransmissions
  */
 typedef struct Offset {
     long long int **offset;             // Matrix with the transmission times in ns
-    Z3_ast **z_offset;                  // Z3 matrix with the transmission times in ns
-    int **g_offset;                     // Gurobi matrix with the transmission times in ns
+    int **variable;                     // Matrix with the variables of the transmission times in the solver
+    int used;                           // Literal of the solver, true if a chosen path uses the offset (path selection)
+    int chosen;                         // 1 if the paths of the last schedule found use the offset, 0 otherwise
     int num_instances;                  // Number of instances of the offset (hyperperiod / period frame)
     int num_replicas;                   // Number of replicas of the offset (retransmissions due to wireless)
     int timeslots;                      // Number of ns to transmit in the link
     int link;                           // Identifier of the link where this offset is being transmitted
+    long long int earliest;             // Earliest transmission time of the instance 0 in ns
+    long long int latest;               // Latest transmission time of the instance 0 in ns
+    OffsetState state;                  // State of the offset in the current scheduling stage
     struct Offset *next_offset_pt;      // Pointer to the next offset (no order in particular)
 }Offset;
 
@@ -50,6 +61,10 @@ typedef struct Frame {
     int sender_id;                      // ID of the end system sender
     int *receivers_id;                   // Array of ID of the end system receivers
     int num_receivers;                  // Number of end system receivers
+    int symmetric_frame;                // Previous frame identical to this one (symmetry breaking), -1 if none
+    int priority;                       // Priority class of the frame, higher classes are more critical
+    int rejected;                       // 1 if the frame was left out of the schedule, 0 if it is scheduled
+    int *routed_paths;                  // Path chosen for every receiver before scheduling, NULL if not routed
     Offset *offset_ls;                  // Pointer to the roof of the offsets linked list
     Offset **offset_hash;               // Array that stores the offsets with index the link identifier (to accelerate)
 }Frame;
@@ -69,6 +84,9 @@ typedef struct Frame {
 #define SENDER_ID_NOT_NATURAL -14
 #define RECEIVER_ID_NOT_NATURAL -15
 #define NUM_RECEIVERS_NOT_NATURAL -16
+#define SYMMETRIC_FRAME_NOT_VALID -17
+#define PRIORITY_NOT_NATURAL -18
+#define ROUTED_PATH_NOT_NATURAL -19
 
 #define NULL_OFFSET_POINTER -21
 #define NUM_INSTANCES_NOT_NATURAL -22
@@ -79,6 +97,7 @@ typedef struct Frame {
 #define NUM_INSTANCES_OUT_RANGE -27
 #define NUM_REPLICAS_OUT_RANGE -28
 #define OFFSET_VALUES_NOT_FILLED -29
+#define OFFSET_WINDOW_EMPTY -30
 
 /* CODE DEFINITIONS */
 
@@ -230,6 +249,84 @@ int get_receiver_id(Frame *frame_pt, int receiver_id);
  */
 int set_receivers_id(Frame *frame_pt, int *receivers_id_array, int num_receivers);
 
+/**
+ Get the priority class of the frame
+
+ @param frame_pt pointer to the frame
+ @return priority of the frame, error code otherwise
+ */
+int get_priority(Frame *frame_pt);
+
+/**
+ Set the priority class of the frame, higher classes are more critical and are scheduled first
+
+ @param frame_pt pointer to the frame
+ @param priority priority of the frame
+ @return 0 if done correctly, error code otherwise
+ */
+int set_priority(Frame *frame_pt, int priority);
+
+/**
+ Get if the frame was left out of the schedule because it could not be scheduled with the rest of frames
+
+ @param frame_pt pointer to the frame
+ @return 1 if the frame is rejected, 0 if it is scheduled, error code otherwise
+ */
+int get_rejected(Frame *frame_pt);
+
+/**
+ Set if the frame was left out of the schedule because it could not be scheduled with the rest of frames
+
+ @param frame_pt pointer to the frame
+ @param rejected 1 if the frame is rejected, 0 if it is scheduled
+ @return 0 if done correctly, error code otherwise
+ */
+int set_rejected(Frame *frame_pt, int rejected);
+
+/**
+ Get the path chosen for the given receiver of the frame before scheduling
+ 
+ @param frame_pt pointer to the frame
+ @param receiver_it index of the receiver in the frame
+ @return identifier of the path between the sender and the receiver, -1 if the frame was not routed
+ */
+int get_routed_path(Frame *frame_pt, int receiver_it);
+
+/**
+ Set the path chosen for the given receiver of the frame before scheduling, so only its offsets are created
+ 
+ @param frame_pt pointer to the frame
+ @param receiver_it index of the receiver in the frame
+ @param path_id identifier of the path between the sender and the receiver
+ @return 0 if done correctly, error code otherwise
+ */
+int set_routed_path(Frame *frame_pt, int receiver_it, int path_id);
+
+/**
+ Remove the paths chosen for all the receivers of the frame and free them, so the frame can use all its paths again
+ 
+ @param frame_pt pointer to the frame
+ @return 0 if done correctly, error code otherwise
+ */
+int clear_routed_paths(Frame *frame_pt);
+
+/**
+ Get the previous frame that is identical to the given one, so both can be ordered to break symmetries
+
+ @param frame_pt pointer to the frame
+ @return identifier of the identical frame, -1 if there is none, error code otherwise
+ */
+int get_symmetric_frame(Frame *frame_pt);
+
+/**
+ Set the previous frame that is identical to the given one
+
+ @param frame_pt pointer to the frame
+ @param frame_id identifier of the identical frame, -1 if there is none
+ @return 0 if done correctly, error code otherwise
+ */
+int set_symmetric_frame(Frame *frame_pt, int frame_id);
+
 /**
  Get the number of instances of the offset
  
@@ -354,46 +451,60 @@ long long int get_offset(Offset *offset_pt, int num_instance, int num_replica);
 int set_offset(Offset *offset_pt, int num_instance, int num_replica, long long int value);
 
 /**
- Get Z3 offset of the given instance and replica
+ Get the variable of the solver with the transmission time of the given instance and replica
  
  @param offset_pt pointer to the offset
  @param num_instance number
  @param num_replica number
- @return Z3_ast offset constraint of z3, error code otherwise
+ @return handle of the variable in the solver, error code otherwise
  */
-Z3_ast get_z3_offset(Offset *offset_pt, int num_instance, int num_replica);
+int get_offset_variable(Offset *offset_pt, int num_instance, int num_replica);
 
 /**
- Set a Z3 offset with the given contraint
+ Set the variable of the solver with the transmission time of the given instance and replica
  
  @param offset_pt pointer to the offset
  @param num_instance number
  @param num_replica number
- @param z3_constraint z3 constraint to add
+ @param variable handle of the variable in the solver
  @return 0 if done correctly, error otherwise
  */
-int set_z3_offset(Offset *offset_pt, int num_instance, int num_replica, Z3_ast z3_constraint);
+int set_offset_variable(Offset *offset_pt, int num_instance, int num_replica, int variable);
 
 /**
- Get gurobi offset of the given instance and replica
+ Get the literal of the solver that is true if the offset is used by the chosen paths, shared by all its instances and
+ replicas
  
  @param offset_pt pointer to the offset
- @param num_instance number
- @param num_replica number
- @return long long int offset constraint of gurobi, error code otherwise
+ @return handle of the literal in the solver, error code otherwise
  */
-int get_gurobi_offset(Offset *offset_pt, int num_instance, int num_replica);
+int get_offset_used(Offset *offset_pt);
 
 /**
- Set a Gurobi offset with the given contraint
+ Set the literal of the solver that is true if the offset is used by the chosen paths, so it guards all its constraints
  
  @param offset_pt pointer to the offset
- @param num_instance number
- @param num_replica number
- @param gurobi_constraint z3 constraint to add
+ @param literal handle of the boolean literal in the solver
+ @return 0 if done correctly, error otherwise
+ */
+int set_offset_used(Offset *offset_pt, int literal);
+
+/**
+ Get if the paths of the last schedule found use the offset, so its transmissions are part of the schedule
+ 
+ @param offset_pt pointer to the offset
+ @return 1 if the offset is used, 0 if not, error code otherwise
+ */
+int get_offset_chosen(Offset *offset_pt);
+
+/**
+ Set if the paths of the last schedule found use the offset, so its transmissions are part of the schedule
+ 
+ @param offset_pt pointer to the offset
+ @param chosen 1 if the offset is used, 0 if not
  @return 0 if done correctly, error otherwise
  */
-int set_gurobi_offset(Offset *offset_pt, int num_instance, int num_replica, int gurobi_constraint);
+int set_offset_chosen(Offset *offset_pt, int chosen);
 
 /**
  Allocates the memory needed and prepare all variables for the used to be ready to be used
@@ -403,6 +514,49 @@ int set_gurobi_offset(Offset *offset_pt, int num_instance, int num_replica, int
  */
 int prepare_offset(Offset *offset_pt);
 
+/**
+ Get the earliest transmission time of the instance 0 of the offset
+
+ @param offset_pt pointer to the offset
+ @return earliest transmission time in ns, error code otherwise
+ */
+long long int get_offset_earliest(Offset *offset_pt);
+
+/**
+ Get the latest transmission time of the instance 0 of the offset
+
+ @param offset_pt pointer to the offset
+ @return latest transmission time in ns, error code otherwise
+ */
+long long int get_offset_latest(Offset *offset_pt);
+
+/**
+ Set the window where the instance 0 of the offset can be transmitted, the rest of instances are shifted by the period
+
+ @param offset_pt pointer to the offset
+ @param earliest earliest transmission time in ns
+ @param latest latest transmission time in ns
+ @return 0 if done correctly, error code otherwise
+ */
+int set_offset_window(Offset *offset_pt, long long int earliest, long long int latest);
+
+/**
+ Get the state of the offset in the current scheduling stage
+
+ @param offset_pt pointer to the offset
+ @return state of the offset, error code otherwise
+ */
+OffsetState get_offset_state(Offset *offset_pt);
+
+/**
+ Set the state of the offset in the current scheduling stage
+
+ @param offset_pt pointer to the offset
+ @param state new state of the offset
+ @return 0 if done correctly, error code otherwise
+ */
+int set_offset_state(Offset *offset_pt, OffsetState state);
+
 /**
  Get the Offset pointer of a frame with the given link.
  This function is O(1) using a hash table and tries to avoid to find the offset iterating the whole offset linked list
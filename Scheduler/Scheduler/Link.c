@@ -27,6 +27,9 @@ int init_link(Link *link_pt) {
     
     link_pt->speed = -1;
     link_pt->type = wired;
+    link_pt->overhead = 0;
+    link_pt->guard_band = 0;
+    link_pt->precision = 0;
     return 0;
 }
 
@@ -125,3 +128,117 @@ int set_link_type(Link *link_pt, LinkType type) {
     link_pt->type = type;
     return 0;
 }
+
+/**
+ Gets the bytes of overhead added to every frame transmitted in the link
+ 
+ @param link_pt pointer to the link
+ @return the overhead in bytes, error code otherwise
+ */
+int get_link_overhead(Link *link_pt) {
+    
+    if (link_pt == NULL) {
+        printf("The given link pointer is null\n");
+        return NULL_LINK_POINTER;
+    }
+    
+    return link_pt->overhead;
+}
+
+/**
+ Sets the bytes of overhead added to every frame transmitted in the link
+ 
+ @param link_pt pointer to the link
+ @param overhead overhead in bytes
+ @return 0 if correct, error code otherwise
+ */
+int set_link_overhead(Link *link_pt, int overhead) {
+    
+    if (link_pt == NULL) {
+        printf("The given link pointer is null\n");
+        return NULL_LINK_POINTER;
+    }
+    if (overhead < 0) {
+        printf("The given link overhead cannot be negative\n");
+        return OVERHEAD_NEGATIVE;
+    }
+    
+    link_pt->overhead = overhead;
+    return 0;
+}
+
+/**
+ Gets the guard band left after every transmission in the link
+ 
+ @param link_pt pointer to the link
+ @return the guard band in ns, error code otherwise
+ */
+long long int get_link_guard_band(Link *link_pt) {
+    
+    if (link_pt == NULL) {
+        printf("The given link pointer is null\n");
+        return NULL_LINK_POINTER;
+    }
+    
+    return link_pt->guard_band;
+}
+
+/**
+ Sets the guard band left after every transmission in the link
+ 
+ @param link_pt pointer to the link
+ @param guard_band guard band in ns
+ @return 0 if correct, error code otherwise
+ */
+int set_link_guard_band(Link *link_pt, long long int guard_band) {
+    
+    if (link_pt == NULL) {
+        printf("The given link pointer is null\n");
+        return NULL_LINK_POINTER;
+    }
+    if (guard_band < 0) {
+        printf("The given link guard band cannot be negative\n");
+        return GUARD_BAND_NEGATIVE;
+    }
+    
+    link_pt->guard_band = guard_band;
+    return 0;
+}
+
+/**
+ Gets the synchronization precision of the node that transmits in the link
+ 
+ @param link_pt pointer to the link
+ @return the precision in ns, error code otherwise
+ */
+long long int get_link_precision(Link *link_pt) {
+    
+    if (link_pt == NULL) {
+        printf("The given link pointer is null\n");
+        return NULL_LINK_POINTER;
+    }
+    
+    return link_pt->precision;
+}
+
+/**
+ Sets the synchronization precision of the node that transmits in the link
+ 
+ @param link_pt pointer to the link
+ @param precision precision in ns
+ @return 0 if correct, error code otherwise
+ */
+int set_link_precision(Link *link_pt, long long int precision) {
+    
+    if (link_pt == NULL) {
+        printf("The given link pointer is null\n");
+        return NULL_LINK_POINTER;
+    }
+    if (precision < 0) {
+        printf("The given node precision cannot be negative\n");
+        return PRECISION_NEGATIVE;
+    }
+    
+    link_pt->precision = precision;
+    return 0;
+}
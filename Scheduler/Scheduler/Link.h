@@ -35,12 +35,18 @@ typedef enum LinkType {
 typedef struct Link {
     LinkType type;                      // Type of the link
     int speed;                          // Speed in MB/s of the link
+    int overhead;                       // Bytes added to every frame on the link (preamble, IFG and headers)
+    long long int guard_band;           // Guard band in ns left after every transmission in the link
+    long long int precision;            // Synchronization precision in ns of the node that transmits in the link
 }Link;
 
 /* TYPEDEF ERRORS */
 
 #define SPEED_NEGATIVE -1
 #define NULL_LINK_POINTER -2
+#define OVERHEAD_NEGATIVE -3
+#define GUARD_BAND_NEGATIVE -4
+#define PRECISION_NEGATIVE -5
 
 /* CODE DEFINITIONS */
 
@@ -95,3 +101,54 @@ LinkType get_link_type(Link *link_pt);
  @return 0 if correct, error code otherwise
  */
 int set_link_type(Link *link_pt, LinkType type);
+
+/**
+ Gets the bytes of overhead added to every frame transmitted in the link
+
+ @param link_pt pointer to the link
+ @return the overhead in bytes, error code otherwise
+ */
+int get_link_overhead(Link *link_pt);
+
+/**
+ Sets the bytes of overhead added to every frame transmitted in the link
+
+ @param link_pt pointer to the link
+ @param overhead overhead in bytes
+ @return 0 if correct, error code otherwise
+ */
+int set_link_overhead(Link *link_pt, int overhead);
+
+/**
+ Gets the guard band left after every transmission in the link
+
+ @param link_pt pointer to the link
+ @return the guard band in ns, error code otherwise
+ */
+long long int get_link_guard_band(Link *link_pt);
+
+/**
+ Sets the guard band left after every transmission in the link
+
+ @param link_pt pointer to the link
+ @param guard_band guard band in ns
+ @return 0 if correct, error code otherwise
+ */
+int set_link_guard_band(Link *link_pt, long long int guard_band);
+
+/**
+ Gets the synchronization precision of the node that transmits in the link
+
+ @param link_pt pointer to the link
+ @return the precision in ns, error code otherwise
+ */
+long long int get_link_precision(Link *link_pt);
+
+/**
+ Sets the synchronization precision of the node that transmits in the link
+
+ @param link_pt pointer to the link
+ @param precision precision in ns
+ @return 0 if correct, error code otherwise
+ */
+int set_link_precision(Link *link_pt, long long int precision);
@@ -0,0 +1,836 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  MIPBackend.c                                                                                                       *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Description in MIPBackend.h                                                                                        *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "MIPBackend.h"
+#include "Backend.h"
+
+/* VARIABLES */
+
+MIPSolver mip_solver = gurobi_mip;  // MIP solver that receives the columns and rows
+GRBenv *gurobi_env = NULL;          // Gurobi environment
+GRBmodel *gurobi_model = NULL;      // Gurobi model, NULL if there is no model
+void *highs_model = NULL;           // HiGHS model, NULL if there is no model
+int mip_num_columns = 0;            // Number of columns of the model, the handle of a column is its index
+double *mip_lower = NULL;           // Lower bound of every column, needed to compute the big-M of the indicators
+double *mip_upper = NULL;           // Upper bound of every column
+int mip_capacity = 0;               // Number of columns allocated in the bounds
+double *highs_solution = NULL;      // Value of every column in the last solution of HiGHS, NULL if there is none
+int **mip_objective_variables = NULL;   // Columns of every objective, from the most to the least important
+double **mip_objective_values = NULL;   // Coefficients of the columns of every objective
+int *mip_objective_sizes = NULL;    // Number of columns of every objective
+int mip_num_objectives = 0;         // Number of objectives
+char mip_export_filename[1000];     // Name of the file where the model is exported once it is finished
+int mip_export_pending = 0;         // 1 if the model has to be exported before it is solved
+long long int mip_num_constraints = 0;  // Number of constraints of the last model, kept once it is freed
+
+/* PRIVATE FUNCTIONS */
+
+/**
+ Get the bound of a column for the MIP solver in use, as infinite bounds are different in both solvers
+
+ @param bound bound of the variable, +-INFINITE_BOUND if it is not bounded
+ @return bound of the column
+ */
+double get_mip_bound(long long int bound) {
+    
+    double infinity = mip_solver == gurobi_mip ? GRB_INFINITY : Highs_getInfinity(highs_model);
+    
+    if (bound == INFINITE_BOUND) {
+        return infinity;
+    }
+    if (bound == -INFINITE_BOUND) {
+        return -infinity;
+    }
+    return (double) bound;
+}
+
+/**
+ Get the sense of a row with the characters of gurobi, also used for HiGHS
+
+ @param sense sense of the linear constraint
+ @return GRB_LESS_EQUAL, GRB_GREATER_EQUAL or GRB_EQUAL
+ */
+char get_mip_sense(ConstraintSense sense) {
+    
+    switch (sense) {
+        case sense_less_equal:
+            return GRB_LESS_EQUAL;
+        case sense_greater_equal:
+            return GRB_GREATER_EQUAL;
+        default:
+            return GRB_EQUAL;
+    }
+}
+
+/**
+ Copy a linear constraint into the arrays of a row
+
+ @param constraint pointer to the linear constraint
+ @param variables array to save the columns (at least MAX_LINEAR_VARIABLES + 1)
+ @param values array to save the coefficients (at least MAX_LINEAR_VARIABLES + 1)
+ @return number of columns of the row, error code if a column does not exist
+ */
+int get_mip_row(LinearConstraint *constraint, int *variables, double *values) {
+    
+    for (int term_it = 0; term_it < constraint->num_variables; term_it++) {
+        if (constraint->variables[term_it] < 0 || constraint->variables[term_it] >= mip_num_columns) {
+            printf("The column %d does not exist\n", constraint->variables[term_it]);
+            return mip_solver == gurobi_mip ? ERROR_SETTING_GUROBI_CONSTRAINT : ERROR_SETTING_HIGHS_CONSTRAINT;
+        }
+        variables[term_it] = constraint->variables[term_it];
+        values[term_it] = (double) constraint->values[term_it];
+    }
+    return constraint->num_variables;
+}
+
+/**
+ Add a linear row into the MIP solver in use
+
+ @param num_variables number of columns in the row
+ @param variables indexes of the columns
+ @param values coefficients of the columns
+ @param sense sense of the row (GRB_LESS_EQUAL, GRB_GREATER_EQUAL or GRB_EQUAL)
+ @param rhs right hand side of the row
+ @return 0 if done correctly, error code otherwise
+ */
+int add_mip_constraint(int num_variables, int *variables, double *values, char sense, double rhs) {
+    
+    double infinity;
+    
+    switch (mip_solver) {
+        case gurobi_mip:
+            if (GRBaddconstr(gurobi_model, num_variables, variables, values, sense, rhs, NULL) != 0) {
+                return ERROR_SETTING_GUROBI_CONSTRAINT;
+            }
+            return 0;
+        default:
+            infinity = Highs_getInfinity(highs_model);
+            if (Highs_addRow(highs_model, sense == GRB_LESS_EQUAL ? -infinity : rhs,
+                             sense == GRB_GREATER_EQUAL ? infinity : rhs, num_variables, variables,
+                             values) != kHighsStatusOk) {
+                return ERROR_SETTING_HIGHS_CONSTRAINT;
+            }
+            return 0;
+    }
+}
+
+/**
+ Add a row that only holds when a binary column has the given value. Gurobi has it as a general constraint, in HiGHS
+ it is a big-M row, with the big-M computed from the bounds of the columns so it is as tight as possible
+
+ @param binary index of the binary column
+ @param binary_value value of the binary column that activates the row (0 or 1)
+ @param num_variables number of columns in the row
+ @param variables indexes of the columns
+ @param values coefficients of the columns
+ @param sense sense of the row (GRB_LESS_EQUAL, GRB_GREATER_EQUAL or GRB_EQUAL)
+ @param rhs right hand side of the row
+ @return 0 if done correctly, error code otherwise
+ */
+int add_mip_indicator(int binary, int binary_value, int num_variables, int *variables, double *values, char sense,
+                      double rhs) {
+    
+    int row_variables[MAX_LINEAR_VARIABLES + 1];
+    double row_values[MAX_LINEAR_VARIABLES + 1];
+    double minimum = 0.0, maximum = 0.0;    // Range of the linear expression with the bounds of its columns
+    double big_m;
+    int result = 0;
+    
+    switch (mip_solver) {
+        case gurobi_mip:
+            if (GRBaddgenconstrIndicator(gurobi_model, NULL, binary, binary_value, num_variables, variables, values,
+                                         sense, rhs) != 0) {
+                return ERROR_SETTING_GUROBI_CONSTRAINT;
+            }
+            return 0;
+        default:
+            for (int variable_it = 0; variable_it < num_variables; variable_it++) {
+                row_variables[variable_it] = variables[variable_it];
+                row_values[variable_it] = values[variable_it];
+                if (values[variable_it] > 0) {
+                    minimum += values[variable_it] * mip_lower[variables[variable_it]];
+                    maximum += values[variable_it] * mip_upper[variables[variable_it]];
+                } else {
+                    minimum += values[variable_it] * mip_upper[variables[variable_it]];
+                    maximum += values[variable_it] * mip_lower[variables[variable_it]];
+                }
+            }
+            // Without finite bounds there is no big-M that keeps the row valid when it is not active
+            if (minimum <= -Highs_getInfinity(highs_model) || maximum >= Highs_getInfinity(highs_model)) {
+                printf("The indicators of HiGHS need bounded columns\n");
+                return ERROR_SETTING_HIGHS_CONSTRAINT;
+            }
+            row_variables[num_variables] = binary;
+            // expression <= rhs + M * (1 - binary), or + M * binary if it is active with the binary at 0
+            big_m = maximum - rhs;
+            if ((sense == GRB_LESS_EQUAL || sense == GRB_EQUAL) && big_m > 0) {
+                row_values[num_variables] = binary_value == 1 ? big_m : -big_m;
+                result |= add_mip_constraint(num_variables + 1, row_variables, row_values, GRB_LESS_EQUAL,
+                                             binary_value == 1 ? rhs + big_m : rhs);
+            }
+            // expression >= rhs - M * (1 - binary), or - M * binary if it is active with the binary at 0
+            big_m = rhs - minimum;
+            if ((sense == GRB_GREATER_EQUAL || sense == GRB_EQUAL) && big_m > 0) {
+                row_values[num_variables] = binary_value == 1 ? -big_m : big_m;
+                result |= add_mip_constraint(num_variables + 1, row_variables, row_values, GRB_GREATER_EQUAL,
+                                             binary_value == 1 ? rhs - big_m : rhs);
+            }
+            return result != 0 ? ERROR_SETTING_HIGHS_CONSTRAINT : 0;
+    }
+}
+
+/**
+ Solve the HiGHS model with the given time limit and save the solution found, if any
+
+ @param time limit time in seconds to solve the model
+ @return 1 if a feasible solution was found, SOLUTION_NOT_PROVEN if the time limit stopped the search after finding
+ one, 0 if there is none, BACKEND_TIME_LIMIT if the time limit stopped it before finding any
+ */
+int run_highs(int time) {
+    
+    HighsInt status = 0;
+    
+    Highs_setDoubleOptionValue(highs_model, "time_limit", time);
+    Highs_run(highs_model);
+    free(highs_solution);
+    highs_solution = NULL;
+    // A time limit can stop the search with a feasible solution that is not optimal
+    if (Highs_getIntInfoValue(highs_model, "primal_solution_status", &status) != kHighsStatusOk ||
+        status != kHighsSolutionStatusFeasible) {
+        return Highs_getModelStatus(highs_model) == kHighsModelStatusTimeLimit ? BACKEND_TIME_LIMIT : 0;
+    }
+    highs_solution = malloc(sizeof(double) * (mip_num_columns + 1));
+    Highs_getSolution(highs_model, highs_solution, NULL, NULL, NULL);
+    return Highs_getModelStatus(highs_model) == kHighsModelStatusTimeLimit ? SOLUTION_NOT_PROVEN : 1;
+}
+
+/**
+ Set the objectives into gurobi as a multi-objective model with decreasing priorities, so they are optimized
+ lexicographically
+
+ @return 0 if done correctly, error code otherwise
+ */
+int set_gurobi_objectives(void) {
+    
+    int error = 0;
+    
+    if (mip_num_objectives == 0) {
+        return 0;
+    }
+    // The attributes of the new columns can only be changed once they are in the model
+    GRBupdatemodel(gurobi_model);
+    error |= GRBsetintattr(gurobi_model, GRB_INT_ATTR_NUMOBJ, mip_num_objectives);
+    for (int objective_it = 0; objective_it < mip_num_objectives; objective_it++) {
+        error |= GRBsetintparam(GRBgetenv(gurobi_model), GRB_INT_PAR_OBJNUMBER, objective_it);
+        error |= GRBsetintattr(gurobi_model, GRB_INT_ATTR_OBJNPRIORITY, mip_num_objectives - objective_it);
+        for (int variable_it = 0; variable_it < mip_objective_sizes[objective_it]; variable_it++) {
+            error |= GRBsetdblattrelement(gurobi_model, GRB_DBL_ATTR_OBJN,
+                                          mip_objective_variables[objective_it][variable_it],
+                                          mip_objective_values[objective_it][variable_it]);
+        }
+    }
+    
+    if (error != 0) {
+        printf("Error setting the objectives in gurobi\n");
+        return ERROR_SETTING_MIP_OBJECTIVES;
+    }
+    return 0;
+}
+
+/**
+ Set the objectives into HiGHS, which only optimizes one objective. Every objective is scaled below the smallest step
+ of the previous one, so it only breaks its ties (the steps are at least 1 as the columns are integers). The scale of
+ an objective is the range of values it can take with the bounds of its columns
+
+ @return 0 if done correctly, error code otherwise
+ */
+int set_highs_objectives(void) {
+    
+    double *costs;
+    double scale = 1.0;
+    double range;
+    int error = 0;
+    int column;
+    
+    costs = calloc(mip_num_columns + 1, sizeof(double));
+    for (int objective_it = 0; objective_it < mip_num_objectives; objective_it++) {
+        if (objective_it > 0) {
+            range = 0.0;
+            for (int variable_it = 0; variable_it < mip_objective_sizes[objective_it]; variable_it++) {
+                column = mip_objective_variables[objective_it][variable_it];
+                range += fabs(mip_objective_values[objective_it][variable_it]) * (mip_upper[column] - mip_lower[column]);
+            }
+            if (range >= Highs_getInfinity(highs_model)) {
+                printf("HiGHS only optimizes the objectives before an unbounded one\n");
+                break;
+            }
+            scale = scale / (range + 1.0);
+        }
+        for (int variable_it = 0; variable_it < mip_objective_sizes[objective_it]; variable_it++) {
+            column = mip_objective_variables[objective_it][variable_it];
+            costs[column] += scale * mip_objective_values[objective_it][variable_it];
+        }
+    }
+    for (int column_it = 0; column_it < mip_num_columns; column_it++) {
+        error |= Highs_changeColCost(highs_model, column_it, costs[column_it]);
+    }
+    free(costs);
+    
+    if (error != 0) {
+        printf("Error setting the objectives in HiGHS\n");
+        return ERROR_SETTING_MIP_OBJECTIVES;
+    }
+    return 0;
+}
+
+/**
+ Write the model into the export file, only once as it does not change between solves
+
+ @return 0 if done correctly, error code otherwise
+ */
+int write_mip_export(void) {
+    
+    if (mip_export_pending == 0) {
+        return 0;
+    }
+    mip_export_pending = 0;
+    // Both solvers choose the format with the extension of the file
+    if (mip_solver == gurobi_mip) {
+        if (GRBwrite(gurobi_model, mip_export_filename) != 0) {
+            printf("The gurobi model could not be exported\n");
+            return EXPORT_FILE_NOT_OPENED;
+        }
+    } else if (Highs_writeModel(highs_model, mip_export_filename) != kHighsStatusOk) {
+        printf("The HiGHS model could not be exported\n");
+        return EXPORT_FILE_NOT_OPENED;
+    }
+    return 0;
+}
+
+/**
+ Count the constraints of the model of the MIP solver in use, there has to be a model
+
+ @return number of constraints
+ */
+long long int count_mip_constraints(void) {
+    
+    int num_linear = 0, num_general = 0;
+    
+    if (mip_solver == gurobi_mip) {
+        // Gurobi only counts the constraints once the model is updated
+        GRBupdatemodel(gurobi_model);
+        GRBgetintattr(gurobi_model, "NumConstrs", &num_linear);
+        GRBgetintattr(gurobi_model, "NumGenConstrs", &num_general);
+        return num_linear + num_general;
+    }
+    // The general constraints are already rows in HiGHS
+    return Highs_getNumRow(highs_model);
+}
+
+/**
+ Free the model of the MIP solver in use, it can be called several times. The number of constraints is kept to
+ report it once the model is freed
+ */
+void mip_destroy(void) {
+    
+    if (gurobi_model != NULL || highs_model != NULL) {
+        mip_num_constraints = count_mip_constraints();
+    }
+    if (gurobi_model != NULL) {
+        GRBfreemodel(gurobi_model);
+        GRBfreeenv(gurobi_env);
+        gurobi_model = NULL;
+    }
+    if (highs_model != NULL) {
+        Highs_destroy(highs_model);
+        highs_model = NULL;
+    }
+    free(highs_solution);
+    highs_solution = NULL;
+    for (int objective_it = 0; objective_it < mip_num_objectives; objective_it++) {
+        free(mip_objective_variables[objective_it]);
+        free(mip_objective_values[objective_it]);
+    }
+    mip_num_objectives = 0;
+    mip_num_columns = 0;
+    mip_export_pending = 0;
+}
+
+/**
+ Create an empty gurobi model that maximizes
+
+ @return 0 if done correctly, error code otherwise
+ */
+int gurobi_create(void) {
+    
+    mip_destroy();
+    mip_solver = gurobi_mip;
+    GRBloadenv(&gurobi_env, "schedule.log");
+    GRBnewmodel(gurobi_env, &gurobi_model, "schedule", 0, NULL, NULL, NULL, NULL, NULL);
+    GRBsetintattr(gurobi_model, GRB_INT_ATTR_MODELSENSE, GRB_MAXIMIZE);
+    return 0;
+}
+
+/**
+ Create an empty HiGHS model that maximizes
+
+ @return 0 if done correctly, error code otherwise
+ */
+int highs_create(void) {
+    
+    mip_destroy();
+    mip_solver = highs_mip;
+    highs_model = Highs_create();
+    Highs_setStringOptionValue(highs_model, "log_file", "schedule.log");
+    Highs_changeObjectiveSense(highs_model, kHighsObjSenseMaximize);
+    return 0;
+}
+
+/**
+ Save the file to export the model once it is finished
+
+ @param format format of the exported model, only LP and MPS are supported
+ @param filename name of the file to write the model
+ @return 0 if done correctly, error code otherwise
+ */
+int mip_open_export(ExportFormat format, char *filename) {
+    
+    if (format != lp_export && format != mps_export) {
+        printf("Only LP and MPS export are supported with gurobi and HiGHS\n");
+        return EXPORT_FORMAT_NOT_SUPPORTED;
+    }
+    if (strlen(filename) >= sizeof(mip_export_filename)) {
+        printf("The export file name is not valid\n");
+        return EXPORT_FILE_NOT_OPENED;
+    }
+    strcpy(mip_export_filename, filename);
+    mip_export_pending = 1;
+    return 0;
+}
+
+/**
+ Add a column into the MIP solver in use, integer or binary
+
+ @param lower lower bound of the column, -INFINITE_BOUND if it is not bounded
+ @param upper upper bound of the column, INFINITE_BOUND if it is not bounded
+ @param domain domain of the column
+ @param index index of the variable (not used, the column index is the handle)
+ @param name name of the column, NULL to leave it unnamed
+ @return handle of the column, error code otherwise
+ */
+int mip_new_var(long long int lower, long long int upper, VariableDomain domain, int index, char *name) {
+    
+    double lower_bound = get_mip_bound(lower);
+    double upper_bound = get_mip_bound(upper);
+    
+    (void) index;
+    switch (mip_solver) {
+        case gurobi_mip:
+            if (GRBaddvar(gurobi_model, 0, NULL, NULL, 0.0, lower_bound, upper_bound,
+                          domain == boolean_domain ? GRB_BINARY : GRB_INTEGER, name) != 0) {
+                return ERROR_SETTING_GUROBI_VAR;
+            }
+            break;
+        default:
+            if (Highs_addCol(highs_model, 0.0, lower_bound, upper_bound, 0, NULL, NULL) != kHighsStatusOk) {
+                return ERROR_SETTING_HIGHS_VAR;
+            }
+            Highs_changeColIntegrality(highs_model, mip_num_columns, kHighsVarTypeInteger);
+            if (name != NULL) {
+                Highs_passColName(highs_model, mip_num_columns, name);
+            }
+            break;
+    }
+    
+    if (mip_num_columns == mip_capacity) {
+        mip_capacity = mip_capacity == 0 ? 1024 : mip_capacity * 2;
+        mip_lower = realloc(mip_lower, sizeof(double) * mip_capacity);
+        mip_upper = realloc(mip_upper, sizeof(double) * mip_capacity);
+    }
+    mip_lower[mip_num_columns] = lower_bound;
+    mip_upper[mip_num_columns] = upper_bound;
+    mip_num_columns++;
+    return mip_num_columns - 1;
+}
+
+/**
+ Add a linear constraint as a row
+
+ @param constraint pointer to the linear constraint
+ @return 0 if done correctly, error code otherwise
+ */
+int mip_add_diff(LinearConstraint *constraint) {
+    
+    int variables[MAX_LINEAR_VARIABLES + 1];
+    double values[MAX_LINEAR_VARIABLES + 1];
+    int num_variables = get_mip_row(constraint, variables, values);
+    
+    if (num_variables < 0) {
+        return num_variables;
+    }
+    return add_mip_constraint(num_variables, variables, values, get_mip_sense(constraint->sense),
+                              (double) constraint->rhs);
+}
+
+/**
+ Add a linear constraint that only holds when the binary column has the given value
+
+ @param literal handle of the binary column
+ @param value value of the column that activates the constraint (0 or 1)
+ @param constraint pointer to the linear constraint
+ @return 0 if done correctly, error code otherwise
+ */
+int mip_add_guarded(int literal, int value, LinearConstraint *constraint) {
+    
+    int variables[MAX_LINEAR_VARIABLES + 1];
+    double values[MAX_LINEAR_VARIABLES + 1];
+    int num_variables = get_mip_row(constraint, variables, values);
+    
+    if (num_variables < 0) {
+        return num_variables;
+    }
+    return add_mip_indicator(literal, value, num_variables, variables, values, get_mip_sense(constraint->sense),
+                             (double) constraint->rhs);
+}
+
+/**
+ Add that at least one of the constraints holds unless any guard is 0. Every constraint gets a binary column that
+ activates it, and the binaries are related with the guards in a single row
+ sum(binaries) - sum(guards) >= 1 - num_guards
+
+ @param num_constraints number of constraints
+ @param constraints array with the linear constraints
+ @param num_guards number of guard literals
+ @param guards array with the handles of the guard literals
+ @return 0 if done correctly, error code otherwise
+ */
+int mip_add_disjunction(int num_constraints, LinearConstraint *constraints, int num_guards, int *guards) {
+    
+    int *variables;
+    double *values;
+    int result = 0;
+    
+    // A single constraint without guards always holds
+    if (num_constraints == 1 && num_guards == 0) {
+        return mip_add_diff(&constraints[0]);
+    }
+    
+    variables = malloc(sizeof(int) * (num_constraints + num_guards));
+    values = malloc(sizeof(double) * (num_constraints + num_guards));
+    for (int constraint_it = 0; constraint_it < num_constraints; constraint_it++) {
+        variables[constraint_it] = mip_new_var(0, 1, boolean_domain, -1, NULL);
+        values[constraint_it] = 1.0;
+        if (variables[constraint_it] < 0) {
+            result = variables[constraint_it];
+            break;
+        }
+        result = mip_add_guarded(variables[constraint_it], 1, &constraints[constraint_it]);
+        if (result < 0) {
+            break;
+        }
+    }
+    if (result == 0) {
+        for (int guard_it = 0; guard_it < num_guards; guard_it++) {
+            variables[num_constraints + guard_it] = guards[guard_it];
+            values[num_constraints + guard_it] = -1.0;
+        }
+        result = add_mip_constraint(num_constraints + num_guards, variables, values, GRB_GREATER_EQUAL,
+                                    1.0 - num_guards);
+    }
+    free(variables);
+    free(values);
+    return result;
+}
+
+/**
+ Add that the result binary is the logical or of other binaries. Gurobi has it as a general constraint, in HiGHS the
+ result is at least every binary and at most their sum
+
+ @param result handle of the result binary
+ @param num_literals number of binaries in the or
+ @param literals handles of the binaries
+ @return 0 if done correctly, error code otherwise
+ */
+int mip_add_or(int result, int num_literals, int *literals) {
+    
+    int *row_variables;
+    double *row_values;
+    int error = 0;
+    
+    switch (mip_solver) {
+        case gurobi_mip:
+            if (GRBaddgenconstrOr(gurobi_model, NULL, result, num_literals, literals) != 0) {
+                return ERROR_SETTING_GUROBI_CONSTRAINT;
+            }
+            return 0;
+        default:
+            row_variables = malloc(sizeof(int) * (num_literals + 2));
+            row_values = malloc(sizeof(double) * (num_literals + 2));
+            row_variables[0] = result;
+            row_values[0] = 1.0;
+            row_values[1] = -1.0;
+            for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+                row_variables[1] = literals[literal_it];
+                error |= add_mip_constraint(2, row_variables, row_values, GRB_GREATER_EQUAL, 0);
+            }
+            for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+                row_variables[literal_it + 1] = literals[literal_it];
+                row_values[literal_it + 1] = -1.0;
+            }
+            error |= add_mip_constraint(num_literals + 1, row_variables, row_values, GRB_LESS_EQUAL, 0);
+            free(row_variables);
+            free(row_values);
+            return error != 0 ? ERROR_SETTING_HIGHS_CONSTRAINT : 0;
+    }
+}
+
+/**
+ Add that exactly one of the binaries is 1, as a row with their sum
+
+ @param num_literals number of binaries
+ @param literals handles of the binaries
+ @return 0 if done correctly, error code otherwise
+ */
+int mip_add_exactly_one(int num_literals, int *literals) {
+    
+    double *values;
+    int result;
+    
+    values = malloc(sizeof(double) * (num_literals + 1));
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        values[literal_it] = 1.0;
+    }
+    result = add_mip_constraint(num_literals, literals, values, GRB_EQUAL, 1);
+    free(values);
+    return result;
+}
+
+/**
+ Save an objective, less important than the previous ones. They are set into the solver before solving
+
+ @param num_variables number of columns of the objective
+ @param variables array with the handles of the columns
+ @param values array with the coefficient of every column
+ @return 0 if done correctly, error code otherwise
+ */
+int mip_set_objective(int num_variables, int *variables, double *values) {
+    
+    for (int variable_it = 0; variable_it < num_variables; variable_it++) {
+        if (variables[variable_it] < 0 || variables[variable_it] >= mip_num_columns) {
+            printf("The column %d of the objective does not exist\n", variables[variable_it]);
+            return ERROR_SETTING_MIP_OBJECTIVES;
+        }
+    }
+    mip_objective_variables = realloc(mip_objective_variables, sizeof(int *) * (mip_num_objectives + 1));
+    mip_objective_values = realloc(mip_objective_values, sizeof(double *) * (mip_num_objectives + 1));
+    mip_objective_sizes = realloc(mip_objective_sizes, sizeof(int) * (mip_num_objectives + 1));
+    mip_objective_variables[mip_num_objectives] = malloc(sizeof(int) * (num_variables + 1));
+    mip_objective_values[mip_num_objectives] = malloc(sizeof(double) * (num_variables + 1));
+    for (int variable_it = 0; variable_it < num_variables; variable_it++) {
+        mip_objective_variables[mip_num_objectives][variable_it] = variables[variable_it];
+        mip_objective_values[mip_num_objectives][variable_it] = values[variable_it];
+    }
+    mip_objective_sizes[mip_num_objectives] = num_variables;
+    mip_num_objectives++;
+    return 0;
+}
+
+/**
+ Change the lower bound of a column for the next solves
+
+ @param variable handle of the column
+ @param lower new lower bound
+ @return 0 if done correctly, error code otherwise
+ */
+int mip_set_lower_bound(int variable, long long int lower) {
+    
+    if (variable < 0 || variable >= mip_num_columns) {
+        return mip_solver == gurobi_mip ? ERROR_SETTING_GUROBI_VAR : ERROR_SETTING_HIGHS_VAR;
+    }
+    mip_lower[variable] = (double) lower;
+    if (mip_solver == gurobi_mip) {
+        if (GRBsetdblattrelement(gurobi_model, GRB_DBL_ATTR_LB, variable, (double) lower) != 0) {
+            return ERROR_SETTING_GUROBI_VAR;
+        }
+        return 0;
+    }
+    if (Highs_changeColBounds(highs_model, variable, (double) lower, mip_upper[variable]) != kHighsStatusOk) {
+        return ERROR_SETTING_HIGHS_VAR;
+    }
+    return 0;
+}
+
+/**
+ Solve the model with the MIP solver in use. The parameters of gurobi are read from the tuned file if there is one
+
+ @param time limit time in seconds to solve the model
+ @return 1 if a solution was found, SOLUTION_NOT_PROVEN if the time limit stopped the search after finding one, 0 if
+ there is none, BACKEND_TIME_LIMIT if the time limit stopped it before finding any, error code if the model could not
+ be solved
+ */
+int mip_solve(int time) {
+    
+    int sol_count = 0;
+    int status = 0;
+    
+    if (mip_solver == gurobi_mip) {
+        if (set_gurobi_objectives() < 0) {
+            return ERROR_SETTING_MIP_OBJECTIVES;
+        }
+        GRBreadparams(gurobi_env, "XML Files/Params.prm");
+        GRBsetdblparam(GRBgetenv(gurobi_model), "TimeLimit", time);
+        write_mip_export();
+        GRBoptimize(gurobi_model);
+        GRBgetintattr(gurobi_model, "SolCount", &sol_count);
+        GRBgetintattr(gurobi_model, GRB_INT_ATTR_STATUS, &status);
+        if (sol_count > 0) {
+            GRBwrite(gurobi_model, "Schedule.sol");
+            return status == GRB_TIME_LIMIT ? SOLUTION_NOT_PROVEN : 1;
+        }
+        return status == GRB_TIME_LIMIT ? BACKEND_TIME_LIMIT : 0;
+    }
+    
+    if (set_highs_objectives() < 0) {
+        return ERROR_SETTING_MIP_OBJECTIVES;
+    }
+    write_mip_export();
+    return run_highs(time);
+}
+
+/**
+ Tune the parameters of gurobi for the model and save the best ones found in Params.prm
+
+ @param time limit time in seconds to tune
+ @return 0 if done correctly, error code otherwise
+ */
+int gurobi_tune(int time) {
+    
+    int num_results = 0;
+    
+    if (set_gurobi_objectives() < 0) {
+        return ERROR_SETTING_MIP_OBJECTIVES;
+    }
+    GRBsetdblparam(GRBgetenv(gurobi_model), "TuneTimeLimit", time);
+    GRBtunemodel(gurobi_model);
+    GRBgetintattr(gurobi_model, "TuneResultCount", &num_results);
+    if (num_results > 0) {
+        GRBgettuneresult(gurobi_model, 0);
+        GRBwrite(gurobi_model, "Params.prm");
+    }
+    return 0;
+}
+
+/**
+ Get the value of a column in the last solution found, rounded as all the columns are integers
+
+ @param variable handle of the column
+ @param value pointer to save the value
+ @return 0 if done correctly, error code otherwise
+ */
+int mip_get_value(int variable, long long int *value) {
+    
+    double mip_value;
+    
+    if (mip_solver == gurobi_mip) {
+        if (GRBgetdblattrelement(gurobi_model, GRB_DBL_ATTR_X, variable, &mip_value) != 0) {
+            return ERROR_EXTRACTING_GUROBI_OFFSET;
+        }
+    } else {
+        if (highs_solution == NULL || variable < 0 || variable >= mip_num_columns) {
+            return ERROR_EXTRACTING_HIGHS_OFFSET;
+        }
+        mip_value = highs_solution[variable];
+    }
+    *value = llround(mip_value);
+    return 0;
+}
+
+/**
+ Get the number of constraints of the model, general constraints of gurobi are counted as one
+
+ @return number of constraints
+ */
+long long int mip_get_num_constraints(void) {
+    
+    if (gurobi_model == NULL && highs_model == NULL) {
+        return mip_num_constraints;
+    }
+    return count_mip_constraints();
+}
+
+/* PUBLIC FUNCTIONS */
+
+/**
+ Get the built in backend of gurobi
+
+ @return pointer to the backend
+ */
+SolverBackend * get_gurobi_backend(void) {
+    
+    static SolverBackend gurobi_backend = {
+        .version = BACKEND_INTERFACE_VERSION,
+        .name = "gurobi",
+        .distances = 1,
+        .create = gurobi_create,
+        .open_export = mip_open_export,
+        .new_var = mip_new_var,
+        .add_diff = mip_add_diff,
+        .add_guarded = mip_add_guarded,
+        .add_disjunction = mip_add_disjunction,
+        .add_or = mip_add_or,
+        .add_exactly_one = mip_add_exactly_one,
+        .add_resource = NULL,
+        .set_objective = mip_set_objective,
+        .set_lower_bound = mip_set_lower_bound,
+        .solve = mip_solve,
+        .solve_assuming = NULL,
+        .tune = gurobi_tune,
+        .get_value = mip_get_value,
+        .get_num_constraints = mip_get_num_constraints,
+        .destroy = mip_destroy
+    };
+    
+    return &gurobi_backend;
+}
+
+/**
+ Get the built in backend of HiGHS
+
+ @return pointer to the backend
+ */
+SolverBackend * get_highs_backend(void) {
+    
+    static SolverBackend highs_backend = {
+        .version = BACKEND_INTERFACE_VERSION,
+        .name = "highs",
+        .distances = 1,
+        .create = highs_create,
+        .open_export = mip_open_export,
+        .new_var = mip_new_var,
+        .add_diff = mip_add_diff,
+        .add_guarded = mip_add_guarded,
+        .add_disjunction = mip_add_disjunction,
+        .add_or = mip_add_or,
+        .add_exactly_one = mip_add_exactly_one,
+        .add_resource = NULL,
+        .set_objective = mip_set_objective,
+        .set_lower_bound = mip_set_lower_bound,
+        .solve = mip_solve,
+        .solve_assuming = NULL,
+        .tune = NULL,
+        .get_value = mip_get_value,
+        .get_num_constraints = mip_get_num_constraints,
+        .destroy = mip_destroy
+    };
+    
+    return &highs_backend;
+}
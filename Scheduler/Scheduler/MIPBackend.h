@@ -0,0 +1,44 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  MIPBackend.h                                                                                                       *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Package that contains the backends of the MIP solvers, gurobi and HiGHS. Both receive the same columns and rows,   *
+ *  so they share all the operations. Gurobi has indicator and or constraints, in HiGHS they are rows with a big-M     *
+ *  computed from the bounds of the columns. Several objectives are lexicographic in gurobi and weighted in HiGHS.     *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef MIPBackend_h
+#define MIPBackend_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gurobi_c.h>
+#include <interfaces/highs_c_api.h>
+
+#endif /* MIPBackend_h */
+
+/* ERROR CODE DEFINITIONS */
+
+#define ERROR_SETTING_GUROBI_VAR -301
+#define ERROR_SETTING_GUROBI_CONSTRAINT -302
+#define ERROR_EXTRACTING_GUROBI_OFFSET -303
+#define ERROR_SETTING_HIGHS_VAR -304
+#define ERROR_SETTING_HIGHS_CONSTRAINT -305
+#define ERROR_EXTRACTING_HIGHS_OFFSET -306
+#define ERROR_SETTING_MIP_OBJECTIVES -307
+
+/* STRUCT DEFINITIONS */
+
+/**
+ MIP solvers that receive the columns and rows of the model
+ */
+typedef enum MIPSolver {
+    gurobi_mip,
+    highs_mip
+}MIPSolver;
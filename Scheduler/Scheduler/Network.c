@@ -30,6 +30,13 @@ int *end_systems_hash;                      // Array that given the node id, mat
 long long int *different_periods;           // Array with the different periods for all frames
 int num_different_periods = 0;              // Number of different periods
 long long int hyper_period;                 // Hyper-period needed for the schedule
+int **symmetry_receivers;                   // Sorted receivers and routed paths of every frame, only to detect symmetries
+int link_type_overhead[3] = {0, 0, 0};      // Bytes of overhead added to every frame for each link type
+long long int link_type_guard_band[3] = {0, 0, 0};  // Guard band in ns after every transmission for each link type
+long long int *nodes_precision;             // Synchronization precision in ns of every node, 0 if perfectly synced
+int *links_source;                          // Node that transmits in every link, only for networks built in memory
+int *links_destination;                     // Node that receives from every link, only for networks built in memory
+int network_loaded = 0;                     // 1 once a network is parsed or built, a process only holds one
 
 /* PRIVATE FUNCTIONS */
 
@@ -68,6 +75,90 @@ long long int calculate_hyper_period() {
     return hyper_period;
 }
 
+/**
+ Compare the receiver and routed path pairs pointed by the given pointers, used to sort receivers
+
+ @param a pointer to the first pair
+ @param b pointer to the second pair
+ @return negative if a goes first, positive if b goes first, 0 if they are equal
+ */
+int compare_receiver_routes(const void *a, const void *b) {
+    
+    const int *pair_a = (const int*) a;
+    const int *pair_b = (const int*) b;
+    
+    if (pair_a[0] != pair_b[0]) {
+        return (pair_a[0] > pair_b[0]) - (pair_a[0] < pair_b[0]);
+    }
+    return (pair_a[1] > pair_b[1]) - (pair_a[1] < pair_b[1]);
+}
+
+/**
+ Compare two frames by all the parameters that make them interchangeable in the schedule (sender, receivers and their
+ routed paths, period, deadline, size, starting time, end to end delay and priority)
+
+ @param frame_a identifier of the first frame
+ @param frame_b identifier of the second frame
+ @return negative if a goes first, positive if b goes first, 0 if they are identical
+ */
+int compare_frames_parameters(int frame_a, int frame_b) {
+    
+    Frame *frame_a_pt = &frames[frame_a];
+    Frame *frame_b_pt = &frames[frame_b];
+    
+    if (frame_a_pt->sender_id != frame_b_pt->sender_id) {
+        return (frame_a_pt->sender_id > frame_b_pt->sender_id) ? 1 : -1;
+    }
+    if (frame_a_pt->num_receivers != frame_b_pt->num_receivers) {
+        return (frame_a_pt->num_receivers > frame_b_pt->num_receivers) ? 1 : -1;
+    }
+    if (frame_a_pt->period != frame_b_pt->period) {
+        return (frame_a_pt->period > frame_b_pt->period) ? 1 : -1;
+    }
+    if (frame_a_pt->deadline != frame_b_pt->deadline) {
+        return (frame_a_pt->deadline > frame_b_pt->deadline) ? 1 : -1;
+    }
+    if (frame_a_pt->size != frame_b_pt->size) {
+        return (frame_a_pt->size > frame_b_pt->size) ? 1 : -1;
+    }
+    if (frame_a_pt->starting != frame_b_pt->starting) {
+        return (frame_a_pt->starting > frame_b_pt->starting) ? 1 : -1;
+    }
+    if (frame_a_pt->end_to_end_delay != frame_b_pt->end_to_end_delay) {
+        return (frame_a_pt->end_to_end_delay > frame_b_pt->end_to_end_delay) ? 1 : -1;
+    }
+    if (frame_a_pt->priority != frame_b_pt->priority) {
+        return (frame_a_pt->priority > frame_b_pt->priority) ? 1 : -1;
+    }
+    // Receivers are pairs of receiver and routed path, so frames routed through different paths are not identical
+    for (int pair_it = 0; pair_it < 2 * frame_a_pt->num_receivers; pair_it++) {
+        if (symmetry_receivers[frame_a][pair_it] != symmetry_receivers[frame_b][pair_it]) {
+            return (symmetry_receivers[frame_a][pair_it] > symmetry_receivers[frame_b][pair_it]) ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ Compare two frames to sort them, identical frames are ordered by their identifier, so every group of identical frames
+ ends together and in increasing order after sorting
+
+ @param a pointer to the identifier of the first frame
+ @param b pointer to the identifier of the second frame
+ @return negative if a goes first, positive if b goes first, 0 if they are the same frame
+ */
+int compare_frames_symmetry(const void *a, const void *b) {
+    
+    int frame_a = *(const int*) a;
+    int frame_b = *(const int*) b;
+    int comparison = compare_frames_parameters(frame_a, frame_b);
+    
+    if (comparison != 0) {
+        return comparison;
+    }
+    return (frame_a > frame_b) - (frame_a < frame_b);
+}
+
 /**
  Read the switches information of the network from the given xml tree pointer
 
@@ -142,6 +233,101 @@ int read_self_healing_protocol_information_xml(xmlDocPtr file_network) {
     return 0;
 }
 
+/**
+ Read the optional overhead and guard band of every link type (wired, wireless or access point) from the given xml
+ tree pointer. If a link type is not described, its frames have no overhead and no guard band
+
+ @param file_network pointer to the top of the network xml tree
+ @return 0 if correctly read, error code otherwise
+ */
+int read_link_types_information_xml(xmlDocPtr file_network) {
+    
+    // Init xml variables needed to search information in the file
+    xmlChar *value;
+    xmlXPathContextPtr context, context_type = NULL;
+    xmlXPathObjectPtr result, result_type = NULL;
+    
+    LinkType link_type;
+    
+    // The parameters of a previous network do not apply to this one
+    for (int type_it = 0; type_it < 3; type_it++) {
+        link_type_overhead[type_it] = 0;
+        link_type_guard_band[type_it] = 0;
+    }
+    
+    // Seach on the xml tree where the link types are stored, as they are optional there might be none
+    context = xmlXPathNewContext(file_network);
+    result = xmlXPathEvalExpression((xmlChar*) "/Network/General_Information/Link_Types/Link_Type", context);
+    if (result->nodesetval == NULL || result->nodesetval->nodeTab == NULL) {
+        xmlXPathFreeObject(result);
+        xmlXPathFreeContext(context);
+        return 0;
+    }
+    
+    for (int type_it = 0; type_it < result->nodesetval->nodeNr; type_it++) {
+        context_type = xmlXPathNewContext(file_network);
+        xmlXPathSetContextNode(result->nodesetval->nodeTab[type_it], context_type);
+        
+        // Search the category of the current link type
+        value = xmlGetProp(result->nodesetval->nodeTab[type_it], (xmlChar*) "category");
+        if (xmlStrcmp(value, (xmlChar*) "LinkType.wired") == 0) {
+            link_type = wired;
+        } else if (xmlStrcmp(value, (xmlChar*) "LinkType.wireless") == 0) {
+            link_type = wireless;
+        } else if (xmlStrcmp(value, (xmlChar*) "LinkType.access_point") == 0) {
+            link_type = access_point;
+        } else {
+            printf("The link type has a unknown category\n");
+            xmlFree(value);
+            xmlXPathFreeContext(context_type);
+            xmlXPathFreeObject(result);
+            xmlXPathFreeContext(context);
+            return UNDEFINED_LINK_TYPE;
+        }
+        xmlFree(value);
+        
+        // Search the bytes of overhead (preamble, inter-frame gap and headers) of the link type
+        result_type = xmlXPathEvalExpression((xmlChar*) "Overhead", context_type);
+        if (result_type->nodesetval != NULL && result_type->nodesetval->nodeTab != NULL) {
+            value = xmlNodeListGetString(file_network, result_type->nodesetval->nodeTab[0]->xmlChildrenNode, 1);
+            link_type_overhead[link_type] = atoi((const char*) value);
+            xmlFree(value);
+            if (link_type_overhead[link_type] < 0) {
+                printf("The overhead of a link type cannot be negative\n");
+                xmlXPathFreeObject(result_type);
+                xmlXPathFreeContext(context_type);
+                xmlXPathFreeObject(result);
+                xmlXPathFreeContext(context);
+                return LINK_TYPE_PARAMETER_NEGATIVE;
+            }
+        }
+        xmlXPathFreeObject(result_type);
+        
+        // Search the guard band in ns of the link type
+        result_type = xmlXPathEvalExpression((xmlChar*) "Guard_Band", context_type);
+        if (result_type->nodesetval != NULL && result_type->nodesetval->nodeTab != NULL) {
+            value = xmlNodeListGetString(file_network, result_type->nodesetval->nodeTab[0]->xmlChildrenNode, 1);
+            link_type_guard_band[link_type] = atoll((const char*) value);
+            xmlFree(value);
+            if (link_type_guard_band[link_type] < 0) {
+                printf("The guard band of a link type cannot be negative\n");
+                xmlXPathFreeObject(result_type);
+                xmlXPathFreeContext(context_type);
+                xmlXPathFreeObject(result);
+                xmlXPathFreeContext(context);
+                return LINK_TYPE_PARAMETER_NEGATIVE;
+            }
+        }
+        xmlXPathFreeObject(result_type);
+        
+        xmlXPathFreeContext(context_type);
+    }
+    
+    xmlXPathFreeObject(result);
+    xmlXPathFreeContext(context);
+    return 0;
+}
+
 /**
  Read the general information of the network from the given xml tree pointer
  
@@ -196,6 +382,7 @@ int read_general_information_xml(xmlDocPtr file_network) {
     
     // Once we have the number of switches and end systems, we can initalize the end systems hash accelerator
     end_systems_hash = malloc(sizeof(int) * (number_switches + number_end_systems));
+    nodes_precision = calloc(number_switches + number_end_systems, sizeof(long long int));
     
     // Search the number of links in the network and save it
     result = xmlXPathEvalExpression((xmlChar*) "/Network/General_Information/Number_Links", context);
@@ -217,6 +404,10 @@ int read_general_information_xml(xmlDocPtr file_network) {
         printf("Error reading the self-healing protocol information\n");
         return READ_GENERAL_INFORMATION_ERROR;
     }
+    if (read_link_types_information_xml(file_network) < 0) {
+        printf("Error reading the link types information\n");
+        return READ_GENERAL_INFORMATION_ERROR;
+    }
     
     xmlXPathFreeContext(context);
     return 0;
@@ -239,6 +430,7 @@ int read_paths_information_xml(xmlDocPtr file_network) {
     int sender_id, receiver_id, link_char_it;
     char *link_char;
     int* path_array = NULL;
+    int path_result;
     
     // Seach on the xml tree where the paths are stored
     context = xmlXPathNewContext(file_network);
@@ -308,10 +500,18 @@ int read_paths_information_xml(xmlDocPtr file_network) {
                     link_char = strtok(NULL, ";");
                     link_char_it++;
                 }
-                add_path(sender_id, receiver_id, path_array, link_char_it);
-                
+                path_result = add_path(sender_id, receiver_id, path_array, link_char_it);
                 free(path_array);
                 xmlFree(value);
+                if (path_result < 0) {
+                    xmlXPathFreeObject(result_receiver);
+                    xmlXPathFreeContext(context_receiver);
+                    xmlXPathFreeObject(result_sender);
+                    xmlXPathFreeContext(context_sender);
+                    xmlXPathFreeObject(result);
+                    xmlXPathFreeContext(context);
+                    return path_result;
+                }
             }
             
             xmlXPathFreeObject(result_receiver);
@@ -341,7 +541,7 @@ int read_links_information_xml(xmlDocPtr file_network) {
     xmlXPathObjectPtr result, result_link = NULL;
     
     // Init variables to save the value of the link found
-    int speed, link_id;
+    int speed, link_id, source_id, link_result;
     LinkType link_type;
     
     // Seach on the xml tree where the links are stored
@@ -374,6 +574,8 @@ int read_links_information_xml(xmlDocPtr file_network) {
             link_type = wired;
         } else if (xmlStrcmp(value, (xmlChar*) "LinkType.wireless") == 0) {
             link_type = wireless;
+        } else if (xmlStrcmp(value, (xmlChar*) "LinkType.access_point") == 0) {
+            link_type = access_point;
         } else {
             printf("The link has a unknown category\n");
             return UNDEFINED_LINK_TYPE;
@@ -392,7 +594,37 @@ int read_links_information_xml(xmlDocPtr file_network) {
         xmlFree(value);
         xmlXPathFreeObject(result_link);
         
-        add_link(link_id, speed, link_type);
+        // The rest of the link is saved in the position of its identifier, so it has to be in range
+        link_result = add_link(link_id, speed, link_type);
+        if (link_result < 0) {
+            xmlXPathFreeContext(context_link);
+            xmlXPathFreeObject(result);
+            xmlXPathFreeContext(context);
+            return link_result;
+        }
+        
+        // Search the node that transmits in the link, optional as it is only needed for its precision
+        source_id = -1;
+        result_link = xmlXPathEvalExpression((xmlChar*) "Node_Source", context_link);
+        if (result_link->nodesetval != NULL && result_link->nodesetval->nodeTab != NULL) {
+            value = xmlNodeListGetString(file_network, result_link->nodesetval->nodeTab[0]->xmlChildrenNode, 1);
+            source_id = atoi((const char*) value);
+            xmlFree(value);
+        }
+        xmlXPathFreeObject(result_link);
+        
+        // Add the overhead and guard band of its type and the precision of its transmitting node
+        if (set_link_overhead(&links[link_id], link_type_overhead[link_type]) < 0 ||
+            set_link_guard_band(&links[link_id], link_type_guard_band[link_type]) < 0) {
+            printf("Error adding the link overhead and guard band\n");
+            return ERROR_ADDING_LINK;
+        }
+        if (source_id >= 0 && source_id < number_switches + number_end_systems) {
+            if (set_link_precision(&links[link_id], nodes_precision[source_id]) < 0) {
+                printf("Error adding the link precision\n");
+                return ERROR_ADDING_LINK;
+            }
+        }
         
         xmlXPathFreeContext(context_link);
     }
@@ -449,13 +681,22 @@ int read_nodes_information_xml(xmlDocPtr file_network) {
             end_systems_hash[node_id] = end_system_it;
             end_system_it++;
         } else if (xmlStrcmp(value, (xmlChar*) "switch") == 0) {
-            NULL;
+            end_systems_hash[node_id] = -1;
         } else {
             printf("The node has a unknown category\n");
             return UNDEFINED_NODE_TYPE;
         }
         xmlFree(value);
         
+        // Search the synchronization precision of the node, optional as by default nodes are perfectly synced
+        result_node = xmlXPathEvalExpression((xmlChar*) "Precision", context_node);
+        if (result_node->nodesetval != NULL && result_node->nodesetval->nodeTab != NULL) {
+            value = xmlNodeListGetString(file_network, result_node->nodesetval->nodeTab[0]->xmlChildrenNode, 1);
+            nodes_precision[node_id] = atoll((const char*) value);
+            xmlFree(value);
+        }
+        xmlXPathFreeObject(result_node);
+        
         xmlXPathFreeContext(context_node);
         
     }
@@ -483,6 +724,9 @@ int read_topology_information_xml(xmlDocPtr file_network) {
         printf("Error reading the links information\n");
         return READ_TOPOLOGY_ERROR;
     }
+    // The precision of the nodes is only needed to add it to the links where they transmit
+    free(nodes_precision);
+    nodes_precision = NULL;
     if (read_paths_information_xml(file_network) < 0) {
         printf("Error reading the paths information\n");
         return READ_TOPOLOGY_ERROR;
@@ -634,6 +878,24 @@ int read_frames_information_xml(xmlDocPtr file_network) {
         add_frame_information(frame_id, period, deadline, size, starting_time, end_to_end, sender_id, receivers_id,
                               num_receivers);
         
+        // Search the priority of the current frame, optional as by default all frames have the same priority
+        result_frame = xmlXPathEvalExpression((xmlChar*) "Priority", context_frame);
+        if (result_frame->nodesetval != NULL && result_frame->nodesetval->nodeTab != NULL) {
+            value = xmlNodeListGetString(file_network, result_frame->nodesetval->nodeTab[0]->xmlChildrenNode, 1);
+            if (set_priority(get_frame(frame_id), atoi((const char*) value)) < 0) {
+                printf("Error adding the frame priority\n");
+                xmlFree(value);
+                xmlXPathFreeObject(result_frame);
+                free(receivers_id);
+                xmlXPathFreeContext(context_frame);
+                xmlXPathFreeObject(result);
+                xmlXPathFreeContext(context);
+                return ERROR_ADDING_FRAME;
+            }
+            xmlFree(value);
+        }
+        xmlXPathFreeObject(result_frame);
+        
         free(receivers_id);
         xmlXPathFreeContext(context_frame);
     }
@@ -643,6 +905,204 @@ int read_frames_information_xml(xmlDocPtr file_network) {
     return 0;
 }
 
+/**
+ Count or discount the links of the routed path of the given receiver of the frame
+
+ @param frame_pt pointer to the frame
+ @param receiver_it index of the receiver in the frame
+ @param frame_links number of receivers of the frame that use every link
+ @param add 1 to count the links, -1 to discount them
+ */
+void update_frame_links(Frame *frame_pt, int receiver_it, int *frame_links, int add) {
+    
+    Path *path_pt = get_frame_path(frame_pt, receiver_it, 0);
+    
+    for (int link_it = 0; link_it < path_pt->length; link_it++) {
+        frame_links[path_pt->path[link_it]] += add;
+    }
+}
+
+/**
+ Add or remove the path of the given receiver of the frame from the link loads. A link only has the load of the
+ frame once, even if several receivers of the frame use it
+
+ @param frame_pt pointer to the frame
+ @param path_pt pointer to the path of the receiver
+ @param load utilization of every link
+ @param frame_links number of receivers of the frame that use every link
+ @param add 1 to add the path, -1 to remove it
+ */
+void update_routing_load(Frame *frame_pt, Path *path_pt, double *load, int *frame_links, int add) {
+    
+    int link;
+    
+    for (int link_it = 0; link_it < path_pt->length; link_it++) {
+        link = path_pt->path[link_it];
+        if (add == 1 && frame_links[link] == 0) {
+            load[link] += get_frame_link_utilization(frame_pt, link);
+        }
+        frame_links[link] += add;
+        if (add == -1 && frame_links[link] == 0) {
+            load[link] -= get_frame_link_utilization(frame_pt, link);
+        }
+    }
+}
+
+/**
+ Route the given receiver of the frame through the path with the lowest maximum link utilization once the frame is
+ added, and the lowest total utilization in case of tie. The current path is kept unless another one is better
+
+ @param frame_pt pointer to the frame
+ @param receiver_it index of the receiver in the frame
+ @param load utilization of every link, without the receiver
+ @param frame_links number of receivers of the frame that use every link, without the receiver
+ @return 1 if the path changed, 0 if not, error code otherwise
+ */
+int route_frame_receiver(Frame *frame_pt, int receiver_it, double *load, int *frame_links) {
+    
+    Path *path_pt;
+    int sender, receiver, num_paths;
+    int current_path, best_path = -1;
+    double path_max, path_sum, best_max = 0.0, best_sum = 0.0;
+    double link_load;
+    
+    sender = get_sender_id(frame_pt);
+    receiver = get_receiver_id(frame_pt, receiver_it);
+    num_paths = get_num_paths(sender, receiver);
+    if (num_paths <= 0) {
+        printf("There is no path between the sender and the receiver of a frame\n");
+        return NO_PATH_TO_ROUTE;
+    }
+    current_path = get_routed_path(frame_pt, receiver_it);
+    
+    for (int path_it = -1; path_it < num_paths; path_it++) {
+        // The current path is evaluated first, so the rest have to be strictly better to replace it
+        if (path_it == -1 && current_path < 0) {
+            continue;
+        }
+        if (path_it == current_path) {
+            continue;
+        }
+        path_pt = get_path(sender, receiver, path_it == -1 ? current_path : path_it);
+        path_max = 0.0;
+        path_sum = 0.0;
+        for (int link_it = 0; link_it < path_pt->length; link_it++) {
+            link_load = load[path_pt->path[link_it]];
+            if (frame_links[path_pt->path[link_it]] == 0) {
+                link_load += get_frame_link_utilization(frame_pt, path_pt->path[link_it]);
+            }
+            path_max = link_load > path_max ? link_load : path_max;
+            path_sum += link_load;
+        }
+        if (best_path == -1 || path_max < best_max || (path_max == best_max && path_sum < best_sum)) {
+            best_path = path_it == -1 ? current_path : path_it;
+            best_max = path_max;
+            best_sum = path_sum;
+        }
+    }
+    
+    set_routed_path(frame_pt, receiver_it, best_path);
+    update_routing_load(frame_pt, get_path(sender, receiver, best_path), load, frame_links, 1);
+    return best_path != current_path;
+}
+
+/**
+ Search the simple paths (without cycles) from the given node to the receiver end system and add them to the network
+
+ @param sender_id sender end system id of the paths
+ @param receiver_id receiver end system id of the paths
+ @param node_id node where the current path ends
+ @param path links of the current path
+ @param len_path number of links in the current path
+ @param visited 1 for every node already in the current path, 0 otherwise
+ @param max_paths maximum number of paths between the sender and the receiver, 0 if there is no limit
+ @return 0 if done correctly, error code otherwise
+ */
+int search_simple_paths(int sender_id, int receiver_id, int node_id, int *path, int len_path, int *visited,
+                        int max_paths) {
+    
+    int next_node;
+    
+    if (node_id == receiver_id) {
+        return add_path(sender_id, receiver_id, path, len_path);
+    }
+    
+    visited[node_id] = 1;
+    for (int link_it = 0; link_it < number_links; link_it++) {
+        if (max_paths > 0 && get_num_paths(sender_id, receiver_id) >= max_paths) {
+            break;
+        }
+        next_node = links_destination[link_it];
+        if (links_source[link_it] != node_id || visited[next_node] == 1) {
+            continue;
+        }
+        path[len_path] = link_it;
+        if (search_simple_paths(sender_id, receiver_id, next_node, path, len_path + 1, visited, max_paths) < 0) {
+            return ERROR_COMPUTING_PATHS;
+        }
+    }
+    visited[node_id] = 0;
+    
+    return 0;
+}
+
+/**
+ Search the path with the fewest links from the sender end system to the receiver end system and add it to the
+ network, if there is any
+
+ @param sender_id sender end system id of the path
+ @param receiver_id receiver end system id of the path
+ @param previous_link link used to arrive to every node, reused for every search
+ @param queue nodes to visit, reused for every search
+ @return 0 if done correctly, error code otherwise
+ */
+int search_shortest_path(int sender_id, int receiver_id, int *previous_link, int *queue) {
+    
+    int num_nodes = number_switches + number_end_systems;
+    int queue_start = 0, queue_end = 0;
+    int node_id, next_node, len_path = 0;
+    int *path;
+    
+    for (int node_it = 0; node_it < num_nodes; node_it++) {
+        previous_link[node_it] = -1;
+    }
+    queue[queue_end++] = sender_id;
+    
+    // Visit the nodes by their distance to the sender until the receiver is found
+    while (queue_start < queue_end && previous_link[receiver_id] == -1) {
+        node_id = queue[queue_start++];
+        for (int link_it = 0; link_it < number_links; link_it++) {
+            next_node = links_destination[link_it];
+            if (links_source[link_it] != node_id || next_node == sender_id || previous_link[next_node] != -1) {
+                continue;
+            }
+            previous_link[next_node] = link_it;
+            queue[queue_end++] = next_node;
+        }
+    }
+    if (previous_link[receiver_id] == -1) {
+        return 0;
+    }
+    
+    // Follow the links back from the receiver to the sender
+    for (node_id = receiver_id; node_id != sender_id; node_id = links_source[previous_link[node_id]]) {
+        len_path++;
+    }
+    path = malloc(sizeof(int) * len_path);
+    node_id = receiver_id;
+    for (int link_it = len_path - 1; link_it >= 0; link_it--) {
+        path[link_it] = previous_link[node_id];
+        node_id = links_source[previous_link[node_id]];
+    }
+    if (add_path(sender_id, receiver_id, path, len_path) < 0) {
+        free(path);
+        return ERROR_COMPUTING_PATHS;
+    }
+    
+    free(path);
+    return 0;
+}
+
 /* PUBLIC FUNCTIONS */
 
 /**
@@ -948,7 +1408,7 @@ Link * get_link(int link_id) {
  @param link_id index of the link
  @param speed integer with the speed of the link in MB/s
  @param link_type type of the link (wired or wireless)
- @return 0 if added correctly, -1 if out of index
+ @return 0 if added correctly, error code if the identifier is out of range
  */
 int add_link(int link_id, int speed, LinkType link_type) {
     
@@ -957,6 +1417,10 @@ int add_link(int link_id, int speed, LinkType link_type) {
         printf("There are more links that the stated in the network\n");
         return NO_MORE_LINKS_ALLOCATED;
     }
+    if (link_id < 0) {
+        printf("The link identifier cannot be negative\n");
+        return LINK_ID_OUT_OF_RANGE;
+    }
     
     // Save all the information
     if (set_link_type(&links[link_id], link_type) < 0) {
@@ -1049,6 +1513,45 @@ Path * get_path(int sender_id, int receiver_id, int path_id) {
     return &paths[sender_pos].receivers[receiver_pos].paths[path_id];
 }
 
+/**
+ Get the number of paths that the given receiver of the frame can use. If the frame was routed before scheduling, it
+ can only use the routed path
+ 
+ @param frame_pt pointer to the frame
+ @param receiver_it index of the receiver in the frame
+ @return the number of paths, error code otherwise
+ */
+int get_frame_num_paths(Frame *frame_pt, int receiver_it) {
+    
+    if (get_routed_path(frame_pt, receiver_it) >= 0) {
+        return 1;
+    }
+    return get_num_paths(get_sender_id(frame_pt), get_receiver_id(frame_pt, receiver_it));
+}
+
+/**
+ Get a path that the given receiver of the frame can use. If the frame was routed before scheduling, the only path is
+ the routed one
+ 
+ @param frame_pt pointer to the frame
+ @param receiver_it index of the receiver in the frame
+ @param path_it index of the path between 0 and the number of paths of the receiver of the frame
+ @return the path pointer, null if error occur
+ */
+Path * get_frame_path(Frame *frame_pt, int receiver_it, int path_it) {
+    
+    int routed_path = get_routed_path(frame_pt, receiver_it);
+    
+    if (routed_path >= 0) {
+        if (path_it != 0) {
+            printf("The frame was routed, it only has one path\n");
+            return NULL;
+        }
+        path_it = routed_path;
+    }
+    return get_path(get_sender_id(frame_pt), get_receiver_id(frame_pt, receiver_it), path_it);
+}
+
 /**
  Add a new path from the sender end system to the receiver end system
  
@@ -1068,9 +1571,19 @@ int add_path(int sender_id, int receiver_id, int* path, int len_path) {
         printf("The path does not exist\n");
         return PATH_DOES_NOT_EXIST;
     }
-    // Convert the given ids to the positions in the path structure
+    // Convert the given ids to the positions in the path structure, only the end systems have one
     sender_pos = end_systems_hash[sender_id];
     receiver_pos = end_systems_hash[receiver_id];
+    if (sender_pos < 0 || receiver_pos < 0) {
+        printf("The path has to connect two end systems\n");
+        return NODE_NOT_END_SYSTEM;
+    }
+    for (int link_it = 0; link_it < len_path; link_it++) {
+        if (path[link_it] < 0 || path[link_it] >= number_links) {
+            printf("The link %d of the path does not exist\n", path[link_it]);
+            return LINK_ID_OUT_OF_RANGE;
+        }
+    }
     
     // Add the path, first allocate memory for the next path, then allocate memory for the array of link ids, and save
     // every link one by one
@@ -1113,13 +1626,310 @@ float get_max_link_utilization(void) {
     return max_ut;
 }
 
+/**
+ Search the frames that are identical (same sender, receivers, period, deadline, size, starting time, end to end
+ delay and priority). As the paths only depend on the sender and receivers, they also share all their paths and any
+ schedule remains valid if we swap them. If the frames were routed, they also need the same routed paths. Every frame of a group is linked to the previous frame of the same group, so
+ the solver can order them and discard all the symmetric solutions.
+ Frames are sorted by their parameters, so it takes O(n log n) instead of comparing all pairs of frames
+
+ @return number of frames with a previous identical frame, error code otherwise
+ */
+int detect_symmetric_frames(void) {
+    
+    int *sorted_frames;
+    int num_symmetric = 0;
+    int num_receivers;
+    
+    sorted_frames = malloc(sizeof(int) * number_frames);
+    symmetry_receivers = malloc(sizeof(int *) * number_frames);
+    for (int frame_it = 0; frame_it < number_frames; frame_it++) {
+        // The order of the receivers does not matter, so we compare them sorted with the path where they are routed
+        num_receivers = get_num_receivers(&frames[frame_it]);
+        symmetry_receivers[frame_it] = malloc(sizeof(int) * 2 * num_receivers);
+        for (int receiver_it = 0; receiver_it < num_receivers; receiver_it++) {
+            symmetry_receivers[frame_it][2 * receiver_it] = get_receiver_id(&frames[frame_it], receiver_it);
+            symmetry_receivers[frame_it][2 * receiver_it + 1] = get_routed_path(&frames[frame_it], receiver_it);
+        }
+        qsort(symmetry_receivers[frame_it], num_receivers, sizeof(int) * 2, compare_receiver_routes);
+        sorted_frames[frame_it] = frame_it;
+        set_symmetric_frame(&frames[frame_it], -1);
+    }
+    
+    qsort(sorted_frames, number_frames, sizeof(int), compare_frames_symmetry);
+    
+    // Identical frames are now consecutive, link each one with the previous one of its group
+    for (int sorted_it = 1; sorted_it < number_frames; sorted_it++) {
+        if (compare_frames_parameters(sorted_frames[sorted_it - 1], sorted_frames[sorted_it]) == 0) {
+            set_symmetric_frame(&frames[sorted_frames[sorted_it]], sorted_frames[sorted_it - 1]);
+            num_symmetric++;
+        }
+    }
+    
+    for (int frame_it = 0; frame_it < number_frames; frame_it++) {
+        free(symmetry_receivers[frame_it]);
+    }
+    free(symmetry_receivers);
+    symmetry_receivers = NULL;
+    free(sorted_frames);
+    
+    return num_symmetric;
+}
+
+/**
+ Get the utilization of the given link
+ 
+ @param link_id identifier of the link
+ @return utilization of the link [0.0, 1.0], error code otherwise
+ */
+float get_link_utilization(int link_id) {
+    
+    if (link_id < 0 || link_id >= number_links) {
+        printf("The link identifier is out of range\n");
+        return LINK_ID_OUT_OF_RANGE;
+    }
+    
+    return links_utilization[link_id];
+}
+
+/**
+ Get the minimum separation between the end of a transmission and the start of the next one in the given link.
+ It is the guard band of the link plus the synchronization precision of the node that transmits in it
+
+ @param link_id identifier of the link
+ @return separation in ns, error code otherwise
+ */
+long long int get_link_separation(int link_id) {
+    
+    if (link_id < 0 || link_id >= number_links) {
+        printf("The link identifier is out of range\n");
+        return LINK_ID_OUT_OF_RANGE;
+    }
+    
+    return get_link_guard_band(&links[link_id]) + get_link_precision(&links[link_id]);
+}
+
+/**
+ Get an upper bound of the minimum spacing between two transmissions of the same link. A link with n transmissions in
+ the hyper-period cannot separate all of them by more than the time left by their transmission times over n - 1. It
+ assumes that all the offsets that are not excluded are used (no path selection)
+ 
+ @return spacing in ns, the hyper-period if no link has two transmissions
+ */
+long long int get_max_link_spacing(void) {
+    
+    Offset *offset_pt;
+    long long int *busy_time;                           // Time transmitting in every link
+    long long int *num_transmissions;                   // Transmissions in every link
+    long long int max_spacing = hyper_period;
+    
+    busy_time = calloc(number_links, sizeof(long long int));
+    num_transmissions = calloc(number_links, sizeof(long long int));
+    for (int frame_it = 0; frame_it < number_frames; frame_it++) {
+        offset_pt = get_offset_root(&frames[frame_it]);
+        while (!is_last_offset(offset_pt)) {
+            if (get_offset_state(offset_pt) != offset_excluded) {
+                num_transmissions[offset_pt->link] += get_num_instances(offset_pt) * get_num_replicas(offset_pt);
+                busy_time[offset_pt->link] += (long long int) get_num_instances(offset_pt) *
+                                              get_num_replicas(offset_pt) * get_timeslot_size(offset_pt);
+            }
+            offset_pt = get_next_offset(offset_pt);
+        }
+    }
+    for (int link_it = 0; link_it < number_links; link_it++) {
+        if (num_transmissions[link_it] > 1 &&
+            (hyper_period - busy_time[link_it]) / (num_transmissions[link_it] - 1) < max_spacing) {
+            max_spacing = (hyper_period - busy_time[link_it]) / (num_transmissions[link_it] - 1);
+        }
+    }
+    free(busy_time);
+    free(num_transmissions);
+    
+    return max_spacing > 0 ? max_spacing : 0;
+}
+
+/**
+ Narrow the transmission window of every offset with the distances along the paths of its frame, the end to end delay
+ and the offsets that are already fixed. It assumes that all the paths of the frames are used (no path selection).
+ A frame can share offsets between its paths, so the windows are propagated until none of them changes
+ 
+ @return 0 if done correctly, error code if an offset cannot be transmitted in any time
+ */
+int propagate_offset_windows(void) {
+    
+    Frame *frame_pt;
+    Offset *offset_pt, *next_offset_pt, *first_offset_pt, *last_offset_pt;
+    Path *path_pt;
+    int changed, scheduled;
+    long long int bound;
+    long long int available;                            // Time available between the first and last offset
+    
+    for (int frame_it = 0; frame_it < number_frames; frame_it++) {
+        frame_pt = &frames[frame_it];
+        
+        // Frames with all their offsets excluded are not in the current stage, their windows do not matter yet
+        scheduled = 0;
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            if (get_offset_state(offset_pt) != offset_excluded) {
+                scheduled = 1;
+            }
+            offset_pt = get_next_offset(offset_pt);
+        }
+        if (scheduled == 0) {
+            continue;
+        }
+        
+        // Start with the window given by the frame, or the transmission time if it is already fixed
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            if (get_offset_state(offset_pt) == offset_fixed) {
+                offset_pt->earliest = get_offset(offset_pt, 0, 0);
+                offset_pt->latest = get_offset(offset_pt, 0, 0);
+            } else {
+                // Transmission time 0 is reserved for offsets that are not used
+                offset_pt->earliest = get_starting(frame_pt) > 0 ? get_starting(frame_pt) : 1;
+                offset_pt->latest = get_deadline(frame_pt) - get_timeslot_size(offset_pt);
+            }
+            offset_pt = get_next_offset(offset_pt);
+        }
+        
+        do {
+            changed = 0;
+            for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+                for (int path_it = 0; path_it < get_frame_num_paths(frame_pt, receiver_it); path_it++) {
+                    path_pt = get_frame_path(frame_pt, receiver_it, path_it);
+                    
+                    // The next hop cannot start until the previous one is transmitted and waited in the switch
+                    for (int link_it = 0; link_it < path_pt->length - 1; link_it++) {
+                        offset_pt = get_frame_offset_by_link(frame_pt, path_pt->path[link_it]);
+                        next_offset_pt = get_frame_offset_by_link(frame_pt, path_pt->path[link_it + 1]);
+                        bound = offset_pt->earliest + get_timeslot_size(offset_pt) + get_switch_minimum_time();
+                        if (bound > next_offset_pt->earliest) {
+                            next_offset_pt->earliest = bound;
+                            changed = 1;
+                        }
+                    }
+                    // The previous hop has to finish in time for the next one
+                    for (int link_it = path_pt->length - 2; link_it >= 0; link_it--) {
+                        offset_pt = get_frame_offset_by_link(frame_pt, path_pt->path[link_it]);
+                        next_offset_pt = get_frame_offset_by_link(frame_pt, path_pt->path[link_it + 1]);
+                        bound = next_offset_pt->latest - get_timeslot_size(offset_pt) - get_switch_minimum_time();
+                        if (bound < offset_pt->latest) {
+                            offset_pt->latest = bound;
+                            changed = 1;
+                        }
+                    }
+                    // The first and last hops are limited by the end to end delay
+                    first_offset_pt = get_frame_offset_by_link(frame_pt, path_pt->path[0]);
+                    last_offset_pt = get_frame_offset_by_link(frame_pt, path_pt->path[path_pt->length - 1]);
+                    available = get_end_to_end_delay(frame_pt) - get_timeslot_size(last_offset_pt);
+                    if (first_offset_pt->latest + available < last_offset_pt->latest) {
+                        last_offset_pt->latest = first_offset_pt->latest + available;
+                        changed = 1;
+                    }
+                    if (last_offset_pt->earliest - available > first_offset_pt->earliest) {
+                        first_offset_pt->earliest = last_offset_pt->earliest - available;
+                        changed = 1;
+                    }
+                }
+            }
+            
+            offset_pt = get_offset_root(frame_pt);
+            while (!is_last_offset(offset_pt)) {
+                if (offset_pt->earliest > offset_pt->latest) {
+                    printf("The frame %d cannot be transmitted in the link %d\n", frame_it, get_offset_link(offset_pt));
+                    return INFEASIBLE_OFFSET_WINDOW;
+                }
+                offset_pt = get_next_offset(offset_pt);
+            }
+        } while (changed == 1);
+    }
+    
+    return 0;
+}
+
+/**
+ Get the utilization that one frame adds to the given link, its transmission time divided by its period
+
+ @param frame_pt pointer to the frame
+ @param link_id identifier of the link
+ @return utilization of the frame in the link
+ */
+double get_frame_link_utilization(Frame *frame_pt, int link_id) {
+    
+    long long int time;
+    
+    time = ((get_size(frame_pt) + get_link_overhead(&links[link_id])) * 1000) / get_link_speed(&links[link_id]);
+    return time / (double) get_period(frame_pt);
+}
+
+/**
+ Choose one path for every receiver of every frame before scheduling, so the solver does not have to route them.
+ Paths are chosen greedily to minimize the maximum link utilization, counting once the links shared by the paths of
+ the same frame. Then, every receiver is ripped up and rerouted with the load of the rest, until no path changes or
+ the given number of iterations is reached. It has to be called before initializing the network
+ 
+ @param iterations maximum number of rip-up and reroute iterations
+ @return number of iterations done, error code otherwise
+ */
+int route_frames(int iterations) {
+    
+    Frame *frame_pt;
+    double *load;                           // Utilization of every link with the routed frames
+    int *frame_links;                       // Number of receivers of the current frame that use every link
+    int changed, result;
+    int iteration = 0;
+    
+    load = calloc(number_links, sizeof(double));
+    frame_links = calloc(number_links, sizeof(int));
+    
+    // The first iteration routes all the receivers greedily, the next ones rip up and reroute them
+    do {
+        changed = 0;
+        for (int frame_it = 0; frame_it < number_frames; frame_it++) {
+            frame_pt = &frames[frame_it];
+            // Count the links used by the receivers of the frame that are already routed
+            for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+                if (get_routed_path(frame_pt, receiver_it) >= 0) {
+                    update_frame_links(frame_pt, receiver_it, frame_links, 1);
+                }
+            }
+            for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+                if (get_routed_path(frame_pt, receiver_it) >= 0) {
+                    update_routing_load(frame_pt, get_frame_path(frame_pt, receiver_it, 0), load, frame_links, -1);
+                }
+                result = route_frame_receiver(frame_pt, receiver_it, load, frame_links);
+                if (result < 0) {
+                    // Frames are not left half routed, all of them can use all their paths again
+                    for (int clear_it = 0; clear_it < number_frames; clear_it++) {
+                        clear_routed_paths(&frames[clear_it]);
+                    }
+                    free(load);
+                    free(frame_links);
+                    return result;
+                }
+                changed += result;
+            }
+            // Leave the link counters empty for the next frame
+            for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+                update_frame_links(frame_pt, receiver_it, frame_links, -1);
+            }
+        }
+        iteration++;
+    } while (changed > 0 && iteration <= iterations);
+    
+    free(load);
+    free(frame_links);
+    return iteration;
+}
+
 /**
  Init all the needed variables in the network to start the scheduling, such as frame appearances, instances and similar
  */
 void initialize_network(void) {
     
     int instances, num_receivers, num_paths, time;
-    int receiver_id;
     float ut;
     Path *path;
     Offset *offset_pt, *new_offset_pt;
@@ -1136,10 +1946,9 @@ void initialize_network(void) {
         // For all the possible paths, create the possible offsets
         num_receivers = get_num_receivers(&frames[frame_id]);
         for (int receiver_it = 0; receiver_it < num_receivers; receiver_it++) {     // For all receivers
-            receiver_id = get_receiver_id(&frames[frame_id], receiver_it);
-            num_paths = get_num_paths(get_sender_id(&frames[frame_id]), receiver_id);
+            num_paths = get_frame_num_paths(&frames[frame_id], receiver_it);
             for (int path_it = 0; path_it < num_paths; path_it++) {                 // For all paths
-                path = get_path(get_sender_id(&frames[frame_id]), receiver_id, path_it);
+                path = get_frame_path(&frames[frame_id], receiver_it, path_it);
                 for (int link_it = 0; link_it < path->length; link_it++) {           // For all links in path
                     new_offset_pt = add_new_offset(offset_pt, path->path[link_it]);  // Add the new offset
                     if (new_offset_pt != NULL) {       // If the offset is new add needed information
@@ -1149,10 +1958,17 @@ void initialize_network(void) {
                         if (links[get_offset_link(new_offset_pt)].type == wired) {
                             set_replicas(new_offset_pt, 1);                         // Only "1" replica if is wired
                         }
-                        // Calculate the time to transmit as BytesFrame / Speed in MB/s * 10^6 (to get to ns)
-                        time = (get_size(&frames[frame_id]) * 1000) /
+                        // Calculate the time to transmit as (BytesFrame + BytesOverhead) / Speed in MB/s * 10^6
+                        // (to get to ns), where the overhead of the link type includes preamble, IFG and headers
+                        time = ((get_size(&frames[frame_id]) +
+                                 get_link_overhead(&links[get_offset_link(new_offset_pt)])) * 1000) /
                                 get_link_speed(&links[get_offset_link(new_offset_pt)]);
                         set_timeslot_size(new_offset_pt, time);
+                        // By default it can be transmitted in any time between the starting time and the deadline
+                        // Transmission time 0 is reserved for offsets that are not used
+                        set_offset_window(new_offset_pt,
+                                          get_starting(&frames[frame_id]) > 0 ? get_starting(&frames[frame_id]) : 1,
+                                          get_deadline(&frames[frame_id]) - time);
                         
                         // At the end, we prepare the offset to be ready, which allocates for transmission times
                         prepare_offset(new_offset_pt);
@@ -1173,6 +1989,7 @@ void initialize_network(void) {
  Then continues with the important information from the network components description (links and its speeds).
  It also reads all the possible paths from different nodes.
  It ends with the information of each frame.
+ A process only holds one network, so it fails if a network was already parsed or built.
  
  @param filename name of the xml input file
  @return 0 if correctly read, error code otherwise
@@ -1181,6 +1998,11 @@ int parse_network_xml(char *filename) {
     
     xmlDocPtr file_network;       // Pointer where all the xml network file will be saved
     
+    if (network_loaded == 1) {
+        printf("A process only holds one network, and it was already loaded\n");
+        return NETWORK_ALREADY_LOADED;
+    }
+    network_loaded = 1;
     file_network = xmlReadFile(filename, NULL, 0);
     if (file_network == NULL) {
         printf("The xml network file does not exist\n");
@@ -1205,12 +2027,354 @@ int parse_network_xml(char *filename) {
 }
 
 /**
- Write the obtained schedule in a XML file with all the paths and transmission times of all the frames
+ Start a network built in memory instead of parsed from a xml file. The network starts empty and every structure grows
+ with the nodes, links, paths and frames added to it, nodes before the links and paths that connect them and frames
+ once there is any link. It ends with finalize_network(). As with the parsed networks, a process only holds one
+ network, so it fails if a network was already parsed or built
+
+ @return 0 if done correctly, error code otherwise
+ */
+int create_network(void) {
+    
+    if (network_loaded == 1) {
+        printf("A process only holds one network, and it was already loaded\n");
+        return NETWORK_ALREADY_LOADED;
+    }
+    network_loaded = 1;
+    number_frames = 0;
+    number_switches = 0;
+    number_end_systems = 0;
+    number_links = 0;
+    frames = NULL;
+    links = NULL;
+    links_utilization = NULL;
+    links_source = NULL;
+    links_destination = NULL;
+    paths = NULL;
+    end_systems_hash = NULL;
+    nodes_precision = NULL;
+    different_periods = NULL;
+    num_different_periods = 0;
+    for (int type_it = 0; type_it < 3; type_it++) {
+        link_type_overhead[type_it] = 0;
+        link_type_guard_band[type_it] = 0;
+    }
+    return 0;
+}
+
+/**
+ Set the overhead and the guard band of all the links of the given type of a network built in memory, applied to its
+ links when the network is finalized
+
+ @param link_type type of the links
+ @param overhead bytes added to every frame on the links (preamble, IFG and headers)
+ @param guard_band guard band in ns left after every transmission in the links
+ @return 0 if done correctly, error code otherwise
+ */
+int set_link_type_parameters(LinkType link_type, int overhead, long long int guard_band) {
+    
+    if (link_type != wired && link_type != wireless && link_type != access_point) {
+        printf("The link type has a unknown category\n");
+        return UNDEFINED_LINK_TYPE;
+    }
+    if (overhead < 0 || guard_band < 0) {
+        printf("The overhead and the guard band of a link type cannot be negative\n");
+        return LINK_TYPE_PARAMETER_NEGATIVE;
+    }
+    link_type_overhead[link_type] = overhead;
+    link_type_guard_band[link_type] = guard_band;
+    return 0;
+}
+
+/**
+ Add a new node to the network built in memory. Nodes are identified by the order they are added, starting from 0,
+ and every new end system is given its place in the path structure
+
+ @param node_type type of the node (switch or end system)
+ @param precision synchronization precision of the node in ns, 0 if it is perfectly synced
+ @return identifier of the new node, error code otherwise
+ */
+int add_network_node(NodeType node_type, long long int precision) {
+    
+    int node_id = number_switches + number_end_systems;
+    
+    if (node_type != switch_node && node_type != end_system_node) {
+        printf("The node has a unknown category\n");
+        return UNDEFINED_NODE_TYPE;
+    }
+    if (precision < 0) {
+        printf("The precision of a node cannot be negative\n");
+        return NODE_PRECISION_NEGATIVE;
+    }
+    
+    end_systems_hash = realloc(end_systems_hash, sizeof(int) * (node_id + 1));
+    nodes_precision = realloc(nodes_precision, sizeof(long long int) * (node_id + 1));
+    nodes_precision[node_id] = precision;
+    if (node_type == switch_node) {
+        end_systems_hash[node_id] = -1;
+        number_switches++;
+        return node_id;
+    }
+    
+    // Grow the path structure with a new sender and a new receiver in every sender, all of them without paths
+    end_systems_hash[node_id] = number_end_systems;
+    number_end_systems++;
+    paths = realloc(paths, sizeof(PathSender) * number_end_systems);
+    paths[number_end_systems - 1].receivers = NULL;
+    for (int sender_it = 0; sender_it < number_end_systems; sender_it++) {
+        paths[sender_it].receivers = realloc(paths[sender_it].receivers, sizeof(PathReceiver) * number_end_systems);
+        for (int receiver_it = sender_it == number_end_systems - 1 ? 0 : number_end_systems - 1;
+             receiver_it < number_end_systems; receiver_it++) {
+            paths[sender_it].receivers[receiver_it].num_paths = 0;
+            paths[sender_it].receivers[receiver_it].paths = NULL;
+        }
+    }
+    return node_id;
+}
+
+/**
+ Add a new link between two nodes of the network built in memory. Links are identified by the order they are added,
+ starting from 0, and they take the precision of the node that transmits in them
+
+ @param source_id node that transmits in the link
+ @param destination_id node that receives from the link
+ @param speed integer with the speed of the link in MB/s
+ @param link_type type of the link (wired or wireless)
+ @return identifier of the new link, error code otherwise
+ */
+int add_network_link(int source_id, int destination_id, int speed, LinkType link_type) {
+    
+    int link_id = number_links;
+    
+    if (source_id < 0 || source_id >= number_switches + number_end_systems || destination_id < 0 ||
+        destination_id >= number_switches + number_end_systems || source_id == destination_id) {
+        printf("The link has to connect two different nodes of the network\n");
+        return NODE_ID_OUT_OF_RANGE;
+    }
+    
+    number_links++;
+    links = realloc(links, sizeof(Link) * number_links);
+    links_utilization = realloc(links_utilization, sizeof(float) * number_links);
+    links_source = realloc(links_source, sizeof(int) * number_links);
+    links_destination = realloc(links_destination, sizeof(int) * number_links);
+    init_link(&links[link_id]);
+    links_utilization[link_id] = 0.0;
+    links_source[link_id] = source_id;
+    links_destination[link_id] = destination_id;
+    
+    if (add_link(link_id, speed, link_type) < 0 ||
+        set_link_precision(&links[link_id], nodes_precision[source_id]) < 0) {
+        number_links--;
+        printf("Error adding the link\n");
+        return ERROR_ADDING_LINK;
+    }
+    return link_id;
+}
+
+/**
+ Add all the paths between every pair of end systems of the network built in memory that do not have any path yet,
+ so paths given with add_path() are kept. Paths follow the links from their source node to their destination node,
+ as the Network Generator does
+
+ @param shortest_path 1 to add only one path with the fewest links, 0 to add all the simple paths
+ @param max_paths maximum number of simple paths between two end systems, 0 if there is no limit
+ @return 0 if done correctly, error code otherwise
+ */
+int compute_network_paths(int shortest_path, int max_paths) {
+    
+    int num_nodes = number_switches + number_end_systems;
+    int *path, *visited, *previous_link, *queue;
+    int result = 0;
+    
+    if (number_links <= 0 || links_source == NULL) {
+        printf("The paths can only be computed for a network built in memory with links\n");
+        return ERROR_COMPUTING_PATHS;
+    }
+    
+    path = malloc(sizeof(int) * num_nodes);
+    visited = calloc(num_nodes, sizeof(int));
+    previous_link = malloc(sizeof(int) * num_nodes);
+    queue = malloc(sizeof(int) * num_nodes);
+    
+    for (int sender_id = 0; sender_id < num_nodes && result == 0; sender_id++) {
+        for (int receiver_id = 0; receiver_id < num_nodes && result == 0; receiver_id++) {
+            if (sender_id == receiver_id || end_systems_hash[sender_id] < 0 || end_systems_hash[receiver_id] < 0 ||
+                get_num_paths(sender_id, receiver_id) > 0) {
+                continue;
+            }
+            if (shortest_path == 1) {
+                result = search_shortest_path(sender_id, receiver_id, previous_link, queue);
+            } else {
+                result = search_simple_paths(sender_id, receiver_id, sender_id, path, 0, visited, max_paths);
+            }
+        }
+    }
+    
+    free(path);
+    free(visited);
+    free(previous_link);
+    free(queue);
+    if (result < 0) {
+        printf("Error computing the paths of the network\n");
+        return ERROR_COMPUTING_PATHS;
+    }
+    return 0;
+}
+
+/**
+ Add a new frame to the network built in memory. Frames are identified by the order they are added, starting from 0.
+ The pointers to the frames given before are not valid after adding a new one, as the array of frames can move
+
+ @param period long long int of the period in ns
+ @param deadline long long int of the deadline in ns
+ @param size int of the size in bytes
+ @param starting_time long long int of the starting time of the frame in ns
+ @param end_to_end long long int of the end to end delay in ns
+ @param sender_id sender identifier
+ @param receivers_id pointer to the array of receivers id
+ @param num_receivers number of receivers in the array
+ @return identifier of the new frame, error code otherwise
+ */
+int add_network_frame(long long int period, long long int deadline, int size, long long int starting_time,
+                      long long int end_to_end, int sender_id, int *receivers_id, int num_receivers) {
+    
+    int frame_id = number_frames;
+    
+    if (number_links <= 0) {
+        printf("The frames can only be added once the network has links\n");
+        return ERROR_ADDING_FRAME;
+    }
+    number_frames++;
+    frames = realloc(frames, sizeof(Frame) * number_frames);
+    // The frame starts empty, so the arrays that were not allocated yet are NULL if it has to be freed
+    memset(&frames[frame_id], 0, sizeof(Frame));
+    if (add_frame_information(frame_id, period, deadline, size, starting_time, end_to_end, sender_id, receivers_id,
+                              num_receivers) < 0) {
+        free(frames[frame_id].offset_ls);
+        free(frames[frame_id].receivers_id);
+        number_frames--;
+        return ERROR_ADDING_FRAME;
+    }
+    return frame_id;
+}
+
+/**
+ Finish the network built in memory so it can be prepared to be scheduled as a parsed one. It checks that the sender
+ and the receivers of every frame are end systems connected by at least one path, and it sizes the structures that
+ depend on the final number of links
+
+ @return 0 if done correctly, error code otherwise
+ */
+int finalize_network(void) {
+    
+    Frame *frame_pt;
+    int num_nodes = number_switches + number_end_systems;
+    int sender_id, receiver_id;
+    
+    if (number_end_systems <= 0 || number_links <= 0 || number_frames <= 0) {
+        printf("The network needs at least one end system, one link and one frame\n");
+        return NETWORK_NOT_COMPLETE;
+    }
+    
+    // The links take the overhead and guard band of their type
+    for (int link_it = 0; link_it < number_links; link_it++) {
+        if (set_link_overhead(&links[link_it], link_type_overhead[get_link_type(&links[link_it])]) < 0 ||
+            set_link_guard_band(&links[link_it], link_type_guard_band[get_link_type(&links[link_it])]) < 0) {
+            printf("Error adding the link overhead and guard band\n");
+            return ERROR_ADDING_LINK;
+        }
+    }
+    
+    for (int frame_it = 0; frame_it < number_frames; frame_it++) {
+        frame_pt = &frames[frame_it];
+        sender_id = get_sender_id(frame_pt);
+        if (sender_id < 0 || sender_id >= num_nodes || end_systems_hash[sender_id] < 0) {
+            printf("The sender of the frame %d is not an end system\n", frame_it);
+            return NODE_NOT_END_SYSTEM;
+        }
+        for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+            receiver_id = get_receiver_id(frame_pt, receiver_it);
+            if (receiver_id < 0 || receiver_id >= num_nodes || end_systems_hash[receiver_id] < 0) {
+                printf("A receiver of the frame %d is not an end system\n", frame_it);
+                return NODE_NOT_END_SYSTEM;
+            }
+            // A receiver that is the sender itself needs no path, as in the parsed networks
+            if (receiver_id != sender_id && get_num_paths(sender_id, receiver_id) <= 0) {
+                printf("There is no path between the sender and the receiver %d of the frame %d\n", receiver_id,
+                       frame_it);
+                return NO_PATH_TO_ROUTE;
+            }
+        }
+        // The hash of the offsets has one place for every link, that might have been added after the frame
+        free(frame_pt->offset_hash);
+        init_hash(frame_pt, number_links);
+    }
+    // The precision of the nodes is only needed to add the links
+    free(nodes_precision);
+    nodes_precision = NULL;
+    
+    return 0;
+}
+
+/**
+ Write the obtained schedule in a XML file with all the paths and transmission times of all the frames, and which
+ frames were rejected if not all of them could be scheduled
  
  @param namefile path and name of the xml file to create with the written schedule
  @return 0 if correctly written, -1 otherwise
  */
 int write_schedule_xml(char* namefile) {
     
+    xmlDocPtr schedule_file;
+    xmlNodePtr root_node, frame_node, link_node, instance_node, replica_node;
+    Frame *frame_pt;
+    Offset *offset_pt;
+    char value[100];
+    
+    schedule_file = xmlNewDoc(BAD_CAST "1.0");
+    root_node = xmlNewNode(NULL, BAD_CAST "Schedule");
+    xmlDocSetRootElement(schedule_file, root_node);
+    sprintf(value, "%lld", get_hyper_period());
+    xmlNewChild(root_node, NULL, BAD_CAST "Hyper_Period", BAD_CAST value);
+    
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        frame_node = xmlNewChild(root_node, NULL, BAD_CAST "Frame", NULL);
+        sprintf(value, "%d", frame_it);
+        xmlNewChild(frame_node, NULL, BAD_CAST "FrameID", BAD_CAST value);
+        // Rejected frames are not transmitted, so they have no links
+        if (get_rejected(frame_pt) == 1) {
+            xmlNewChild(frame_node, NULL, BAD_CAST "Rejected", BAD_CAST "1");
+        }
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            // Only the offsets of links used by the chosen paths are transmitted
+            if (get_rejected(frame_pt) == 0 && get_offset_chosen(offset_pt) == 1) {
+                link_node = xmlNewChild(frame_node, NULL, BAD_CAST "Link", NULL);
+                sprintf(value, "%d", get_offset_link(offset_pt));
+                xmlNewChild(link_node, NULL, BAD_CAST "LinkID", BAD_CAST value);
+                for (int instance = 0; instance < get_num_instances(offset_pt); instance++) {
+                    instance_node = xmlNewChild(link_node, NULL, BAD_CAST "Instance", NULL);
+                    sprintf(value, "%d", instance);
+                    xmlNewChild(instance_node, NULL, BAD_CAST "NumInstance", BAD_CAST value);
+                    for (int replica = 0; replica < get_num_replicas(offset_pt); replica++) {
+                        replica_node = xmlNewChild(instance_node, NULL, BAD_CAST "Replica", NULL);
+                        sprintf(value, "%d", replica);
+                        xmlNewChild(replica_node, NULL, BAD_CAST "NumReplica", BAD_CAST value);
+                        sprintf(value, "%lld", get_offset(offset_pt, instance, replica));
+                        xmlNewChild(replica_node, NULL, BAD_CAST "Transmission_Time", BAD_CAST value);
+                    }
+                }
+            }
+            offset_pt = get_next_offset(offset_pt);
+        }
+    }
+    
+    if (xmlSaveFormatFileEnc(namefile, schedule_file, "UTF-8", 1) < 0) {
+        printf("The schedule file could not be written\n");
+        xmlFreeDoc(schedule_file);
+        return -1;
+    }
+    xmlFreeDoc(schedule_file);
     return 0;
 }
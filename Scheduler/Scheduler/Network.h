@@ -13,6 +13,7 @@
  *  as done with the application constraints, period and deadlines.                                                    *
  *  It also contains function to read the network file and being able to write the schedule of it once it has been     *
  *  filled.                                                                                                            *
+ *  A network can also be built in memory, growing with every node, link, path and frame added to it.                  *
  *                                                                                                                     *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
@@ -31,6 +32,14 @@
 
 /* STRUCT DEFINITIONS */
 
+/**
+ Types of nodes of a network built in memory
+ */
+typedef enum NodeType {
+    switch_node,                        // Forwards the frames from its input links to its output links
+    end_system_node                     // Sends and receives frames
+}NodeType;
+
 typedef struct Path {
     int length;
     int *path;
@@ -68,6 +77,16 @@ typedef struct PathSender {
 #define UNDEFINED_LINK_TYPE -13
 #define NO_MORE_LINKS_ALLOCATED -14
 #define ERROR_ADDING_LINK -15
+#define LINK_ID_OUT_OF_RANGE -16
+#define INFEASIBLE_OFFSET_WINDOW -17
+#define LINK_TYPE_PARAMETER_NEGATIVE -18
+#define NO_PATH_TO_ROUTE -19
+#define NODE_ID_OUT_OF_RANGE -20
+#define NODE_NOT_END_SYSTEM -21
+#define NODE_PRECISION_NEGATIVE -22
+#define ERROR_COMPUTING_PATHS -23
+#define NETWORK_NOT_COMPLETE -24
+#define NETWORK_ALREADY_LOADED -25
 #define READ_GENERAL_INFORMATION_ERROR -101
 #define READ_FRAMES_ERROR -102
 #define READ_TOPOLOGY_ERROR -103
@@ -250,7 +269,7 @@ Link * get_link(int link_id);
  @param link_id index of the link
  @param speed integer with the speed of the link in MB/s
  @param link_type type of the link (wired or wireless)
- @return 0 if added correctly, -1 if out of index
+ @return 0 if added correctly, error code if the identifier is out of range
  */
 int add_link(int link_id, int speed, LinkType link_type);
 
@@ -280,6 +299,27 @@ int get_num_paths(int sender_id, int receiver_id);
  */
 Path * get_path(int sender_id, int receiver_id, int path_id);
 
+/**
+ Get the number of paths that the given receiver of the frame can use. If the frame was routed before scheduling, it
+ can only use the routed path
+
+ @param frame_pt pointer to the frame
+ @param receiver_it index of the receiver in the frame
+ @return the number of paths, error code otherwise
+ */
+int get_frame_num_paths(Frame *frame_pt, int receiver_it);
+
+/**
+ Get a path that the given receiver of the frame can use. If the frame was routed before scheduling, the only path is
+ the routed one
+
+ @param frame_pt pointer to the frame
+ @param receiver_it index of the receiver in the frame
+ @param path_it index of the path between 0 and the number of paths of the receiver of the frame
+ @return the path pointer, null if error occur
+ */
+Path * get_frame_path(Frame *frame_pt, int receiver_it, int path_it);
+
 /**
  Add a new path from the sender end system to the receiver end system
 
@@ -305,11 +345,156 @@ long long int get_hyper_period(void);
  */
 float get_max_link_utilization(void);
 
+/**
+ Search the frames that are identical (same sender, receivers, period, deadline, size, starting time, end to end
+ delay and priority) and link every frame of a group with the previous frame of the same group, so the solver can
+ order them
+
+ @return number of frames with a previous identical frame, error code otherwise
+ */
+int detect_symmetric_frames(void);
+
+/**
+ Get the utilization of the given link
+
+ @param link_id identifier of the link
+ @return utilization of the link [0.0, 1.0], error code otherwise
+ */
+float get_link_utilization(int link_id);
+
+/**
+ Get the minimum separation between the end of a transmission and the start of the next one in the given link.
+ It is the guard band of the link plus the synchronization precision of the node that transmits in it
+
+ @param link_id identifier of the link
+ @return separation in ns, error code otherwise
+ */
+long long int get_link_separation(int link_id);
+
+/**
+ Get an upper bound of the minimum spacing between two transmissions of the same link. A link with n transmissions in
+ the hyper-period cannot separate all of them by more than the time left by their transmission times over n - 1. It
+ assumes that all the offsets that are not excluded are used (no path selection)
+
+ @return spacing in ns, the hyper-period if no link has two transmissions
+ */
+long long int get_max_link_spacing(void);
+
+/**
+ Narrow the transmission window of every offset with the distances along the paths of its frame, the end to end delay
+ and the offsets that are already fixed. It assumes that all the paths of the frames are used (no path selection)
+
+ @return 0 if done correctly, error code if an offset cannot be transmitted in any time
+ */
+int propagate_offset_windows(void);
+
+/**
+ Get the utilization that one frame adds to the given link, its transmission time divided by its period
+
+ @param frame_pt pointer to the frame
+ @param link_id identifier of the link
+ @return utilization of the frame in the link
+ */
+double get_frame_link_utilization(Frame *frame_pt, int link_id);
+
+/**
+ Choose one path for every receiver of every frame before scheduling, so the solver does not have to route them.
+ Paths are chosen greedily to minimize the maximum link utilization, counting once the links shared by the paths of
+ the same frame. Then, every receiver is ripped up and rerouted with the load of the rest, until no path changes or
+ the given number of iterations is reached. It has to be called before initializing the network
+
+ @param iterations maximum number of rip-up and reroute iterations
+ @return number of iterations done, error code otherwise
+ */
+int route_frames(int iterations);
+
 /**
  Init all the needed variables in the network to start the scheduling, such as frame appearances, instances and similar
  */
 void initialize_network(void);
 
+/* NETWORK BUILDER FUNCTIONS */
+
+/**
+ Start a network built in memory instead of parsed from a xml file. The network starts empty and every structure grows
+ with the nodes, links, paths and frames added to it, nodes before the links and paths that connect them and frames
+ once there is any link. It ends with finalize_network(). As with the parsed networks, a process only holds one
+ network, so it fails if a network was already parsed or built
+
+ @return 0 if done correctly, error code otherwise
+ */
+int create_network(void);
+
+/**
+ Set the overhead and the guard band of all the links of the given type of a network built in memory, applied to its
+ links when the network is finalized
+
+ @param link_type type of the links
+ @param overhead bytes added to every frame on the links (preamble, IFG and headers)
+ @param guard_band guard band in ns left after every transmission in the links
+ @return 0 if done correctly, error code otherwise
+ */
+int set_link_type_parameters(LinkType link_type, int overhead, long long int guard_band);
+
+/**
+ Add a new node to the network built in memory. Nodes are identified by the order they are added, starting from 0,
+ and every new end system is given its place in the path structure
+
+ @param node_type type of the node (switch or end system)
+ @param precision synchronization precision of the node in ns, 0 if it is perfectly synced
+ @return identifier of the new node, error code otherwise
+ */
+int add_network_node(NodeType node_type, long long int precision);
+
+/**
+ Add a new link between two nodes of the network built in memory. Links are identified by the order they are added,
+ starting from 0, and they take the precision of the node that transmits in them
+
+ @param source_id node that transmits in the link
+ @param destination_id node that receives from the link
+ @param speed integer with the speed of the link in MB/s
+ @param link_type type of the link (wired or wireless)
+ @return identifier of the new link, error code otherwise
+ */
+int add_network_link(int source_id, int destination_id, int speed, LinkType link_type);
+
+/**
+ Add all the paths between every pair of end systems of the network built in memory that do not have any path yet,
+ so paths given with add_path() are kept. Paths follow the links from their source node to their destination node,
+ as the Network Generator does
+
+ @param shortest_path 1 to add only one path with the fewest links, 0 to add all the simple paths
+ @param max_paths maximum number of simple paths between two end systems, 0 if there is no limit
+ @return 0 if done correctly, error code otherwise
+ */
+int compute_network_paths(int shortest_path, int max_paths);
+
+/**
+ Add a new frame to the network built in memory. Frames are identified by the order they are added, starting from 0.
+ The pointers to the frames given before are not valid after adding a new one, as the array of frames can move
+
+ @param period long long int of the period in ns
+ @param deadline long long int of the deadline in ns
+ @param size int of the size in bytes
+ @param starting_time long long int of the starting time of the frame in ns
+ @param end_to_end long long int of the end to end delay in ns
+ @param sender_id sender identifier
+ @param receivers_id pointer to the array of receivers id
+ @param num_receivers number of receivers in the array
+ @return identifier of the new frame, error code otherwise
+ */
+int add_network_frame(long long int period, long long int deadline, int size, long long int starting_time,
+                      long long int end_to_end, int sender_id, int *receivers_id, int num_receivers);
+
+/**
+ Finish the network built in memory so it can be prepared to be scheduled as a parsed one. It checks that the sender
+ and the receivers of every frame are end systems connected by at least one path, and it sizes the structures that
+ depend on the final number of links
+
+ @return 0 if done correctly, error code otherwise
+ */
+int finalize_network(void);
+
 /* INPUT OUTPUT FUNCTIONS */
 
 /**
@@ -318,6 +503,7 @@ void initialize_network(void);
  Then continues with the important information from the network components description (links and its speeds).
  It also reads all the possible paths from different nodes.
  It ends with the information of each frame.
+ A process only holds one network, so it fails if a network was already parsed or built.
  
  @param filename name of the xml input file
  @return 0 if correctly read, error code otherwise
@@ -325,7 +511,8 @@ void initialize_network(void);
 int parse_network_xml(char *filename);
 
 /**
- Write the obtained schedule in a XML file with all the paths and transmission times of all the frames
+ Write the obtained schedule in a XML file with all the paths and transmission times of all the frames, and which
+ frames were rejected if not all of them could be scheduled
  
  @param namefile path and name of the xml file to create with the written schedule
  @return 0 if correctly written, -1 otherwise
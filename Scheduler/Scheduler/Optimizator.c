@@ -12,51 +12,328 @@
 
 #include "Optimizator.h"
 
-Z3_config z3_configuration;         // Configuration of z3
-Z3_params z3_parameters;            // Parameters of z3
-Z3_context z3_context;              // Context where the constraint are added in z3
-Z3_optimize z3_optimize;            // Optimization solver in z3
-Z3_model z3_model;                  // Model of z3 that contains the full schedule
-Z3_ast ***path_selector = NULL;     // 3d-Matrix to save the path selector contraints in z3 (frame, receiver, path)
-
-GRBenv *gurobi_env = NULL;          // Gurobi environment
-GRBmodel *gurobi_model = NULL;      // Gurobi model
-int gurobi_var_counter = 0;
-int ***gurobi_path_selector = NULL; // 3d-Matrix to save the path selector constraints in gurobi (same as z3)
-int *gurobi_frame_distance = NULL;  // Array with distances of frames to maximize
-int *gurobi_link_distance = NULL;   // Array with distances of links to maximize
+SolverBackend *backend = NULL;      // Backend of the solver that receives the model, NULL if none was initialized
+int ***path_selector = NULL;        // 3d-Matrix with the path selector literals (frame, receiver, path)
+int variable_names = 0;             // 1 if variables are created with a human readable name, 0 to use its index
+VariableInfo *variables_table = NULL;   // Table with the information of every variable, the index is its identifier
+int num_variables_table = 0;        // Number of variables in the variables table
+int variables_table_capacity = 0;   // Number of variables allocated in the variables table
+ExportFormat export_format = no_export; // Format to export the model, by default it is not exported
+char export_filename[1000];         // Name of the file where the model is exported
+ObjectiveType objectives[MAX_OBJECTIVES];   // Objectives to optimize, from the most to the least important
+int num_objectives = 0;             // Number of objectives, 0 to keep the default objective of every solver
+int *frame_latencies = NULL;        // Array with the latency of every frame, NO_VARIABLE if the frame has no latency
+int maximum_latency = NO_VARIABLE;  // Maximum latency of all frames
+int link_spacing = NO_VARIABLE;     // Minimum spacing between transmissions of the same link, NO_VARIABLE if not used
+ObjectiveType pareto_latency;       // Latency objective traded against the spacing in the pareto front
+int *frame_distances = NULL;        // Array with distances of frames to maximize, NULL if the solver has no distances
+int *link_distances = NULL;         // Array with distances of links to maximize, NULL if the solver has no distances
+double frame_distance_weight = 0.0; // Weight of the frame distances in the distance objective
+double link_distance_weight = 0.0;  // Weight of the link distances in the distance objective
+long long int *link_pair_keys = NULL;   // Hash set with the pairs of links already related in the current frame
+int *link_pair_stamps = NULL;       // Stamp of every bucket of the link pairs hash set, empty if not the current one
+int link_pair_capacity = 0;         // Number of buckets of the link pairs hash set (always a power of 2)
+int link_pair_count = 0;            // Number of link pairs stored with the current stamp
+int link_pair_stamp = 0;            // Current stamp, increasing it empties the hash set without clearing it
+long long int num_ordered_intersections = 0;    // Intersections reduced to a single order by the windows
+long long int num_removed_intersections = 0;    // Intersections removed as the windows cannot collide
+int *frame_scheduled = NULL;        // Literal of every frame, true if it is scheduled, NULL if all have to be scheduled
+int scheduled_weighted = 0;         // 1 if every scheduled frame counts its priority class plus one, 0 if it counts 1
+int conflict_tracking = 0;          // 1 if the groups of constraints have tracking literals to explain conflicts
+ConflictGroup *conflict_groups = NULL;  // Groups of constraints of the model with a tracking literal
+int num_conflict_groups = 0;        // Number of groups of constraints with a tracking literal
+int conflict_groups_capacity = 0;   // Number of groups of constraints allocated
+int tracking_literal = NO_VARIABLE; // Tracking literal of the group of constraints being added, NO_VARIABLE if none
+ConflictGroup *conflict_core = NULL;    // Groups of constraints in the last conflict explained
+int num_conflict_core = 0;          // Number of groups of constraints in the last conflict explained
 
 /* PRIVATE FUNCTIONS */
 
 /**
- Init the constraint variable into the offset
+ Empty the hash set of link pairs, so a new frame can be related. Only the stamp changes, so it is constant time
+ */
+void reset_link_pairs(void) {
+    
+    if (link_pair_capacity == 0) {
+        link_pair_capacity = 256;
+        link_pair_keys = malloc(sizeof(long long int) * link_pair_capacity);
+        link_pair_stamps = calloc(link_pair_capacity, sizeof(int));
+    }
+    link_pair_stamp++;
+    link_pair_count = 0;
+}
+
+/**
+ Get the bucket of the link pairs hash set where the given key is, or where it should be inserted
+
+ @param key key of the link pair
+ @return bucket of the key
+ */
+int get_link_pair_bucket(long long int key) {
+    
+    // Fibonacci hashing, capacity is always a power of 2 so we can mask it
+    int bucket = (int) (((unsigned long long int) key * 11400714819323198485ull) >> 40) & (link_pair_capacity - 1);
+    
+    // Linear probing until we find the key or a bucket not used in the current frame
+    while (link_pair_stamps[bucket] == link_pair_stamp && link_pair_keys[bucket] != key) {
+        bucket = (bucket + 1) & (link_pair_capacity - 1);
+    }
+    return bucket;
+}
+
+/**
+ Add the given pair of links into the hash set of the current frame, to relate every pair of offsets only once
+
+ @param link1 identifier of the first link
+ @param link2 identifier of the second link
+ @return 1 if the pair is new, 0 if it was already added
+ */
+int add_link_pair(int link1, int link2) {
+    
+    long long int key = (long long int) link1 * get_num_links() + link2;
+    long long int *old_keys;
+    int *old_stamps;
+    int old_capacity;
+    int bucket;
+    
+    bucket = get_link_pair_bucket(key);
+    if (link_pair_stamps[bucket] == link_pair_stamp) {
+        return 0;
+    }
+    
+    // If the set is half full, we double it and insert again the pairs of the current frame
+    if ((link_pair_count + 1) * 2 > link_pair_capacity) {
+        old_capacity = link_pair_capacity;
+        old_keys = link_pair_keys;
+        old_stamps = link_pair_stamps;
+        link_pair_capacity = link_pair_capacity * 2;
+        link_pair_keys = malloc(sizeof(long long int) * link_pair_capacity);
+        link_pair_stamps = calloc(link_pair_capacity, sizeof(int));
+        for (int old_bucket = 0; old_bucket < old_capacity; old_bucket++) {
+            if (old_stamps[old_bucket] == link_pair_stamp) {
+                bucket = get_link_pair_bucket(old_keys[old_bucket]);
+                link_pair_keys[bucket] = old_keys[old_bucket];
+                link_pair_stamps[bucket] = link_pair_stamp;
+            }
+        }
+        free(old_keys);
+        free(old_stamps);
+        bucket = get_link_pair_bucket(key);
+    }
+    
+    link_pair_keys[bucket] = key;
+    link_pair_stamps[bucket] = link_pair_stamp;
+    link_pair_count++;
+    return 1;
+}
+
+/**
+ Adds a new variable into the variables table, so its name can be reconstructed later if needed
+
+ @param type type of the variable
+ @param frame frame identifier
+ @param instance instance of the offset
+ @param replica replica of the offset
+ @param link link identifier
+ @param receiver receiver of the frame
+ @param path path to the receiver
+ @return index of the variable in the table
+ */
+int add_variable_info(VariableType type, int frame, int instance, int replica, int link, int receiver, int path) {
+    
+    // Grow the table doubling its size to avoid reallocating it for every variable
+    if (num_variables_table == variables_table_capacity) {
+        variables_table_capacity = variables_table_capacity == 0 ? 1024 : variables_table_capacity * 2;
+        variables_table = realloc(variables_table, sizeof(VariableInfo) * variables_table_capacity);
+    }
+    
+    variables_table[num_variables_table].type = type;
+    variables_table[num_variables_table].frame = frame;
+    variables_table[num_variables_table].instance = instance;
+    variables_table[num_variables_table].replica = replica;
+    variables_table[num_variables_table].link = link;
+    variables_table[num_variables_table].receiver = receiver;
+    variables_table[num_variables_table].path = path;
+    num_variables_table++;
+    return num_variables_table - 1;
+}
+
+/**
+ Create a variable in the solver, with the human readable name of the variables table if variables are named
+
+ @param index index of the variable in the variables table
+ @param lower lower bound of the variable
+ @param upper upper bound of the variable
+ @param domain domain of the variable
+ @return handle of the variable in the solver, error code otherwise
+ */
+int new_variable(int index, long long int lower, long long int upper, VariableDomain domain) {
+    
+    char name[100];
+    
+    if (variable_names == 1) {
+        get_variable_name(index, name);
+    }
+    return backend->new_var(lower, upper, domain, index, variable_names == 1 ? name : NULL);
+}
+
+/**
+ Start a new group of constraints with its own tracking literal, so the next constraints only hold if it is true.
+ If the groups are not tracked, the constraints always hold
+
+ @param type type of the constraints of the group
+ @param frame frame identifier
+ @param other_frame frame that contends with the frame in the link, -1 if none
+ @param link link where both frames contend, -1 if none
+ @param receiver receiver of the path, -1 if none
+ @param path path to the receiver, -1 if none
+ @return 0 if done correctly, error code otherwise
+ */
+int new_conflict_group(ConflictType type, int frame, int other_frame, int link, int receiver, int path) {
+    
+    ConflictGroup *group_pt;
+    int index;
+    
+    tracking_literal = NO_VARIABLE;
+    if (conflict_tracking == 0) {
+        return 0;
+    }
+    
+    // Grow the table doubling its size to avoid reallocating it for every group
+    if (num_conflict_groups == conflict_groups_capacity) {
+        conflict_groups_capacity = conflict_groups_capacity == 0 ? 1024 : conflict_groups_capacity * 2;
+        conflict_groups = realloc(conflict_groups, sizeof(ConflictGroup) * conflict_groups_capacity);
+    }
+    
+    index = add_variable_info(tracking_variable, frame, -1, -1, link, receiver, path);
+    tracking_literal = new_variable(index, 0, 1, boolean_domain);
+    if (tracking_literal < 0) {
+        printf("Error creating the tracking literal\n");
+        tracking_literal = NO_VARIABLE;
+        return ERROR_CREATING_VARIABLE;
+    }
+    group_pt = &conflict_groups[num_conflict_groups];
+    group_pt->type = type;
+    group_pt->frame = frame;
+    group_pt->other_frame = other_frame;
+    group_pt->link = link;
+    group_pt->receiver = receiver;
+    group_pt->path = path;
+    group_pt->literal = tracking_literal;
+    num_conflict_groups++;
+    return 0;
+}
+
+/**
+ Make the group of the contention between the two frames in the link the current one, creating it the first time.
+ The groups of the contention of an offset are created one after the other, so only the last groups are searched
+
+ @param frame_it id of the frame
+ @param previous_frame_it id of the frame that contends with it
+ @param link id of the link
+ @return 0 if done correctly, error code otherwise
+ */
+int track_contention(int frame_it, int previous_frame_it, int link) {
+    
+    ConflictGroup *group_pt;
+    
+    if (conflict_tracking == 0) {
+        return 0;
+    }
+    for (int group_it = num_conflict_groups - 1; group_it >= 0; group_it--) {
+        group_pt = &conflict_groups[group_it];
+        if (group_pt->type != contention_conflict || group_pt->frame != frame_it || group_pt->link != link) {
+            break;
+        }
+        if (group_pt->other_frame == previous_frame_it) {
+            tracking_literal = group_pt->literal;
+            return 0;
+        }
+    }
+    return new_conflict_group(contention_conflict, frame_it, previous_frame_it, link, -1, -1);
+}
+
+/**
+ Add a constraint that only has to hold if all the given literals are true, it always holds if there are none.
+ The constraints of a tracked group also need its tracking literal
+
+ @param num_guards number of guard literals
+ @param guards array with the guard literals
+ @param constraint pointer to the linear constraint
+ @return 0 if done correctly, error code otherwise
+ */
+int add_constraint_with_guards(int num_guards, int *guards, LinearConstraint *constraint) {
+    
+    int tracked_guards[MAX_GUARDS];
+    
+    if (tracking_literal != NO_VARIABLE) {
+        for (int guard_it = 0; guard_it < num_guards; guard_it++) {
+            tracked_guards[guard_it] = guards[guard_it];
+        }
+        tracked_guards[num_guards] = tracking_literal;
+        guards = tracked_guards;
+        num_guards++;
+    }
+    if (num_guards == 0) {
+        return backend->add_diff(constraint);
+    }
+    if (num_guards == 1) {
+        return backend->add_guarded(guards[0], 1, constraint);
+    }
+    // A disjunction with a single constraint holds whenever all its guards are true
+    return backend->add_disjunction(1, constraint, num_guards, guards);
+}
+
+/**
+ Add a constraint that only has to hold if the given path is used and the frame is scheduled. If the solver does not
+ select the paths nor the frames, all the paths are used and the constraint always holds
+
+ @param frame_it id of the frame
+ @param receiver_it id of the receiver
+ @param path_it id of the path
+ @param constraint pointer to the linear constraint
+ @return 0 if done correctly, error code otherwise
+ */
+int add_path_constraint(int frame_it, int receiver_it, int path_it, LinearConstraint *constraint) {
+    
+    int guards[2];
+    int num_guards = 0;
+    
+    if (path_selector != NULL) {
+        guards[num_guards] = path_selector[frame_it][receiver_it][path_it];
+        num_guards++;
+    }
+    if (frame_scheduled != NULL) {
+        guards[num_guards] = frame_scheduled[frame_it];
+        num_guards++;
+    }
+    return add_constraint_with_guards(num_guards, guards, constraint);
+}
+
+/**
+ Init the boolean literal that is true if the chosen paths use the given offset. It guards all the constraints of the
+ offset, and it is shared by all its instances and replicas
  
  @param offset_pt pointer of the offset
- @param instance of the offset
- @param replica of the offset
- @param name given to the variable
- @param csolver constraint solver used
+ @param frame_it identifier of the frame of the offset
  @return 0 if done correctly, error code otherwise
  */
-int init_variable(Offset *offset_pt, int instance, int replica, char *name, Solver csolver) {
+int init_used_literal(Offset *offset_pt, int frame_it) {
     
-    Z3_sort z3_integer;
-    Z3_symbol z3_name;
+    int index;
+    int literal;
     
-    switch (csolver) {
-        case z3:
-            z3_integer = Z3_mk_int_sort(z3_context);
-            z3_name = Z3_mk_string_symbol(z3_context, name);
-            set_z3_offset(offset_pt, instance, replica, Z3_mk_const(z3_context, z3_name, z3_integer));
-            return 0;
-        default:
-            return OPTIMIZATOR_NOT_IMPLEMENTED;
+    index = add_variable_info(offset_used_variable, frame_it, -1, -1, get_offset_link(offset_pt), -1, -1);
+    literal = new_variable(index, 0, 1, boolean_domain);
+    if (literal < 0) {
+        return ERROR_CREATING_VARIABLE;
     }
+    return set_offset_used(offset_pt, literal);
 }
 
 /**
  Adds into the solver a constraint to set the distance between two offsets
- offset1[instance][replica] = offset2[instance][replica] + distance
+ offset2[instance][replica] = offset1[instance][replica] + distance
  
  @param offset1_pt pointer to the offset 1
  @param instance1 of the offset 1
@@ -65,70 +342,26 @@ int init_variable(Offset *offset_pt, int instance, int replica, char *name, Solv
  @param instance2 of the offset 2
  @param replica2 of the offset 2
  @param distance long long int with the distance between the two offsets in ns
- @param csolver constraint solver used
  @return 0 if everything went ok, error code otherwise
  */
 int set_fixed_distance(Offset *offset1_pt, int instance1, int replica1, Offset *offset2_pt, int instance2,
-                       int replica2, long long int distance, Solver csolver) {
-    
-    // Auxiliar variables to store constraints
-    Z3_sort z3_integer;
-    Z3_ast z3_add_args[2], z3_add, z3_formula, z3_offset2, z3_int0, z3_offset1_eq0, z3_offset2_eq0;
-    
-    // Gurobi needed variables
-    int variables[2];
-    double values[2] = {1.0, -1.0};
-    
-    switch (csolver) {
-        case z3:
-            // Set the distance between both offsets
-            z3_integer = Z3_mk_int_sort(z3_context);
-            z3_add_args[0] = get_z3_offset(offset1_pt, instance1, replica1);
-            if (z3_add_args[0] == NULL) {
-                printf("Error extracting the constraint of offset1\n");
-                return ERROR_EXTRACTING_Z3_OFFSET;
-            }
-            z3_add_args[1] = Z3_mk_int64(z3_context, distance, z3_integer);
-            // z3_add <= offset1 + distance
-            z3_add = Z3_mk_add(z3_context, 2, z3_add_args);
-            // z3_formula <= offset2 = z3_add
-            z3_offset2 = get_z3_offset(offset2_pt, instance2, replica2);
-            if (z3_offset2 == NULL) {
-                printf("Error extracting the constraint of offset2\n");
-                return ERROR_EXTRACTING_Z3_OFFSET;
-            }
-            z3_formula = Z3_mk_eq(z3_context, z3_offset2, z3_add);
-            if (path_selector != NULL) {        // If we need to define a path
-                // z3_formula <= if offset1 = 0 then offset2 = 0 else z3_formula
-                z3_int0 = Z3_mk_int64(z3_context, 0, z3_integer);
-                z3_offset2_eq0 = Z3_mk_eq(z3_context, z3_offset2, z3_int0);
-                z3_offset1_eq0 = Z3_mk_eq(z3_context, get_z3_offset(offset1_pt, instance1, replica1), z3_int0);
-                z3_formula = Z3_mk_ite(z3_context, z3_offset1_eq0, z3_offset2_eq0, z3_formula);
-            }
-            Z3_optimize_assert(z3_context, z3_optimize, z3_formula);
-            break;
-        case gurobi:
-            variables[0] = get_gurobi_offset(offset2_pt, instance2, replica2);
-            variables[1] = get_gurobi_offset(offset1_pt, instance1, replica1);
-            if (gurobi_path_selector == NULL) {
-                if (GRBaddconstr(gurobi_model, 2, variables, values, GRB_EQUAL, distance, NULL) != 0) {
-                    printf("Error adding setting fix distance constraint in gurobi\n");
-                    return ERROR_SETTING_GUROBI_CONSTRAINT;
-                }
-            } else {
-                // We create a binary variable that will be 1 if offset1 = 0, which implies offset2 has to be 0 too
-                // If not, we activate the previus constraint
-                GRBaddvar(gurobi_model, 0, NULL, NULL, 0, 0, 1, GRB_BINARY, NULL);
-                gurobi_var_counter++;
-                GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_var_counter - 1, 1, 2, variables, values,
-                                         GRB_EQUAL, distance);
-                values[1] = 1.0;
-                GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_var_counter - 1, 0, 2, variables, values,
-                                         GRB_EQUAL, 0);
-            }
-            break;
-        default:
-            break;
+                       int replica2, long long int distance) {
+    
+    LinearConstraint constraint;
+    int result;
+    
+    // offset2 - offset1 = distance
+    init_difference(&constraint, get_offset_variable(offset2_pt, instance2, replica2),
+                    get_offset_variable(offset1_pt, instance1, replica1), sense_equal, distance);
+    if (path_selector != NULL) {        // If we need to define a path
+        // offset1 used => constraint, if it is not used its range sets both to 0
+        result = backend->add_guarded(get_offset_used(offset1_pt), 1, &constraint);
+    } else {
+        result = backend->add_diff(&constraint);
+    }
+    if (result < 0) {
+        printf("Error setting the fixed distance between two offsets\n");
+        return ERROR_ADDING_CONSTRAINT;
     }
     
     return 0;
@@ -136,73 +369,41 @@ int set_fixed_distance(Offset *offset1_pt, int instance1, int replica1, Offset *
 
 /**
  Adds into the solver the constraints to limit transmission time range
- offset[instance][replica] = (min, max]
+ offset[instance][replica] = [min, max]
+ If the solver selects the paths, the offset is 0 when it is not used, so its lower bound is only set when it is used
  
  @param offset_pt pointer to the offset
  @param instance of the offset
  @param replica of the offset
  @param min minimum transmission time in ns
  @param max maximum transmission time in ns
- @param name of the variable (needed only for gurobi)
- @param csolver constraint solver used
+ @param index index of the variable in the variables table
  @return 0 if everything went ok, error code otherwise
  */
-int set_offset_range(Offset *offset_pt, int instance, int replica, long long int min, long long int max, char *name,
-                     Solver csolver) {
-    
-    // Auxiliar variables to store constraints
-    Z3_sort z3_integer;
-    Z3_ast  z3_minimum, z3_maximum, z3_formula, z3_offset, z3_or_args[2], z3_int0, z3_eq;
-    int minimum_posible;
-    
-    switch (csolver) {
-        case z3:
-            // Set the minimum transmission time
-            z3_integer = Z3_mk_int_sort(z3_context);
-            z3_minimum = Z3_mk_int64(z3_context, min, z3_integer);
-            z3_offset = get_z3_offset(offset_pt, instance, replica);
-            if (z3_offset == NULL) {
-                printf("Error extracting the offset\n");
-                return ERROR_EXTRACTING_Z3_OFFSET;
-            }
-            // z3_formula <= offset >= min
-            z3_formula = Z3_mk_gt(z3_context, z3_offset, z3_minimum);
-            if (path_selector != NULL) {        // If we have to select paths
-                // z3_eq <= offset1 = 0
-                z3_int0 = Z3_mk_int64(z3_context, 0, z3_integer);
-                z3_eq = Z3_mk_eq(z3_context, z3_offset, z3_int0);
-                z3_or_args[0] = z3_formula;
-                z3_or_args[1] = z3_eq;
-                // z3_formula <= z3_formula OR offset2 = 0
-                z3_formula = Z3_mk_or(z3_context, 2, z3_or_args);
-            }
-            Z3_optimize_assert(z3_context, z3_optimize, z3_formula);
-            
-            // Set the maximum transmission time
-            z3_maximum = Z3_mk_int64(z3_context, max, z3_integer);
-            // z3_formula <= offset < max
-            z3_formula = Z3_mk_le(z3_context, z3_offset, z3_maximum);
-            Z3_optimize_assert(z3_context, z3_optimize, z3_formula);
-            
-            break;
-        case gurobi:
-            // Min is always 0 as offset == 0 implies that we do not use the offset, unless no path selector
-            if (path_selector == NULL) {
-                minimum_posible = 1;
-            } else {
-                minimum_posible = 0;
-            }
-            if (GRBaddvar(gurobi_model, 0, NULL, NULL, 0, minimum_posible, max, GRB_INTEGER, name) != 0) {
-                printf("Error add gurobi variable for a frame instance\n");
-                return ERROR_SETTING_GUROBI_VAR;
-            }
-            // In gurobi, to access a variable you need to add the position when it was added, so we save that and add
-            // the counter for the next one
-            set_gurobi_offset(offset_pt, instance, replica, gurobi_var_counter);
-            gurobi_var_counter++;
-            break;
-        default:
-            break;
+int set_offset_range(Offset *offset_pt, int instance, int replica, long long int min, long long int max, int index) {
+    
+    LinearConstraint constraint;
+    int variable;
+    int result = 0;
+    
+    variable = new_variable(index, path_selector == NULL ? min : 0, max, integer_domain);
+    if (variable < 0) {
+        printf("Error creating the variable of the offset\n");
+        return ERROR_CREATING_VARIABLE;
+    }
+    set_offset_variable(offset_pt, instance, replica, variable);
+    
+    if (path_selector != NULL) {        // If we have to select paths
+        // offset used => offset >= min
+        init_difference(&constraint, variable, NO_VARIABLE, sense_greater_equal, min);
+        result |= backend->add_guarded(get_offset_used(offset_pt), 1, &constraint);
+        // offset not used => offset = 0
+        init_difference(&constraint, variable, NO_VARIABLE, sense_equal, 0);
+        result |= backend->add_guarded(get_offset_used(offset_pt), 0, &constraint);
+    }
+    if (result != 0) {
+        printf("Error setting the range of the offset\n");
+        return ERROR_ADDING_CONSTRAINT;
     }
     
     return 0;
@@ -215,15 +416,13 @@ int set_offset_range(Offset *offset_pt, int instance, int replica, long long int
  @param frame1_pt pointer of the frame 1
  @param offset1_pt pointer of the offset 1
  @param instance1 of the offset 1
- @param replica1 of the offset 1
  @param frame2_pt pointer of the frame 2
  @param offset2_pt pointer of the offset 2
  @param instance2 of the offset 2
- @param replica2 of the offset 2
  @return 1 if it is possible for the times to collide, 0 otherwise
  */
-int offsets_share_interval(Frame *frame1_pt, Offset *offset1_pt, int instance1, int replica1, Frame *frame2_pt,
-                           Offset *offset2_pt, int instance2, int replica2) {
+int offsets_share_interval(Frame *frame1_pt, Offset *offset1_pt, int instance1, Frame *frame2_pt, Offset *offset2_pt,
+                           int instance2) {
     
     long long int period1, period2;         // Periods of the given offsets
     long long int deadline1, deadline2;     // Deadlines of the given offsets
@@ -241,6 +440,10 @@ int offsets_share_interval(Frame *frame1_pt, Offset *offset1_pt, int instance1,
     min2 = (period2 * instance2) + starting2 + 1;
     max2 = (period2 * instance2) + deadline2 + 1;
     
+    // Transmissions also need the separation of the link after them, which extends the intervals where they collide
+    max1 += get_link_separation(get_offset_link(offset1_pt));
+    max2 += get_link_separation(get_offset_link(offset2_pt));
+    
     // if the first interval starts before and the second interval starts before the first ends
     // or if the second interval starts before and the first interval starts before the second ends
     if ((min1 <= min2 && min2 < max1) || (min2 <= min1 && min1 < max2)) {
@@ -251,7 +454,87 @@ int offsets_share_interval(Frame *frame1_pt, Offset *offset1_pt, int instance1,
 }
 
 /**
- Avoids that the two given offsets share any transmission time
+ Set that the second offset is transmitted at least the given distance after the first one. Unlike the minimum
+ distance, it does not depend on any path selector, so both offsets have to be always used. If frames can be rejected,
+ it only holds if all the given guards (the literals of the frames scheduled) are true
+
+ @param offset1_pt pointer to the first offset
+ @param instance1 instance of the first offset
+ @param replica1 replica of the first offset
+ @param offset2_pt pointer to the second offset
+ @param instance2 instance of the second offset
+ @param replica2 replica of the second offset
+ @param distance minimum distance between both offsets
+ @param num_guards number of guard literals, 0 if the precedence always holds
+ @param guards array with the guard literals
+ @return 0 if done correctly, error code otherwise
+ */
+int set_precedence(Offset *offset1_pt, int instance1, int replica1, Offset *offset2_pt, int instance2, int replica2,
+                   long long int distance, int num_guards, int *guards) {
+    
+    LinearConstraint constraint;
+    
+    // offset2 - offset1 >= distance
+    init_difference(&constraint, get_offset_variable(offset2_pt, instance2, replica2),
+                    get_offset_variable(offset1_pt, instance1, replica1), sense_greater_equal, distance);
+    if (add_constraint_with_guards(num_guards, guards, &constraint) < 0) {
+        printf("Error setting precedence constraint\n");
+        return ERROR_ADDING_CONSTRAINT;
+    }
+    
+    return 0;
+}
+
+/**
+ Check which orders between the two given offsets are possible with their transmission windows.
+ It can only decide when the distances are constants, so if the solver selects the paths (unused offsets are 0 and
+ out of the window) or the link distances or the spacing are variables, both orders are always possible
+
+ @param offset1_pt pointer to the offset 1
+ @param instance1 of the offset 1
+ @param offset2_pt pointer to the offset 2
+ @param instance2 of the offset 2
+ @param distance1 distance after the offset 1 if it is transmitted first
+ @param distance2 distance after the offset 2 if it is transmitted first
+ @return the orders allowed between both offsets
+ */
+IntersectionOrder presolve_intersection_order(Offset *offset1_pt, int instance1, Offset *offset2_pt, int instance2,
+                                              long long int distance1, long long int distance2) {
+    
+    long long int earliest1, latest1, earliest2, latest2;   // Windows of both instances
+    int first_possible, second_possible;
+    
+    if (path_selector != NULL || link_spacing != NO_VARIABLE || link_distance_weight != 0.0) {
+        return both_orders;
+    }
+    
+    // The window of an instance is the window of the instance 0 moved by its period
+    earliest1 = get_offset_earliest(offset1_pt) + (get_hyper_period() / get_num_instances(offset1_pt)) * instance1;
+    latest1 = get_offset_latest(offset1_pt) + (get_hyper_period() / get_num_instances(offset1_pt)) * instance1;
+    earliest2 = get_offset_earliest(offset2_pt) + (get_hyper_period() / get_num_instances(offset2_pt)) * instance2;
+    latest2 = get_offset_latest(offset2_pt) + (get_hyper_period() / get_num_instances(offset2_pt)) * instance2;
+    
+    // If one order always holds, whatever the times in the windows are, both offsets can never collide
+    if (latest1 + distance1 <= earliest2 || latest2 + distance2 <= earliest1) {
+        return no_intersection;
+    }
+    
+    first_possible = earliest1 + distance1 <= latest2;
+    second_possible = earliest2 + distance2 <= latest1;
+    if (first_possible && !second_possible) {
+        return first_before_second;
+    }
+    if (second_possible && !first_possible) {
+        return second_before_first;
+    }
+    // If none is possible the model is infeasible, the disjunction is kept so the solver reports it
+    return both_orders;
+}
+
+/**
+ Avoids that the two given offsets share any transmission time. If the link distances are maximized or the spacing is
+ traded in the pareto front, the variable is added to both distances. If frames can be rejected, it only holds if both
+ frames are scheduled
  offset1[instance][replica] + distance1 <= offset2[instance][replica]
  OR
  offset2[instance][replica] + distance2 <= offset1[instance][replica]
@@ -264,119 +547,74 @@ int offsets_share_interval(Frame *frame1_pt, Offset *offset1_pt, int instance1,
  @param replica2 of the offset 2
  @param distance1 long long int with the distance the first offset can go
  @param distance2 long long int with the distance the second offset can go
- @param csolver constraint solver used
+ @param frame1_it id of the frame of the offset 1
+ @param frame2_it id of the frame of the offset 2
  @return 0 if everything went ok, error code otherwise
  */
 int avoid_intersection(Offset *offset1_pt, int instance1, int replica1, Offset *offset2_pt, int instance2,
-                       int replica2, long long int distance1, long long int distance2, Solver csolver) {
-
-    // Auxiliar variables to hold constraints
-    Z3_sort z3_integer;
-    Z3_ast z3_add_args[2], z3_or_args[2], z3_add, z3_less, z3_greater, z3_offset1, z3_offset2, z3_formula, z3_int0;
-    Z3_ast z3_eq;
-    
-    // Gurobi variables
-    int variables[3];
-    double values[3] = {1.0, -1.0, 1.0};
-    int or_variables[2];
-    
-    switch (csolver) {
-        case z3:
-            z3_integer = Z3_mk_int_sort(z3_context);
-            z3_offset1 = get_z3_offset(offset1_pt, instance1, replica1);
-            z3_offset2 = get_z3_offset(offset2_pt, instance2, replica2);
-            if (z3_offset1 == NULL || z3_offset2 == NULL) {
-                printf("Error getting the offsets to avoid the intersection\n");
-                return ERROR_EXTRACTING_Z3_OFFSET;
-            }
-            
-            z3_add_args[0] = get_z3_offset(offset1_pt, instance1, replica1);
-            z3_add_args[1] = Z3_mk_int64(z3_context, distance1, z3_integer);
-            // z3_add <= offset1 + distance1
-            z3_add = Z3_mk_add(z3_context, 2, z3_add_args);
-            // z3_less <= z3_add < offset2
-            z3_less = Z3_mk_le(z3_context, z3_add, z3_offset2);
-            z3_add_args[0] = z3_offset2;
-            z3_add_args[1] = Z3_mk_int64(z3_context, distance2, z3_integer);
-            // z3_add <= offset2 + distance
-            z3_add = Z3_mk_add(z3_context, 2, z3_add_args);
-            // z3_greater <= z3_add >= offset1
-            z3_greater = Z3_mk_le(z3_context, z3_add, z3_offset1);
-            z3_or_args[0] = z3_less;
-            z3_or_args[1] = z3_greater;
-            z3_formula = Z3_mk_or(z3_context, 2, z3_or_args);
-            if (path_selector != NULL) {        // If we have to select paths
-                // z3_eq <= offset1 = 0
-                z3_int0 = Z3_mk_int64(z3_context, 0, z3_integer);
-                z3_eq = Z3_mk_eq(z3_context, z3_offset1, z3_int0);
-                z3_or_args[0] = z3_formula;
-                z3_or_args[1] = z3_eq;
-                // z3_formula <= z3_formula OR offset2 = 0
-                z3_formula = Z3_mk_or(z3_context, 2, z3_or_args);
-            }
-            Z3_optimize_assert(z3_context, z3_optimize, z3_formula);
-            break;
-        case gurobi:
-            if (gurobi_path_selector == NULL) {
-                // Add OR of two variables, link them with a Indicator function
-                GRBaddvar(gurobi_model, 0, NULL, NULL, 0, 0, 1, GRB_BINARY, NULL);
-                gurobi_var_counter++;
-                GRBaddvar(gurobi_model, 0, NULL, NULL, 0, 0, 1, GRB_BINARY, NULL);
-                gurobi_var_counter++;
-                GRBaddvar(gurobi_model, 0, NULL, NULL, 0, 1, 1, GRB_BINARY, NULL);
-                gurobi_var_counter++;
-                or_variables[0] = gurobi_var_counter - 3;
-                or_variables[1] = gurobi_var_counter - 2;
-                GRBaddgenconstrOr(gurobi_model, NULL, gurobi_var_counter - 1, 2, or_variables);
-                variables[0] = get_gurobi_offset(offset1_pt, instance1, replica1);
-                variables[1] = get_gurobi_offset(offset2_pt, instance2, replica2);
-                variables[2] = gurobi_link_distance[get_offset_link(offset1_pt)];
-                GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_var_counter - 3, 1, 3, variables, values,
-                                             GRB_LESS_EQUAL, -distance1);
-                variables[0] = get_gurobi_offset(offset2_pt, instance2, replica2);
-                variables[1] = get_gurobi_offset(offset1_pt, instance1, replica1);
-                GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_var_counter - 2, 1, 3, variables, values,
-                                             GRB_LESS_EQUAL, -distance2);
-            } else {
-                // If we have to select path, we add one OR more that states both offsets are = 0, so it is activated
-                // iif offsets are not used
-                GRBaddvar(gurobi_model, 0, NULL, NULL, 0, 0, 1, GRB_BINARY, NULL);
-                gurobi_var_counter++;
-                GRBaddvar(gurobi_model, 0, NULL, NULL, 0, 0, 1, GRB_BINARY, NULL);
-                gurobi_var_counter++;
-                GRBaddvar(gurobi_model, 0, NULL, NULL, 0, 0, 1, GRB_BINARY, NULL);
-                gurobi_var_counter++;
-                GRBaddvar(gurobi_model, 0, NULL, NULL, 0, 1, 1, GRB_BINARY, NULL);
-                gurobi_var_counter++;
-
-                variables[0] = gurobi_var_counter - 4;
-                variables[1] = gurobi_var_counter - 3;
-                variables[2] = gurobi_var_counter - 2;
-                GRBaddgenconstrOr(gurobi_model, NULL, gurobi_var_counter - 1, 3, variables);
-                variables[0] = get_gurobi_offset(offset1_pt, instance1, replica1);
-                variables[1] = get_gurobi_offset(offset2_pt, instance2, replica2);
-                variables[2] = gurobi_link_distance[get_offset_link(offset1_pt)];
-                GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_var_counter - 4, 1, 3, variables, values,
-                                         GRB_LESS_EQUAL, -distance1);
-                variables[0] = get_gurobi_offset(offset2_pt, instance2, replica2);
-                variables[1] = get_gurobi_offset(offset1_pt, instance1, replica1);
-                GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_var_counter - 3, 1, 3, variables, values,
-                                         GRB_LESS_EQUAL, -distance2);
-                values[1] = 1.0;
-                GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_var_counter - 2, 1, 2, variables, values,
-                                         GRB_EQUAL, 0);
-            }
-            break;
+                       int replica2, long long int distance1, long long int distance2, int frame1_it, int frame2_it) {
+    
+    LinearConstraint orders[2];
+    int guards[MAX_GUARDS];
+    int num_guards = 0;
+    int offset1, offset2;
+    int extra;                          // Variable distance between both offsets, NO_VARIABLE if there is none
+    
+    // If we have to select paths, it only holds if both offsets are used
+    if (path_selector != NULL) {
+        guards[num_guards] = get_offset_used(offset1_pt);
+        guards[num_guards + 1] = get_offset_used(offset2_pt);
+        num_guards += 2;
+    }
+    // If frames can be rejected, it only holds if both frames are scheduled
+    if (frame_scheduled != NULL) {
+        guards[num_guards] = frame_scheduled[frame1_it];
+        guards[num_guards + 1] = frame_scheduled[frame2_it];
+        num_guards += 2;
+    }
+    
+    // If the windows only allow one order, a single precedence replaces the disjunction, or none if they cannot collide
+    switch (presolve_intersection_order(offset1_pt, instance1, offset2_pt, instance2, distance1, distance2)) {
+        case no_intersection:
+            num_removed_intersections++;
+            return 0;
+        case first_before_second:
+            num_ordered_intersections++;
+            return set_precedence(offset1_pt, instance1, replica1, offset2_pt, instance2, replica2, distance1,
+                                  num_guards, guards);
+        case second_before_first:
+            num_ordered_intersections++;
+            return set_precedence(offset2_pt, instance2, replica2, offset1_pt, instance1, replica1, distance2,
+                                  num_guards, guards);
         default:
             break;
     }
     
+    offset1 = get_offset_variable(offset1_pt, instance1, replica1);
+    offset2 = get_offset_variable(offset2_pt, instance2, replica2);
+    extra = link_distances != NULL ? link_distances[get_offset_link(offset1_pt)] : link_spacing;
+    // offset2 - offset1 - extra >= distance1
+    init_difference(&orders[0], offset2, offset1, sense_greater_equal, distance1);
+    add_linear_term(&orders[0], extra, -1);
+    // offset1 - offset2 - extra >= distance2
+    init_difference(&orders[1], offset1, offset2, sense_greater_equal, distance2);
+    add_linear_term(&orders[1], extra, -1);
+    if (tracking_literal != NO_VARIABLE) {
+        guards[num_guards] = tracking_literal;
+        num_guards++;
+    }
+    if (backend->add_disjunction(2, orders, num_guards, guards) < 0) {
+        printf("Error avoiding the intersection of two offsets\n");
+        return ERROR_ADDING_CONSTRAINT;
+    }
+    
     return 0;
 }
 
 /**
  Adds into the solver a constraint to set the maximum distance between two offsets
  offset1[instance][replica] + distance >= offset2[instance][replica]
+ If the frame distances are maximized, they are also limited by the starting time and the deadline of the frame
  
  @param offset1_pt pointer to the offset 1
  @param instance1 of the offset 1
@@ -388,107 +626,42 @@ int avoid_intersection(Offset *offset1_pt, int instance1, int replica1, Offset *
  @param frame_it frame id
  @param receiver_it receiver id
  @param path_it path id
- @param csolver constraint solver used
  @return 0 if everything went ok, error code otherwise
  */
 int set_maximum_distance(Offset *offset1_pt, int instance1, int replica1, Offset *offset2_pt, int instance2,
-                         int replica2, long long int distance, int frame_it, int receiver_it, int path_it,
-                         Solver csolver) {
-    
-    // Auxiliar variables to hold constraints
-    Z3_sort z3_integer;
-    Z3_ast z3_add_args[2], z3_add, z3_offset2, z3_formula;
-    
-    // Gurobi variables
-    int variables[3];
-    double values[3] = {1.0, -1.0, 1.0};
-    
-    switch (csolver) {
-        case z3:
-            z3_integer = Z3_mk_int_sort(z3_context);
-            z3_add_args[0] = get_z3_offset(offset1_pt, instance1, replica1);
-            if (z3_add_args[0] == NULL) {
-                printf("Error getting an offset");
-                return ERROR_EXTRACTING_Z3_OFFSET;
-            }
-            z3_add_args[1] = Z3_mk_int64(z3_context, distance, z3_integer);
-            // z3_add <= offset1 + distance
-            z3_add = Z3_mk_add(z3_context, 2, z3_add_args);
-            z3_offset2 = get_z3_offset(offset2_pt, instance2, replica2);
-            if (z3_offset2 == NULL) {
-                printf("Error getting an offset");
-                return ERROR_EXTRACTING_Z3_OFFSET;
-            }
-            // z3_formula <= z3_add >= offset2
-            z3_formula = Z3_mk_ge(z3_context, z3_add, z3_offset2);
-            Z3_optimize_assert(z3_context, z3_optimize, z3_formula);
-            break;
-        case gurobi:
-            // Set the frame distances here, trying to limit the distances to the starting time and from the end to end
-            // Only add the constraint if the path is active
-            //Last offset distance
-            if (gurobi_path_selector != NULL) {
-                variables[0] = get_gurobi_offset(offset2_pt, instance2, replica2);
-                variables[1] = get_gurobi_offset(offset1_pt, instance1, replica1);
-                if (GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_path_selector[frame_it][receiver_it][path_it],
-                                             1, 2, variables, values, GRB_LESS_EQUAL, distance) < 0) {
-                    printf("Error adding maximum distance constraint in gurobi\n");
-                    return ERROR_SETTING_GUROBI_CONSTRAINT;
-                }
-                // First offset distance
-                variables[0] = get_gurobi_offset(offset1_pt, instance1, replica1);
-                variables[1] = gurobi_frame_distance[frame_it];
-                if (GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_path_selector[frame_it][receiver_it][path_it],
-                                             1, 2, variables, values, GRB_GREATER_EQUAL, get_starting(get_frame(frame_it))) < 0) {
-                    printf("Error adding maximum distance constraint in gurobi\n");
-                    return ERROR_SETTING_GUROBI_CONSTRAINT;
-                }
-                // Last offset distance
-                variables[0] = get_gurobi_offset(offset2_pt, instance2, replica2);
-                variables[1] = gurobi_frame_distance[frame_it];
-                if (GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_path_selector[frame_it][receiver_it][path_it],
-                                             1, 2, variables, values, GRB_LESS_EQUAL,
-                                             get_deadline(get_frame(frame_it))) < 0) {
-                    printf("Error adding maximum distance constraint in gurobi\n");
-                    return ERROR_SETTING_GUROBI_CONSTRAINT;
-                }
-            } else {
-                variables[0] = get_gurobi_offset(offset2_pt, instance2, replica2);
-                variables[1] = get_gurobi_offset(offset1_pt, instance1, replica1);
-                if (GRBaddconstr(gurobi_model, 2, variables, values, GRB_LESS_EQUAL, distance, NULL) < 0) {
-                    printf("Error adding maximum distance constraint in gurobi\n");
-                    return ERROR_SETTING_GUROBI_CONSTRAINT;
-                }
-                // First offset distance
-                variables[0] = get_gurobi_offset(offset1_pt, instance1, replica1);
-                variables[1] = gurobi_frame_distance[frame_it];
-                
-                if (GRBaddconstr(gurobi_model, 2, variables, values, GRB_GREATER_EQUAL,
-                                 get_starting(get_frame(frame_it)), NULL) < 0) {
-                    printf("Error adding maximum distance constraint in gurobi\n");
-                    return ERROR_SETTING_GUROBI_CONSTRAINT;
-                }
-                // Last offset distance
-                variables[0] = get_gurobi_offset(offset2_pt, instance2, replica2);
-                variables[1] = gurobi_frame_distance[frame_it];
-                values[1] = 1.0;
-                if (GRBaddconstr(gurobi_model, 2, variables, values, GRB_LESS_EQUAL, get_deadline(get_frame(frame_it)),
-                                 NULL) < 0) {
-                    printf("Error adding maximum distance constraint in gurobi\n");
-                    return ERROR_SETTING_GUROBI_CONSTRAINT;
-                }
-            }
-            
-            break;
-        default:
-            break;
+                         int replica2, long long int distance, int frame_it, int receiver_it, int path_it) {
+    
+    LinearConstraint constraint;
+    int offset1, offset2;
+    int result = 0;
+    
+    offset1 = get_offset_variable(offset1_pt, instance1, replica1);
+    offset2 = get_offset_variable(offset2_pt, instance2, replica2);
+    // offset2 - offset1 <= distance
+    init_difference(&constraint, offset2, offset1, sense_less_equal, distance);
+    result |= add_path_constraint(frame_it, receiver_it, path_it, &constraint);
+    if (frame_distances != NULL) {
+        // First offset distance, offset1 - frame distance >= starting
+        init_difference(&constraint, offset1, frame_distances[frame_it], sense_greater_equal,
+                        get_starting(get_frame(frame_it)));
+        result |= add_path_constraint(frame_it, receiver_it, path_it, &constraint);
+        // Last offset distance, offset2 + frame distance <= deadline
+        init_difference(&constraint, offset2, NO_VARIABLE, sense_less_equal, get_deadline(get_frame(frame_it)));
+        add_linear_term(&constraint, frame_distances[frame_it], 1);
+        result |= add_path_constraint(frame_it, receiver_it, path_it, &constraint);
     }
+    if (result != 0) {
+        printf("Error adding maximum distance constraint\n");
+        return ERROR_ADDING_CONSTRAINT;
+    }
+    
     return 0;
 }
 
 /**
- Adds into the solver a constraint to set the minimum distance between two offsets
- offset1[instance][replica] + distance < offset2[instance][replica]
+ Adds into the solver a constraint to set the minimum distance between two offsets, plus the frame distance if it is
+ maximized
+ offset1[instance][replica] + distance <= offset2[instance][replica]
  
  @param offset1_pt pointer to the offset 1
  @param instance1 of the offset 1
@@ -500,272 +673,750 @@ int set_maximum_distance(Offset *offset1_pt, int instance1, int replica1, Offset
  @param frame_it id of the frame
  @param receiver_it id of the receiver
  @param path_it id of the path
- @param csolver constraint solver used
- @return 0 if everything went ok, -1 if something failed
+ @return 0 if everything went ok, error code otherwise
  */
 int set_minimum_distance(Offset *offset1_pt, int instance1, int replica1, Offset *offset2_pt, int instance2,
-                         int replica2, long long int distance, int frame_it, int receiver_it, int path_it,
-                         Solver csolver) {
+                         int replica2, long long int distance, int frame_it, int receiver_it, int path_it) {
  
-    // Auxiliar variables to hold constraints
-    Z3_sort z3_integer;
-    Z3_ast z3_add_args[2], z3_add, z3_offset2, z3_formula, z3_or_args[2], z3_int0;
-    
-    // Gurobi variables
-    int variables[3];
-    double values[3] = {1.0, -1.0, -1.0};
-    
-    switch (csolver) {
-        case z3:
-            z3_integer = Z3_mk_int_sort(z3_context);
-            z3_add_args[0] = get_z3_offset(offset1_pt, instance1, replica1);
-            if (z3_add_args[0] == NULL) {
-                printf("Error getting the z3 constraints\n");
-                return ERROR_EXTRACTING_Z3_OFFSET;
-            }
-            z3_add_args[1] = Z3_mk_int64(z3_context, distance, z3_integer);
-            // z3_add <= offset1 + distance
-            z3_add = Z3_mk_add(z3_context, 2, z3_add_args);
-            z3_offset2 = get_z3_offset(offset2_pt, instance2, replica2);
-            if (z3_offset2 == NULL) {
-                printf("Error getting the z3 constraints\n");
-                return ERROR_EXTRACTING_Z3_OFFSET;
-            }
-            // z3_formula = z3_add < offset2
-            z3_formula = Z3_mk_le(z3_context, z3_add, z3_offset2);
-            if (path_selector != NULL) {     // If we have to choose paths
-                // Original constraint OR path = 0
-                z3_or_args[0] = z3_formula;
-                z3_int0 = Z3_mk_int64(z3_context, 0, z3_integer);
-                z3_or_args[1] = Z3_mk_eq(z3_context, path_selector[frame_it][receiver_it][path_it], z3_int0);
-                z3_formula = Z3_mk_or(z3_context, 2, z3_or_args);
-            }
-            Z3_optimize_assert(z3_context, z3_optimize, z3_formula);
-            break;
-        case gurobi:
-            variables[0] = get_gurobi_offset(offset2_pt, instance2, replica2);
-            variables[1] = get_gurobi_offset(offset1_pt, instance1, replica1);
-            variables[2] = gurobi_frame_distance[frame_it];
-            if (gurobi_path_selector == NULL) { // If we have the path given, just add the constraint
-                if (GRBaddconstr(gurobi_model, 3, variables, values, GRB_GREATER_EQUAL, distance + 1, NULL) < 0) {
-                    printf("Error setting minimum distance constraint in gurobi\n");
-                    return ERROR_SETTING_GUROBI_CONSTRAINT;
-                }
-            } else {    // If we have to choose paths, add the constraint if the path selector is 1
-                if (GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_path_selector[frame_it][receiver_it][path_it],
-                                             1, 3, variables, values, GRB_GREATER_EQUAL, distance + 1) < 0) {
-                    printf("Error setting minimum distance constraint with path selector in gurobi\n");
-                    return ERROR_SETTING_GUROBI_CONSTRAINT;
-                }
-            }
-            break;
-        default:
-            break;
+    LinearConstraint constraint;
+    
+    // offset2 - offset1 - frame distance >= distance
+    init_difference(&constraint, get_offset_variable(offset2_pt, instance2, replica2),
+                    get_offset_variable(offset1_pt, instance1, replica1), sense_greater_equal, distance);
+    if (frame_distances != NULL) {
+        add_linear_term(&constraint, frame_distances[frame_it], -1);
+    }
+    if (add_path_constraint(frame_it, receiver_it, path_it, &constraint) < 0) {
+        printf("Error setting minimum distance constraint\n");
+        return ERROR_ADDING_CONSTRAINT;
     }
     
     return 0;
 }
 
-/* PUBLIC FUNCTIONS */
-
 /**
- Initialize the given solver to start the scheduling process
- 
- @param s solver willed to be used and initialize
- @return 0 if done correctly, error code otherwise
- */
-int initialize_solver(Solver s) {
-    
-    // Z3_symbol z3_priority, z3_pareto;
-    
-    switch (s) {
-        case z3:
-            z3_configuration = Z3_mk_config();
-            z3_context = Z3_mk_context(z3_configuration);
-            Z3_del_config(z3_configuration);
-            z3_optimize = Z3_mk_optimize(z3_context);
-            Z3_global_param_set("model", "true");
-            Z3_global_param_set("auto_config", "true");
-            return 0;
-        case gurobi:
-            GRBloadenv(&gurobi_env, "schedule.log");
-            GRBnewmodel(gurobi_env, &gurobi_model, "schedule", 0, NULL, NULL, NULL, NULL, NULL);
-            GRBsetintattr(gurobi_model, GRB_INT_ATTR_MODELSENSE, GRB_MAXIMIZE);
-        default:
-            return OPTIMIZATOR_NOT_IMPLEMENTED;
-    }
-}
+ Adds into the solver the link as a disjunctive resource, so a backend that reasons over resources (as the CP engine)
+ can propagate all the transmissions of the link together instead of every pair of them.
+ The tasks are all the instances of the offsets in the link, the replicas share the time of the replica 0
 
-/**
- Initialize the variables to maximize with the distances between the same frame and the distances with frames of the
- same link. If optimization is 0, we then do not care about such distances and set them always to 0.
- You can give different weights to the distances between frames and links, as the distance in links is usually much
- larger and will have more importance.
- 
- @param optimization 1 if we take care of maximizing distances, 0 oterhwise
- @param weight_frame weight ratio of the frame distance
- @param weight_link weight ratio of the link distance
- @return 0 if done correctly, error code otherwise
+ @param link id of the link
+ @return 0 if everything went ok, error code otherwise
  */
-int initialize_distances(int optimization, double weight_frame, double weight_link) {
-    
-    char name[100];
-    int variables[1];
-    double values[1] = {1.0};
-    gurobi_frame_distance = malloc(sizeof(int) * get_num_frames()); // Allocate memory for every frame distance
-    gurobi_link_distance = malloc(sizeof(int) * get_num_links());   // Allocate memory for every link distance
+int add_link_resource(int link) {
     
-    if (optimization == 0) {
-        weight_frame = 0.0;
-        weight_link = 0.0;
-    }
+    Offset *offset_pt;
+    int *variables;
+    long long int *durations;
+    int num_tasks = 0, capacity = 0;
+    int result;
     
-    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {   // For every frame
-        
-        sprintf(name, "FrameDistance_%d", frame_it);                // Create the distance variable in the solver
-        GRBaddvar(gurobi_model, 0, NULL, NULL, weight_frame, 0, get_end_to_end_delay(get_frame(frame_it)), GRB_INTEGER,
-                  name);
-        gurobi_frame_distance[frame_it] = gurobi_var_counter;
-        gurobi_var_counter++;
-        if (optimization == 0) {        // If no optimization is needed, we equal the distance to 0
-            variables[0] = gurobi_frame_distance[frame_it];
-            GRBaddconstr(gurobi_model, 1, variables, values, GRB_EQUAL, 0, NULL);
-            gurobi_var_counter++;
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        offset_pt = get_frame_offset_by_link(get_frame(frame_it), link);
+        if (offset_pt != NULL && get_offset_state(offset_pt) != offset_excluded) {
+            capacity += get_num_instances(offset_pt);
         }
     }
+    if (capacity < 2) {
+        return 0;
+    }
     
-    for (int link_it = 0; link_it < get_num_links(); link_it++) {     // For every link
-        sprintf(name, "LinkDistance_%d", link_it);                // Create the distance variable in the solverch
-        GRBaddvar(gurobi_model, 0, NULL, NULL, weight_link, 0, get_hyper_period(), GRB_INTEGER, name);
-        gurobi_link_distance[link_it] = gurobi_var_counter;
-        gurobi_var_counter++;
-        if (optimization == 0) {
-            variables[0] = gurobi_link_distance[link_it];
-            GRBaddconstr(gurobi_model, 1, variables, values, GRB_EQUAL, 0, NULL);
-            gurobi_var_counter++;
+    variables = malloc(sizeof(int) * capacity);
+    durations = malloc(sizeof(long long int) * capacity);
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        offset_pt = get_frame_offset_by_link(get_frame(frame_it), link);
+        if (offset_pt == NULL || get_offset_state(offset_pt) == offset_excluded) {
+            continue;
         }
+        // The transmission occupies the link until its separation has passed
+        for (int instance = 0; instance < get_num_instances(offset_pt); instance++) {
+            variables[num_tasks] = get_offset_variable(offset_pt, instance, 0);
+            durations[num_tasks] = get_timeslot_size(offset_pt) + get_link_separation(link);
+            num_tasks++;
+        }
+    }
+    result = backend->add_resource(num_tasks, variables, durations);
+    free(variables);
+    free(durations);
+    if (result < 0) {
+        printf("Error adding the resource of a link\n");
+        return ERROR_ADDING_CONSTRAINT;
     }
     
     return 0;
 }
 
 /**
- Init the variables needed to allow the solver the selection of which path to choose
- 
- @param csolver indicates which solver are we using
- @return 0 if everything was ok, error code otherwise
+ Print the given group of constraints of a conflict, with the links of its path or the link where the frames contend
+
+ @param group_pt pointer to the group
  */
-int init_path_selector(Solver csolver) {
+void print_conflict_group(ConflictGroup *group_pt) {
     
-    Frame *frame_pt;
-    int num_paths;                              // Number of paths to arrive
-    int num_receivers;                          // Number of receivers of the frame
-    int receiver;                             //  reciever of the frame
-    int sender;                                 // Sender of the frame
-    Z3_sort z3_integer = NULL;
-    Z3_symbol z3_name;
-    Z3_ast z3_add, z3_formula, z3_1, z3_0;
-    double *values = NULL;
-    char name[100];
+    Frame *frame_pt = get_frame(group_pt->frame);
+    Path *path_pt;
     
-    // For all given frames, check how many paths to we have, for each path allocate memory in the array and create
-    // the constraints
-    switch (csolver) {
-        case z3:
-            path_selector = malloc(sizeof(Z3_ast **) * get_num_frames());    // Create an array, one per each frame
-            z3_integer = Z3_mk_int_sort(z3_context);
+    switch (group_pt->type) {
+        case path_dependent_conflict:
+        case end_to_end_conflict:
+            path_pt = get_frame_path(frame_pt, group_pt->receiver, group_pt->path);
+            printf("    %s of frame %d to end system %d through links",
+                   group_pt->type == path_dependent_conflict ? "Path dependency" : "End to end delay", group_pt->frame,
+                   get_receiver_id(frame_pt, group_pt->receiver));
+            for (int link_it = 0; link_it < path_pt->length; link_it++) {
+                printf(" %d", path_pt->path[link_it]);
+            }
+            printf("\n");
             break;
-        case gurobi:
-            gurobi_path_selector = malloc(sizeof(int **) * get_num_frames());
+        case contention_conflict:
+            printf("    Contention of frames %d and %d in link %d\n", group_pt->other_frame, group_pt->frame,
+                   group_pt->link);
             break;
         default:
             break;
     }
-    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
-        frame_pt = get_frame(frame_it);
-        sender = get_sender_id(frame_pt);
-        num_receivers = get_num_receivers(frame_pt);
-        switch (csolver) {
-            case z3:
-                path_selector[frame_it] = malloc(sizeof(Z3_ast *) * num_receivers);
-                break;
-            case gurobi:
-                gurobi_path_selector[frame_it] = malloc(sizeof(int *) * num_receivers);
-                break;
-            default:
-                break;
+}
+
+/* PUBLIC FUNCTIONS */
+
+/**
+ Init the variable of an offset that was fixed in a previous stage, so it keeps its transmission time.
+ It is a constant of the solver, and if the solver selects the paths, the offset is always used
+
+ @param offset_pt pointer to the offset
+ @param instance instance of the offset
+ @param replica replica of the offset
+ @return 0 if done correctly, error code otherwise
+ */
+int init_fixed_variable(Offset *offset_pt, int instance, int replica) {
+    
+    long long int value = get_offset(offset_pt, instance, replica);
+    int variable;
+    
+    variable = backend->new_var(value, value, integer_domain, -1, NULL);
+    if (variable < 0) {
+        printf("Error creating the variable of a fixed offset\n");
+        return ERROR_CREATING_VARIABLE;
+    }
+    set_offset_variable(offset_pt, instance, replica, variable);
+    // The literal is shared by all instances and replicas, so it is only created once
+    if (path_selector != NULL && instance == 0 && replica == 0) {
+        variable = backend->new_var(1, 1, boolean_domain, -1, NULL);
+        if (variable < 0) {
+            printf("Error creating the literal of a fixed offset\n");
+            return ERROR_CREATING_VARIABLE;
         }
-        for (int receiver_it = 0; receiver_it < num_receivers; receiver_it++) {         // For all the receivers
-            receiver = get_receiver_id(frame_pt, receiver_it);
-            num_paths = get_num_paths(sender, receiver);
-            switch (csolver) {
-                case z3:
-                    path_selector[frame_it][receiver_it] = malloc(sizeof(Z3_ast) * num_paths);
-                    break;
-                case gurobi:
-                    gurobi_path_selector[frame_it][receiver_it] = malloc(sizeof(int) * num_paths);
-                    values = malloc(sizeof(double) * num_paths);
-                    break;
-                default:
-                    break;
+        set_offset_used(offset_pt, variable);
+    }
+    return 0;
+}
+/**
+ Check if a constraint between the two given offsets belongs to the current stage, which is not the case if one of them
+ is excluded or if both are already fixed
+
+ @param offset1_pt pointer to the first offset
+ @param offset2_pt pointer to the second offset
+ @return 1 if the constraint has to be added, 0 otherwise
+ */
+int offsets_in_stage(Offset *offset1_pt, Offset *offset2_pt) {
+    
+    if (get_offset_state(offset1_pt) == offset_excluded || get_offset_state(offset2_pt) == offset_excluded) {
+        return 0;
+    }
+    if (get_offset_state(offset1_pt) == offset_fixed && get_offset_state(offset2_pt) == offset_fixed) {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ Check if any offset of the given frame was fixed in a previous stage
+
+ @param frame_pt pointer to the frame
+ @return 1 if the frame has fixed offsets, 0 otherwise
+ */
+int frame_has_fixed_offsets(Frame *frame_pt) {
+    
+    Offset *offset_pt = get_offset_root(frame_pt);
+    
+    while (!is_last_offset(offset_pt)) {
+        if (get_offset_state(offset_pt) == offset_fixed) {
+            return 1;
+        }
+        offset_pt = get_next_offset(offset_pt);
+    }
+    return 0;
+}
+
+/**
+ Search the first link shared by all the paths of the given frame, which is always used whatever path is chosen
+
+ @param frame_pt pointer to the frame
+ @return identifier of the link, -1 if the paths do not start in the same link
+ */
+int get_common_first_link(Frame *frame_pt) {
+    
+    Path *path_pt;
+    int first_link = -1;
+    
+    for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+        for (int path_it = 0; path_it < get_frame_num_paths(frame_pt, receiver_it); path_it++) {
+            path_pt = get_frame_path(frame_pt, receiver_it, path_it);
+            if (first_link == -1) {
+                first_link = path_pt->path[0];
+            } else if (first_link != path_pt->path[0]) {
+                return -1;
             }
-            for (int path_it = 0; path_it < num_paths; path_it++) {                     // Init the constraint
-                sprintf(name, "X_%d_%d_%d", frame_it, receiver_it, path_it);
-                switch (csolver) {
-                    case z3:
-                        z3_name = Z3_mk_string_symbol(z3_context, name);
-                        path_selector[frame_it][receiver_it][path_it] = Z3_mk_const(z3_context, z3_name, z3_integer);
-                        // Limit the path selector to 0 or 1
-                        z3_0 = Z3_mk_int(z3_context, 0, z3_integer);
-                        z3_1 = Z3_mk_int(z3_context, 1, z3_integer);
-                        z3_formula = Z3_mk_ge(z3_context, path_selector[frame_it][receiver_it][path_it], z3_0);
-                        Z3_optimize_assert(z3_context, z3_optimize, z3_formula);
-                        z3_formula = Z3_mk_le(z3_context, path_selector[frame_it][receiver_it][path_it], z3_1);
-                        Z3_optimize_assert(z3_context, z3_optimize, z3_formula);
-                        break;
-                    case gurobi:
-                        GRBaddvar(gurobi_model, 0, NULL, NULL, 0, 0, 1, GRB_BINARY, name);
-                        gurobi_path_selector[frame_it][receiver_it][path_it] = gurobi_var_counter;
-                        gurobi_var_counter++;
-                        values[path_it] = 1.0;
-                        break;
-                    default:
-                        break;
+        }
+    }
+    
+    return first_link;
+}
+
+/**
+ Create a latency variable in the solver, it can not be negative and it is bounded by the end to end delay of the frame
+
+ @param frame_it identifier of the frame, -1 for the maximum latency of all frames
+ @return 0 if done correctly, error code otherwise
+ */
+int create_latency_variable(int frame_it) {
+    
+    int index;
+    int variable;
+    long long int upper = 0;
+    
+    index = add_variable_info(latency_variable, frame_it, -1, -1, -1, -1, -1);
+    if (frame_it == -1) {
+        // The maximum latency is never larger than the largest end to end delay
+        for (int it = 0; it < get_num_frames(); it++) {
+            if (get_end_to_end_delay(get_frame(it)) > upper) {
+                upper = get_end_to_end_delay(get_frame(it));
+            }
+        }
+    } else {
+        upper = get_end_to_end_delay(get_frame(frame_it));
+    }
+    variable = new_variable(index, 0, upper, integer_domain);
+    if (variable < 0) {
+        printf("Error adding the latency variable\n");
+        return ERROR_CREATING_VARIABLE;
+    }
+    if (frame_it == -1) {
+        maximum_latency = variable;
+    } else {
+        frame_latencies[frame_it] = variable;
+    }
+    return 0;
+}
+
+/**
+ Adds into the solver a constraint to bound the latency of a frame with the given path
+ latency >= last_offset + timeslot - first_offset
+ 
+ @param first_offset_pt pointer to the offset of the first link of the path
+ @param last_offset_pt pointer to the offset of the last link of the path
+ @param frame_it id of the frame
+ @param receiver_it id of the receiver
+ @param path_it id of the path
+ @return 0 if everything went ok, error code otherwise
+ */
+int set_latency_bound(Offset *first_offset_pt, Offset *last_offset_pt, int frame_it, int receiver_it, int path_it) {
+    
+    LinearConstraint constraint;
+    
+    // latency + first_offset - last_offset >= timeslot
+    init_difference(&constraint, frame_latencies[frame_it], get_offset_variable(last_offset_pt, 0, 0),
+                    sense_greater_equal, get_timeslot_size(last_offset_pt));
+    add_linear_term(&constraint, get_offset_variable(first_offset_pt, 0, 0), 1);
+    if (add_path_constraint(frame_it, receiver_it, path_it, &constraint) < 0) {
+        printf("Error setting latency constraint\n");
+        return ERROR_ADDING_CONSTRAINT;
+    }
+    
+    return 0;
+}
+
+/**
+ Creates the latency variable of every frame with its first and last transmission in the current stage, bounded by all
+ its paths, and the maximum latency of all of them. Frames with both offsets fixed have a constant latency and are not
+ optimized
+
+ @return 0 if done correctly, error code otherwise
+ */
+int init_latency_variables(void) {
+    
+    Frame *frame_pt;                            // Frame pointer
+    Path *path_pt;                              // Path pointer
+    Offset *first_offset_pt, *last_offset_pt;   // Offset pointer to the first and last offsets of a possible path
+    LinearConstraint constraint;
+    
+    // The latencies of a previous model are not valid anymore
+    free(frame_latencies);
+    frame_latencies = malloc(sizeof(int) * get_num_frames());
+    if (create_latency_variable(-1) < 0) {
+        return ERROR_LATENCY_CONSTRAINTS;
+    }
+    
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        frame_latencies[frame_it] = NO_VARIABLE;
+        for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+            for (int path_it = 0; path_it < get_frame_num_paths(frame_pt, receiver_it); path_it++) {
+                path_pt = get_frame_path(frame_pt, receiver_it, path_it);
+                first_offset_pt = get_frame_offset_by_link(frame_pt, path_pt->path[0]);
+                last_offset_pt = get_frame_offset_by_link(frame_pt, path_pt->path[path_pt->length - 1]);
+                if (offsets_in_stage(first_offset_pt, last_offset_pt) == 0) {
+                    continue;
+                }
+                if (frame_latencies[frame_it] == NO_VARIABLE && create_latency_variable(frame_it) < 0) {
+                    return ERROR_LATENCY_CONSTRAINTS;
+                }
+                if (set_latency_bound(first_offset_pt, last_offset_pt, frame_it, receiver_it, path_it) < 0) {
+                    return ERROR_LATENCY_CONSTRAINTS;
                 }
-                
             }
-            // Add that the constraint can only be 1
-            switch (csolver) {
-                case z3:
-                    z3_add = Z3_mk_add(z3_context, num_paths, path_selector[frame_it][receiver_it]);
-                    z3_1 = Z3_mk_int(z3_context, 1, z3_integer);
-                    z3_formula = Z3_mk_eq(z3_context, z3_add, z3_1);
-                    Z3_optimize_assert(z3_context, z3_optimize, z3_formula);
-                    break;
-                case gurobi:
-                    GRBaddconstr(gurobi_model, num_paths, gurobi_path_selector[frame_it][receiver_it], values,
-                                 GRB_EQUAL, 1, NULL);
-                    free(values);
-                default:
-                    break;
+        }
+        if (frame_latencies[frame_it] == NO_VARIABLE) {
+            continue;
+        }
+        
+        // The maximum latency is larger than the latency of every frame
+        init_difference(&constraint, maximum_latency, frame_latencies[frame_it], sense_greater_equal, 0);
+        if (backend->add_diff(&constraint) < 0) {
+            printf("Error setting maximum latency constraint\n");
+            return ERROR_LATENCY_CONSTRAINTS;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ Add the given latency objective into the solver, the sum of the latencies of all frames or the maximum latency.
+ Backends maximize, so the latencies have a negative coefficient
+
+ @param objective latency objective
+ @return 0 if done correctly, error code otherwise
+ */
+int set_latency_objective(ObjectiveType objective) {
+    
+    int *variables;
+    double *values;
+    int num_latencies = 0;
+    int result;
+    
+    variables = malloc(sizeof(int) * (get_num_frames() + 1));
+    values = malloc(sizeof(double) * (get_num_frames() + 1));
+    if (objective == latency_max_objective) {
+        variables[num_latencies] = maximum_latency;
+        values[num_latencies] = -1.0;
+        num_latencies++;
+    } else {
+        for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+            if (frame_latencies[frame_it] != NO_VARIABLE) {
+                variables[num_latencies] = frame_latencies[frame_it];
+                values[num_latencies] = -1.0;
+                num_latencies++;
             }
         }
     }
+    // Without latencies in the current stage there is nothing to minimize
+    result = num_latencies > 0 ? backend->set_objective(num_latencies, variables, values) : 0;
+    free(variables);
+    free(values);
+    if (result < 0) {
+        printf("Error setting the latency objective\n");
+        return ERROR_SETTING_OBJECTIVES;
+    }
+    return 0;
+}
+
+/**
+ Add the weighted sum of the frame and link distances as an objective into the solver
+
+ @return 0 if done correctly, error code otherwise
+ */
+int set_distance_objective(void) {
+    
+    int *variables;
+    double *values;
+    int num_distances = 0;
+    int result;
+    
+    if (frame_distances == NULL) {
+        printf("The distance objective needs a MIP solver, %s ignores it\n", backend->name);
+        return 0;
+    }
+    variables = malloc(sizeof(int) * (get_num_frames() + get_num_links()));
+    values = malloc(sizeof(double) * (get_num_frames() + get_num_links()));
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        variables[num_distances] = frame_distances[frame_it];
+        values[num_distances] = frame_distance_weight;
+        num_distances++;
+    }
+    for (int link_it = 0; link_it < get_num_links(); link_it++) {
+        variables[num_distances] = link_distances[link_it];
+        values[num_distances] = link_distance_weight;
+        num_distances++;
+    }
+    result = backend->set_objective(num_distances, variables, values);
+    free(variables);
+    free(values);
+    if (result < 0) {
+        printf("Error setting the distance objective\n");
+        return ERROR_SETTING_OBJECTIVES;
+    }
+    return 0;
+}
+
+/**
+ Add the weighted number of scheduled frames as an objective into the solver, every frame counts 1 or its priority
+ class plus one if the frames are weighted
+
+ @return 0 if done correctly, error code otherwise
+ */
+int set_scheduled_objective(void) {
+    
+    double *values;
+    int result;
+    
+    values = malloc(sizeof(double) * get_num_frames());
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        values[frame_it] = scheduled_weighted == 1 ? get_priority(get_frame(frame_it)) + 1.0 : 1.0;
+    }
+    result = backend->set_objective(get_num_frames(), frame_scheduled, values);
+    free(values);
+    if (result < 0) {
+        printf("Error setting the scheduled frames objective\n");
+        return ERROR_SETTING_OBJECTIVES;
+    }
+    return 0;
+}
+
+/**
+ Set if the variables of the solver are created with a human readable name.
+ Names are only useful to debug, so by default variables are identified by their index in the variables table
+ 
+ @param names 1 to name the variables, 0 to identify them by their index
+ */
+void set_variable_names(int names) {
+    
+    variable_names = names;
+}
+
+/**
+ Get the information of the variable with the given index in the variables table
+ 
+ @param index index of the variable
+ @return pointer to the variable information, NULL if the index does not exist
+ */
+VariableInfo * get_variable_info(int index) {
+    
+    if (index < 0 || index >= num_variables_table) {
+        printf("The variable index is out of range\n");
+        return NULL;
+    }
+    
+    return &variables_table[index];
+}
+
+/**
+ Reconstruct the human readable name of the variable with the given index in the variables table
+ 
+ @param index index of the variable
+ @param name string where the name is written (at least 100 characters)
+ @return 0 if done correctly, error code otherwise
+ */
+int get_variable_name(int index, char *name) {
+    
+    VariableInfo *info;
+    
+    info = get_variable_info(index);
+    if (info == NULL) {
+        return VARIABLE_INDEX_OUT_OF_RANGE;
+    }
+    
+    switch (info->type) {
+        case offset_variable:
+            sprintf(name, "O_%d_%d_%d_%d", info->frame, info->instance, info->replica, info->link);
+            break;
+        case path_selector_variable:
+            sprintf(name, "X_%d_%d_%d", info->frame, info->receiver, info->path);
+            break;
+        case frame_distance_variable:
+            sprintf(name, "FrameDistance_%d", info->frame);
+            break;
+        case link_distance_variable:
+            sprintf(name, "LinkDistance_%d", info->link);
+            break;
+        case latency_variable:
+            if (info->frame == -1) {
+                sprintf(name, "MaxLatency");
+            } else {
+                sprintf(name, "Latency_%d", info->frame);
+            }
+            break;
+        case spacing_variable:
+            sprintf(name, "Spacing");
+            break;
+        case offset_used_variable:
+            sprintf(name, "U_%d_%d", info->frame, info->link);
+            break;
+        case frame_scheduled_variable:
+            sprintf(name, "S_%d", info->frame);
+            break;
+        case tracking_variable:
+            sprintf(name, "T_%d_%d_%d_%d", info->frame, info->link, info->receiver, info->path);
+            break;
+        default:
+            break;
+    }
+    return 0;
+}
+
+/**
+ Set the format and the file to export the model when it is generated. It is disabled by default.
+ SMT-LIB2 is written incrementally while the constraints are added (z3), LP and MPS are written by the solver once the
+ model is finished (gurobi and HiGHS) and DIMACS is written with the clauses of the SAT encoding before solving them
+ 
+ @param format format of the exported model, no_export to disable it
+ @param filename name of the file to write the model
+ @return 0 if done correctly, error code otherwise
+ */
+int set_model_export(ExportFormat format, char *filename) {
+    
+    export_format = format;
+    if (format == no_export) {
+        return 0;
+    }
+    if (filename == NULL || strlen(filename) >= sizeof(export_filename)) {
+        printf("The export file name is not valid\n");
+        return EXPORT_FILE_NOT_OPENED;
+    }
+    strcpy(export_filename, filename);
+    return 0;
+}
+
+/**
+ Set the objectives to optimize when the model is generated, combined lexicographically (the first one is the most
+ important). Without objectives, the distances are maximized by the MIP solvers and z3 only looks for a feasible
+ schedule
+ 
+ @param objectives_list array with the objectives ordered from the most to the least important
+ @param num number of objectives, 0 to use the default behaviour
+ @return 0 if done correctly, error code otherwise
+ */
+int set_objectives(ObjectiveType *objectives_list, int num) {
+    
+    if (num > MAX_OBJECTIVES) {
+        printf("At most %d objectives can be combined\n", MAX_OBJECTIVES);
+        return TOO_MANY_OBJECTIVES;
+    }
+    for (int objective_it = 0; objective_it < num; objective_it++) {
+        objectives[objective_it] = objectives_list[objective_it];
+    }
+    num_objectives = num;
+    return 0;
+}
+
+/**
+ Set if the next models are built with a tracking literal in every group of constraints (every path of every frame and
+ every pair of frames in a link), so the groups in conflict can be explained if there is no schedule. The symmetry
+ breaking constraints, the link resources and the objectives are not added to the tracked models
+ 
+ @param tracking 1 to track the groups of constraints, 0 otherwise
+ */
+void set_conflict_tracking(int tracking) {
+    
+    conflict_tracking = tracking;
+}
+
+/**
+ Initialize the given solver to start the scheduling process, freeing the model of the previous one.
+ The solver is the name of a built in backend (z3, gurobi, highs, cp or sat) or the path of a shared library with a
+ backend
+ 
+ @param name name of the solver willed to be used and initialized
+ @return 0 if done correctly, error code otherwise
+ */
+int initialize_solver(char *name) {
+    
+    SolverBackend *new_backend;
+    
+    new_backend = get_solver_backend(name);
+    if (new_backend == NULL) {
+        printf("The solver %s is not available\n", name);
+        return SOLVER_NOT_AVAILABLE;
+    }
+    if (backend != NULL) {              // Free the model of a previous stage
+        backend->destroy();
+    }
+    backend = new_backend;
+    
+    num_variables_table = 0;            // The variables of a previous model are not valid anymore
+    path_selector = NULL;
+    link_spacing = NO_VARIABLE;
+    maximum_latency = NO_VARIABLE;
+    free(frame_latencies);
+    frame_latencies = NULL;
+    frame_distances = NULL;
+    link_distances = NULL;
+    frame_distance_weight = 0.0;
+    link_distance_weight = 0.0;
+    num_ordered_intersections = 0;
+    num_removed_intersections = 0;
+    free(frame_scheduled);
+    frame_scheduled = NULL;
+    num_conflict_groups = 0;
+    tracking_literal = NO_VARIABLE;
+    
+    if (backend->create() < 0) {
+        printf("Error creating the model of %s\n", backend->name);
+        return SOLVER_NOT_AVAILABLE;
+    }
+    if (export_format != no_export) {
+        if (backend->open_export == NULL) {
+            printf("The solver %s cannot export the model\n", backend->name);
+            return BACKEND_OPERATION_NOT_SUPPORTED;
+        }
+        return backend->open_export(export_format, export_filename);
+    }
+    return 0;
+}
+
+/**
+ Initialize the variables to maximize with the distances between the same frame and the distances with frames of the
+ same link. If optimization is 0, we then do not care about such distances and set them always to 0.
+ You can give different weights to the distances between frames and links, as the distance in links is usually much
+ larger and will have more importance. Only solvers that can maximize them have distances (MIP solvers).
+ 
+ @param optimization 1 if we take care of maximizing distances, 0 oterhwise
+ @param weight_frame weight ratio of the frame distance
+ @param weight_link weight ratio of the link distance
+ @return 0 if done correctly, error code otherwise
+ */
+int initialize_distances(int optimization, double weight_frame, double weight_link) {
+    
+    int index;
+    
+    if (backend->distances == 0) {      // The solver cannot maximize the distances
+        return 0;
+    }
+    frame_distances = malloc(sizeof(int) * get_num_frames());   // Allocate memory for every frame distance
+    link_distances = malloc(sizeof(int) * get_num_links());     // Allocate memory for every link distance
+    
+    if (optimization == 0) {
+        weight_frame = 0.0;
+        weight_link = 0.0;
+    }
+    frame_distance_weight = weight_frame;
+    link_distance_weight = weight_link;
+    
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {   // For every frame
+        index = add_variable_info(frame_distance_variable, frame_it, -1, -1, -1, -1, -1);
+        // If no optimization is needed, the distance is always 0
+        frame_distances[frame_it] = new_variable(index, 0,
+                                                 optimization == 0 ? 0 : get_end_to_end_delay(get_frame(frame_it)),
+                                                 integer_domain);
+        if (frame_distances[frame_it] < 0) {
+            printf("Error creating the frame distance variable\n");
+            return ERROR_CREATING_VARIABLE;
+        }
+    }
+    
+    for (int link_it = 0; link_it < get_num_links(); link_it++) {     // For every link
+        index = add_variable_info(link_distance_variable, -1, -1, -1, link_it, -1, -1);
+        link_distances[link_it] = new_variable(index, 0, optimization == 0 ? 0 : get_hyper_period(), integer_domain);
+        if (link_distances[link_it] < 0) {
+            printf("Error creating the link distance variable\n");
+            return ERROR_CREATING_VARIABLE;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ Init the variables needed to allow the solver the selection of which path to choose
+ 
+ @return 0 if everything was ok, error code otherwise
+ */
+int init_path_selector(void) {
+    
+    Frame *frame_pt;
+    int num_paths;                              // Number of paths to arrive
+    int num_receivers;                          // Number of receivers of the frame
+    int index;
+    
+    if (backend->add_or == NULL || backend->add_exactly_one == NULL) {
+        printf("The solver %s cannot select the paths\n", backend->name);
+        return BACKEND_OPERATION_NOT_SUPPORTED;
+    }
+    
+    // For all given frames, check how many paths to we have, for each path allocate memory in the array and create
+    // the constraints
+    path_selector = malloc(sizeof(int **) * get_num_frames());     // Create an array, one per each frame
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        num_receivers = get_num_receivers(frame_pt);
+        path_selector[frame_it] = malloc(sizeof(int *) * num_receivers);
+        for (int receiver_it = 0; receiver_it < num_receivers; receiver_it++) {         // For all the receivers
+            num_paths = get_frame_num_paths(frame_pt, receiver_it);
+            path_selector[frame_it][receiver_it] = malloc(sizeof(int) * num_paths);
+            for (int path_it = 0; path_it < num_paths; path_it++) {
+                index = add_variable_info(path_selector_variable, frame_it, -1, -1, -1, receiver_it, path_it);
+                // The path selector is a boolean literal, true if the path is chosen
+                path_selector[frame_it][receiver_it][path_it] = new_variable(index, 0, 1, boolean_domain);
+                if (path_selector[frame_it][receiver_it][path_it] < 0) {
+                    printf("Error creating the path selector\n");
+                    return ERROR_CREATING_VARIABLE;
+                }
+            }
+            // Add that only one path can be chosen
+            if (backend->add_exactly_one(num_paths, path_selector[frame_it][receiver_it]) < 0) {
+                printf("Error choosing only one path\n");
+                return ERROR_ADDING_CONSTRAINT;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ Init the literal of every frame that is true if the frame is scheduled. All the constraints of a frame only hold if it
+ is scheduled, and the weighted number of scheduled frames is the most important objective, so the solver finds the
+ largest subset of frames that can be scheduled together instead of failing if the network is overloaded
+ 
+ @param weighted 1 to weight every frame with its priority class plus one, 0 to count the scheduled frames
+ @return 0 if everything was ok, error code otherwise
+ */
+int init_frame_scheduled(int weighted) {
+    
+    int index;
+    
+    scheduled_weighted = weighted;
+    frame_scheduled = malloc(sizeof(int) * get_num_frames());
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        index = add_variable_info(frame_scheduled_variable, frame_it, -1, -1, -1, -1, -1);
+        frame_scheduled[frame_it] = new_variable(index, 0, 1, boolean_domain);
+        if (frame_scheduled[frame_it] < 0) {
+            printf("Error creating the frame scheduled literal\n");
+            return ERROR_CREATING_VARIABLE;
+        }
+    }
     return 0;
 }
 
 /**
  Creates the offset variables for all frames in the network, then adds them into the logical context
  
- @param csolver indicates which solver are we using
  @return 0 if everything was ok, error code otherwise
  */
-int create_offset_variables(Solver csolver) {
+int create_offset_variables(void) {
     
     Frame *frame_pt;                    // Pointer to a frame of the network
     Offset *offset_pt;                  // Pointer to the frame offset
     int num_frames;                     // Number of frames in the network
-    char name[100];                     // Name to identify variables
+    int index;                          // Index of the variable in the variables table
     long long int distance;
     long long int maximum_time;         // Maximum time allowed to start the transmission of an offset
     long long int minimum_time;         // Minimum time allowed to start the transmission of an offset
@@ -776,123 +1427,51 @@ int create_offset_variables(Solver csolver) {
         frame_pt = get_frame(frame_it);
         offset_pt = get_offset_root(frame_pt);
         while (!is_last_offset(offset_pt)) {        // For all the frame offsets
+            // Offsets of other stages are not in the model, and fixed offsets just keep their transmission times
+            if (get_offset_state(offset_pt) != offset_free) {
+                for (int instance = 0; instance < get_num_instances(offset_pt); instance++) {
+                    for (int replica = 0; replica < get_num_replicas(offset_pt); replica++) {
+                        if (get_offset_state(offset_pt) == offset_fixed &&
+                            init_fixed_variable(offset_pt, instance, replica) < 0) {
+                            printf("Error fixing the offset of a previous stage\n");
+                            return ERROR_INIT_CONSTRAINTS;
+                        }
+                    }
+                }
+                offset_pt = get_next_offset(offset_pt);
+                continue;
+            }
+            // If the paths are chosen by the solver, the offset needs a literal to know if it is used
+            if (path_selector != NULL && init_used_literal(offset_pt, frame_it) < 0) {
+                printf("Error creating the literal of a used offset\n");
+                return ERROR_INIT_CONSTRAINTS;
+            }
             // For all replicas and instances
             for (int instance = 0; instance < get_num_instances(offset_pt); instance++) {
                 for (int replica = 0; replica < get_num_replicas(offset_pt); replica++) {
-                    sprintf(name, "O_%d_%d_%d_%d", frame_it, instance, replica, get_offset_link(offset_pt));
-                    init_variable(offset_pt, instance, replica, name, csolver);
+                    index = add_variable_info(offset_variable, frame_it, instance, replica,
+                                              get_offset_link(offset_pt), -1, -1);
                     
                     // Set the minimum and maximum transmission time for the offset, note that we only do it for the
                     // instance 0, replica 0, as the time between different instances and replicas are related to 0, 0
-                    // We need to extract the transmission time of the offset to the deadline to allow it to finish
-                    maximum_time = get_deadline(frame_pt) - get_timeslot_size(offset_pt);
+                    // The window already leaves time to finish the transmission before the deadline
+                    maximum_time = get_offset_latest(offset_pt);
                     maximum_time = maximum_time + (get_period(frame_pt) * instance);
-                    minimum_time = get_starting(frame_pt);
+                    minimum_time = get_offset_earliest(offset_pt);
                     minimum_time = minimum_time + (get_period(frame_pt) * instance);
-                    if (set_offset_range(offset_pt, instance, replica, minimum_time, maximum_time, name, csolver) < 0) {
+                    if (set_offset_range(offset_pt, instance, replica, minimum_time, maximum_time, index) < 0) {
                         printf("Error setting the allowed range for the offset\n");
                         return ERROR_INIT_CONSTRAINTS;
                     }
                     // Set the fixed distances between the instance and replica 0 with the rest
                     if (instance != 0 || replica != 0) {
-                        distance = get_period(frame_pt) * instance;
-                        if (set_fixed_distance(offset_pt, 0, 0, offset_pt, instance, replica, distance, csolver) < 0) {
-                            printf("Error setting the distance between instance and replicas of the same frame\n");
-                            return ERROR_INIT_CONSTRAINTS;
-                        }
-                    }
-                }
-            }
-            offset_pt = get_next_offset(offset_pt);
-        }
-    }
-    return 0;
-}
-
-/**
- Add constraints for the solver to choose the paths of frames. For now, we allow only one possible path, chosen by the
- solver
- 
- @return 0 if everything was ok, error code otherwise
- */
-int choose_path_z3() {
-    
-    Frame *frame_pt;                            // Frame pointer
-    Offset *offset_pt;                          // Pointer to the frame offset
-    Path *path_pt;                              // Path pointer
-    int num_paths;                              // Number of paths to arrive
-    int num_receivers;                          // Number of receivers of the frame
-    int receiver;                             //  reciever of the frame
-    int sender;                                 // Sender of the frame
-    Z3_sort z3_integer;
-    Z3_ast *z3_add_args = NULL;
-    Z3_ast *z3_or_args = NULL;
-    Z3_ast z3_formula, z3_1, z3_0, z3_offset_eq0, z3_offset, z3_path_selectors_add;
-    Z3_ast z3_path_selectros_larger_1, z3_offset_larger_1;
-    int num_add_args, num_or_args;
-    
-    // For all given frames, check how many paths to we have, for each path allocate memory in the array and create
-    // the constraints
-    z3_integer = Z3_mk_int_sort(z3_context);
-    z3_1 = Z3_mk_int(z3_context, 1, z3_integer);
-    z3_0 = Z3_mk_int(z3_context, 0, z3_integer);
-    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
-        frame_pt = get_frame(frame_it);
-        offset_pt = get_offset_root(frame_pt);
-        sender = get_sender_id(frame_pt);
-        num_receivers = get_num_receivers(frame_pt);
-        while (!is_last_offset(offset_pt)) {        // For all the frame offsets
-            // Now, for every path, check if the offset appears to add the initalization
-            num_or_args = 0;
-            z3_or_args = NULL;
-            for (int receiver_it = 0; receiver_it < num_receivers; receiver_it++) {
-                receiver = get_receiver_id(frame_pt, receiver_it);
-                num_paths = get_num_paths(sender, receiver);
-                num_add_args = 0;
-                z3_add_args = NULL;
-                for (int path_it = 0; path_it < num_paths; path_it++) {
-                    path_pt = get_path(sender, receiver, path_it);
-                    for (int link_it = 0; link_it < path_pt->length; link_it++) {
-                        // If the offset is in the path, we have to add the constraint
-                        if (path_pt->path[link_it] == get_offset_link(offset_pt)) {
-                            num_add_args++;
-                            z3_add_args = realloc(z3_add_args, sizeof(Z3_ast) * num_add_args);
-                            z3_add_args[num_add_args - 1] = path_selector[frame_it][receiver_it][path_it];
+                        distance = get_period(frame_pt) * instance;
+                        if (set_fixed_distance(offset_pt, 0, 0, offset_pt, instance, replica, distance) < 0) {
+                            printf("Error setting the distance between instance and replicas of the same frame\n");
+                            return ERROR_INIT_CONSTRAINTS;
                         }
                     }
                 }
-                if (num_add_args != 0) {    // Only if we have at least one offset (it can happen that there
-                    // is not as frames can have many receivers, so we can have an offset not appearing in the
-                    // current receiver
-                    // When all the paths have been investigated, the summation should be multiplied by offset
-                    z3_offset = get_z3_offset(offset_pt, 0, 0);
-                    if (num_add_args > 1) {     // Only add if there is more than 1 possible path
-                        z3_path_selectors_add = Z3_mk_add(z3_context, num_add_args, z3_add_args);
-                    } else {
-                        z3_path_selectors_add = z3_add_args[0];
-                    }
-                    z3_path_selectros_larger_1 = Z3_mk_ge(z3_context, z3_path_selectors_add, z3_1);
-                    z3_offset_larger_1 = Z3_mk_ge(z3_context, z3_offset, z3_1);
-                    z3_offset_eq0 = Z3_mk_eq(z3_context, z3_offset, z3_0);
-                    z3_formula = Z3_mk_ite(z3_context, z3_path_selectros_larger_1, z3_offset_larger_1, z3_offset_eq0);
-                    // Now we save everything to OR it with all possible receivers, as a link may be used in
-                    // others receivers
-                    num_or_args++;
-                    z3_or_args = realloc(z3_or_args, sizeof(Z3_ast) * num_or_args);
-                    z3_or_args[num_or_args - 1] = z3_formula;
-                    
-                }
-                free(z3_add_args);
-            }
-            // If tere is more than 1 appearance of the link in the receivers, create or, if not ignore
-            if (num_or_args != 0) {
-                if (num_or_args > 1) {
-                    z3_formula = Z3_mk_or(z3_context, num_or_args, z3_or_args);
-                } else {
-                    z3_formula = z3_or_args[0];
-                }
-                Z3_optimize_assert(z3_context, z3_optimize, z3_formula);
-                free(z3_or_args);
             }
             offset_pt = get_next_offset(offset_pt);
         }
@@ -902,77 +1481,55 @@ int choose_path_z3() {
 
 /**
  Add constraints for the solver to choose the paths of frames. For now, we allow only one possible path, chosen by the
- solver
+ solver. The offset of every link is used if and only if any chosen path has the link
  
  @return 0 if everything was ok, error code otherwise
  */
-int choose_path_gurobi() {
+int choose_path(void) {
     
     Frame *frame_pt;                            // Frame pointer
     Offset *offset_pt;                          // Pointer to the frame offset
     Path *path_pt;                              // Path pointer
     int num_paths;                              // Number of paths to arrive
     int num_receivers;                          // Number of receivers of the frame
-    int receiver;                             //reciever of the frame
-    int sender;
-    int num_add_args, num_or_args;
-    int *add_path_selectors = NULL;
-    int *or_path_selectors = NULL;
-    int variables[1];
-    double values[1] = {1.0};
+    int *or_args = NULL;
+    int num_or_args;
     
     for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
         frame_pt = get_frame(frame_it);
         offset_pt = get_offset_root(frame_pt);
-        sender = get_sender_id(frame_pt);
         num_receivers = get_num_receivers(frame_pt);
         while (!is_last_offset(offset_pt)) {        // For all the frame offsets
-            // Now, for every path, check if the offset appears to add the initalization
+            // Only the offsets of the current stage have their own literal
+            if (get_offset_state(offset_pt) != offset_free) {
+                offset_pt = get_next_offset(offset_pt);
+                continue;
+            }
+            // Now, for every path of every receiver, check if the offset appears to add its path selector
             num_or_args = 0;
-            or_path_selectors = NULL;
+            or_args = NULL;
             for (int receiver_it = 0; receiver_it < num_receivers; receiver_it++) {
-                receiver = get_receiver_id(frame_pt, receiver_it);
-                num_paths = get_num_paths(sender, receiver);
-                num_add_args = 0;
-                add_path_selectors = NULL;
+                num_paths = get_frame_num_paths(frame_pt, receiver_it);
                 for (int path_it = 0; path_it < num_paths; path_it++) {
-                    path_pt = get_path(sender, receiver, path_it);
+                    path_pt = get_frame_path(frame_pt, receiver_it, path_it);
                     for (int link_it = 0; link_it < path_pt->length; link_it++) {
-                        // If the offset is in the path, we have to add the constraint
                         if (path_pt->path[link_it] == get_offset_link(offset_pt)) {
-                            num_add_args++;
-                            add_path_selectors = realloc(add_path_selectors, sizeof(int) * num_add_args);
-                            add_path_selectors[num_add_args - 1] = gurobi_path_selector[frame_it][receiver_it][path_it];
+                            num_or_args++;
+                            or_args = realloc(or_args, sizeof(int) * num_or_args);
+                            or_args[num_or_args - 1] = path_selector[frame_it][receiver_it][path_it];
+                            break;
                         }
                     }
                 }
-                if (num_add_args != 0) {    // Only if we have at least one offset (it can happen that there
-                    // is not as frames can have many receivers, so we can have an offset not appearing in the
-                    // current receiver
-                    // When all the paths have been invetigated, we make the summation of all its path selectors
-                    GRBaddvar(gurobi_model, 0, NULL, NULL, 0, 0, 1, GRB_BINARY, NULL);
-                    gurobi_var_counter++;
-                    GRBaddgenconstrOr(gurobi_model, NULL, gurobi_var_counter - 1, num_add_args, add_path_selectors);
-                    
-                    free(add_path_selectors);
-                    num_or_args++;
-                    
-                    or_path_selectors = realloc(or_path_selectors, sizeof(int) * num_or_args);
-                    or_path_selectors[num_or_args - 1] = gurobi_var_counter - 1;
-                }
             }
+            // used <=> OR of the path selectors of all paths with the link
             if (num_or_args != 0) {
-                if (num_or_args > 1) {
-                    GRBaddvar(gurobi_model, 0, NULL, NULL, 0, 0, 1, GRB_BINARY, NULL);
-                    gurobi_var_counter++;
-                    GRBaddgenconstrOr(gurobi_model, NULL, gurobi_var_counter - 1, num_or_args, or_path_selectors);
+                if (backend->add_or(get_offset_used(offset_pt), num_or_args, or_args) < 0) {
+                    printf("Error relating the used offset with its paths\n");
+                    free(or_args);
+                    return ERROR_ADDING_CONSTRAINT;
                 }
-                variables[0] = get_gurobi_offset(offset_pt, 0, 0);
-                GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_var_counter - 1, 0, 1, variables, values,
-                                         GRB_EQUAL, 0);
-                GRBaddgenconstrIndicator(gurobi_model, NULL, gurobi_var_counter - 1, 1, 1, variables, values,
-                                         GRB_GREATER_EQUAL, 1);
-                free(or_path_selectors);
+                free(or_args);
             }
             offset_pt = get_next_offset(offset_pt);
         }
@@ -981,34 +1538,79 @@ int choose_path_gurobi() {
 }
 
 /**
- Add constraints for the solver to choose the paths of frames. For now, we allow only one possible path, chosen by the
- solver
+ Orders the offsets of identical frames in the first link that all their paths share, so the solver does not explore
+ the symmetric schedules obtained by swapping them. If frames can be rejected, the previous identical frame is also
+ scheduled whenever the next one is, so both are only ordered if the next one is scheduled.
+ It has to be called before the contention free constraints
  
- @param csolver indicates which solver are we using
  @return 0 if everything was ok, error code otherwise
  */
-int choose_path(Solver csolver) {
+int break_symmetries(void) {
     
-    switch (csolver) {
-        case z3:
-            choose_path_z3();
-            break;
-        case gurobi:
-            choose_path_gurobi();
-            break;
-        default:
-            break;
+    Frame *frame_pt, *symmetric_pt;             // Frame pointers
+    Offset *offset_pt, *symmetric_offset_pt;    // Offset pointers of both frames in the first link
+    LinearConstraint constraint;
+    int symmetric;                              // Previous identical frame
+    int first_link;                             // Link shared by all paths of the frame
+    int num_guards;                             // 1 if the order depends on the frame being scheduled, 0 otherwise
+    
+    // The order is not needed to find a schedule, so it could only add false conflicts
+    if (conflict_tracking == 1) {
+        return 0;
+    }
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        symmetric = get_symmetric_frame(frame_pt);
+        if (symmetric < 0) {
+            continue;
+        }
+        // If the paths do not share a link, there is no offset that is always transmitted to order both frames
+        first_link = get_common_first_link(frame_pt);
+        if (first_link < 0) {
+            continue;
+        }
+        symmetric_pt = get_frame(symmetric);
+        symmetric_offset_pt = get_frame_offset_by_link(symmetric_pt, first_link);
+        offset_pt = get_frame_offset_by_link(frame_pt, first_link);
+        // Identical frames share their paths, if the previous one does not use the link they cannot be ordered in it
+        if (symmetric_offset_pt == NULL || offset_pt == NULL) {
+            continue;
+        }
+        // Frames can only be swapped if a previous stage did not fix any of their offsets
+        if (get_offset_state(symmetric_offset_pt) != offset_free || get_offset_state(offset_pt) != offset_free ||
+            frame_has_fixed_offsets(symmetric_pt) == 1 || frame_has_fixed_offsets(frame_pt) == 1) {
+            continue;
+        }
+        num_guards = 0;
+        if (frame_scheduled != NULL) {
+            // scheduled previous - scheduled next >= 0
+            init_difference(&constraint, frame_scheduled[symmetric], frame_scheduled[frame_it], sense_greater_equal,
+                            0);
+            if (backend->add_diff(&constraint) < 0) {
+                printf("Error ordering identical frames\n");
+                return ERROR_SYMMETRY_BREAKING_CONSTRAINTS;
+            }
+            num_guards = 1;
+        }
+        // As they cannot overlap in the link, the next identical frame starts after the previous one is transmitted
+        // and the separation of the link has passed
+        if (set_precedence(symmetric_offset_pt, 0, 0, offset_pt, 0, 0,
+                           get_timeslot_size(symmetric_offset_pt) + get_link_separation(first_link), num_guards,
+                           frame_scheduled != NULL ? &frame_scheduled[frame_it] : NULL) < 0) {
+            printf("Error ordering identical frames\n");
+            return ERROR_SYMMETRY_BREAKING_CONSTRAINTS;
+        }
     }
+    
     return 0;
 }
 
 /**
  Assures that no frames are allowed to be transmitted at the same time in the same link
  
- @param csolver indicates which solver are we using
  @return 0 if everything was ok, error code otherwise
  */
-int contention_free(Solver csolver) {
+int contention_free(void) {
     
     Offset *offset_pt, *previous_offset_pt;                         // Pointer to an offset structure
     Frame *frame_pt, *previous_frame_pt;                            // Pointer to a frame structure
@@ -1029,21 +1631,24 @@ int contention_free(Solver csolver) {
                     for (int previous_frame_it = 0; previous_frame_it < frame_it; previous_frame_it++) {
                         previous_frame_pt = get_frame(previous_frame_it);
                         previous_offset_pt = get_frame_offset_by_link(previous_frame_pt, link);
-                        if (previous_offset_pt != NULL) {       // If the previous frame has an offset with that link
+                        // If the previous frame has an offset with that link in the current stage
+                        if (previous_offset_pt != NULL && offsets_in_stage(offset_pt, previous_offset_pt) == 1) {
                             for (int previous_instance = 0; previous_instance < get_num_instances(previous_offset_pt);
                                  previous_instance++) {
                                 for (int previous_replica = 0; previous_replica < get_num_replicas(previous_offset_pt);
                                      previous_replica++) {
                                     // See if they both can collide
-                                    if (offsets_share_interval(frame_pt, offset_pt, instance, replica,
-                                                               previous_frame_pt, previous_offset_pt, previous_instance,
-                                                               previous_replica) == 1) {
-                                        // Add the constraint to avoid collision
-                                        distance1 = get_timeslot_size(offset_pt);
-                                        distance2 = get_timeslot_size(previous_offset_pt);
-                                        if (avoid_intersection(offset_pt, instance, replica, previous_offset_pt,
+                                    if (offsets_share_interval(frame_pt, offset_pt, instance, previous_frame_pt,
+                                                               previous_offset_pt, previous_instance) == 1) {
+                                        // Add the constraint to avoid collision, leaving the guard band and the
+                                        // precision of the link between both transmissions
+                                        distance1 = get_timeslot_size(offset_pt) + get_link_separation(link);
+                                        distance2 = get_timeslot_size(previous_offset_pt) +
+                                                    get_link_separation(link);
+                                        if (track_contention(frame_it, previous_frame_it, link) < 0 ||
+                                            avoid_intersection(offset_pt, instance, replica, previous_offset_pt,
                                                                previous_instance, previous_replica, distance1,
-                                                               distance2, csolver) < 0) {
+                                                               distance2, frame_it, previous_frame_it) < 0) {
                                             printf("Error creating contention free constraints\n");
                                             return ERROR_CONTENTION_FREE_CONSTRAINTS;
                                         }
@@ -1058,43 +1663,68 @@ int contention_free(Solver csolver) {
         }
     }
     
+    tracking_literal = NO_VARIABLE;
+    
+    // Backends with resources also get every link as a whole. With path selection the offsets of paths not chosen
+    // are not transmitted, as the offsets of rejected frames, so they cannot be tasks that always occupy the link.
+    // A resource is not a group of a conflict, so tracked models do not have them
+    if (backend->add_resource != NULL && path_selector == NULL && frame_scheduled == NULL && conflict_tracking == 0) {
+        for (int link = 0; link < get_num_links(); link++) {
+            if (add_link_resource(link) < 0) {
+                printf("Error creating contention free constraints\n");
+                return ERROR_CONTENTION_FREE_CONSTRAINTS;
+            }
+        }
+    }
+    
     return 0;
 }
 
 /**
  Assures that all frames follow their path in the correct order
  
- @param csolver indicates which solver are we using
  @return 0 if everything was ok, error code otherwise
  */
-int frame_path_dependent(Solver csolver) {
+int frame_path_dependent(void) {
     
     Frame *frame_pt;                            // Frame pointer
     Path *path_pt;                              // Path pointer
     Offset *offset_pt, *next_offset_pt;         // Offset pointers
     int num_paths;                              // Number of paths to arrive
     int num_receivers;                          // Number of receivers of the frame
-    int receiver;                             // reciever of the frame
-    int sender;                                 // Sender of the frame
     long long int distance;                     // Distance to wait to transmit the next one
+    int deduplicate;                            // 1 if every pair of links is only related once per frame
+    
+    // Without path selectors the constraint of a pair of links does not depend on the path, so paths that share
+    // links (as multicast paths to different receivers) only need it once. Tracked groups need their own copy, so a
+    // conflict in a shared hop is explained by every path that uses it and not only by the first one
+    deduplicate = path_selector == NULL && conflict_tracking == 0;
     
     // For all given frames
     for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
         frame_pt = get_frame(frame_it);
-        sender = get_sender_id(frame_pt);
         num_receivers = get_num_receivers(frame_pt);
+        reset_link_pairs();
         for (int receiver_it = 0; receiver_it < num_receivers; receiver_it++) {         // For all the receivers
-            receiver = get_receiver_id(frame_pt, receiver_it);
-            num_paths = get_num_paths(sender, receiver);
+            num_paths = get_frame_num_paths(frame_pt, receiver_it);
             for (int path_it = 0; path_it < num_paths; path_it++) {                     // For all paths
-                path_pt = get_path(sender, receiver, path_it);
+                path_pt = get_frame_path(frame_pt, receiver_it, path_it);
+                if (new_conflict_group(path_dependent_conflict, frame_it, -1, -1, receiver_it, path_it) < 0) {
+                    return ERROR_PATH_DEPENDENT_CONSTRAINS;
+                }
                 // For all link in the path but the last one, get the offset of the current and next link
                 for (int link_it = 0; link_it < (path_pt->length - 1); link_it++) {
                     offset_pt = get_frame_offset_by_link(frame_pt, path_pt->path[link_it]);
                     distance = get_timeslot_size(offset_pt) + get_switch_minimum_time();
                     next_offset_pt = get_frame_offset_by_link(frame_pt, path_pt->path[link_it + 1]);
+                    if (offsets_in_stage(offset_pt, next_offset_pt) == 0) {
+                        continue;
+                    }
+                    if (deduplicate == 1 && add_link_pair(path_pt->path[link_it], path_pt->path[link_it + 1]) == 0) {
+                        continue;
+                    }
                     if (set_minimum_distance(offset_pt, 0, 0, next_offset_pt, 0, 0, distance, frame_it, receiver_it,
-                                             path_it, csolver) < 0) {
+                                             path_it) < 0) {
                         printf("Error setting the minimum distance in the path dependent\n");
                         return ERROR_PATH_DEPENDENT_CONSTRAINS;
                     }
@@ -1102,6 +1732,7 @@ int frame_path_dependent(Solver csolver) {
             }
         }
     }
+    tracking_literal = NO_VARIABLE;
     
     return 0;
 }
@@ -1109,10 +1740,9 @@ int frame_path_dependent(Solver csolver) {
 /**
  Assures that all frames follow their end to end delay in all paths from the first transmission to the last
  
- @param cssolver indicates which solver are we using
  @return 0 if everything was ok, error code otherwise
  */
-int frame_end_to_end_delay(Solver cssolver) {
+int frame_end_to_end_delay(void) {
     
     Frame *frame_pt;                            // Frame pointer
     Path *path_pt;                              // Path pointer
@@ -1120,90 +1750,608 @@ int frame_end_to_end_delay(Solver cssolver) {
     long long int delay;                        // End to end delay of the frame
     long long int distance;                     // Avaiable distance for the end to end delay
     int num_receivers;                          // Number of receivers of the frame
-    int receiver;                             // reciever of the frame
-    int sender;                                 // Sender of the frame
     int first_link, last_link;                  // First and last link of a path
     Offset *first_offset_pt, *last_offset_pt;   // Offset pointer to the first and last offsets of a possible path
+    int deduplicate;                            // 1 if every pair of first and last links is only related once
+    
+    // Without path selectors, paths with the same first and last links have the same constraint, but every tracked
+    // group keeps its own copy to be part of the explanation of a conflict
+    deduplicate = path_selector == NULL && conflict_tracking == 0;
     
     // For all the frames, add the end to end delay for the path from the first link to the last
     for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
         frame_pt = get_frame(frame_it);
         delay = get_end_to_end_delay(frame_pt);
-        sender = get_sender_id(frame_pt);
         num_receivers = get_num_receivers(frame_pt);
+        reset_link_pairs();
         for (int receiver_it = 0; receiver_it < num_receivers; receiver_it++) {         // For all the receivers
-            receiver = get_receiver_id(frame_pt, receiver_it);
-            num_paths = get_num_paths(sender, receiver);
+            num_paths = get_frame_num_paths(frame_pt, receiver_it);
             for (int path_it = 0; path_it < num_paths; path_it++) {                     // For all paths
-                path_pt = get_path(sender, receiver, path_it);
+                path_pt = get_frame_path(frame_pt, receiver_it, path_it);
                 first_link = path_pt->path[0];
                 last_link = path_pt->path[path_pt->length - 1];
                 first_offset_pt = get_frame_offset_by_link(frame_pt, first_link);
                 last_offset_pt = get_frame_offset_by_link(frame_pt, last_link);
+                if (offsets_in_stage(first_offset_pt, last_offset_pt) == 0) {
+                    continue;
+                }
+                if (deduplicate == 1 && add_link_pair(first_link, last_link) == 0) {
+                    continue;
+                }
                 distance = delay - get_timeslot_size(last_offset_pt);
-                if (set_maximum_distance(first_offset_pt, 0, 0, last_offset_pt, 0, 0, distance, frame_it, receiver_it,
-                                         path_it, cssolver) < 0) {
+                if (new_conflict_group(end_to_end_conflict, frame_it, -1, -1, receiver_it, path_it) < 0 ||
+                    set_maximum_distance(first_offset_pt, 0, 0, last_offset_pt, 0, 0, distance, frame_it, receiver_it,
+                                         path_it) < 0) {
                     printf("Error setting the max distance for the frame end to end delay\n");
                     return ERROR_END_TO_END_DELAY_CONSTRAINTS;
                 }
             }
         }
     }
+    tracking_literal = NO_VARIABLE;
+    
+    return 0;
+}
+
+/**
+ Relates the offsets of the current stage of every frame that has excluded offsets. The offsets of the stage can be
+ related through excluded offsets, even of different paths, so the distances between all of them are calculated with
+ the path dependent and end to end delay constraints of the frame (all pairs shortest paths, as they are differences
+ between offsets), and the tightest distance between every pair of offsets in the stage is added
+ 
+ @return 0 if everything was ok, error code otherwise
+ */
+int frame_stage_distances(void) {
+    
+    Frame *frame_pt;                            // Frame pointer
+    Path *path_pt;                              // Path pointer
+    Offset *offset_pt;                          // Offset pointer
+    Offset **frame_offsets;                     // Offsets of the frame
+    int *offset_index;                          // Index of the offset of every link in the frame offsets
+    long long int **distance;                   // distance[i][j] is the maximum value of offset j - offset i
+    int num_offsets;                            // Number of offsets of the frame
+    int num_excluded;                           // Number of excluded offsets of the frame
+    int first, last, next;
+    long long int infinite = LLONG_MAX / 4;     // Pair of offsets without any relation
+    long long int bound;
+    
+    offset_index = malloc(sizeof(int) * get_num_links());
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        
+        // Index all the offsets of the frame
+        num_offsets = 0;
+        num_excluded = 0;
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            if (get_offset_state(offset_pt) == offset_excluded) {
+                num_excluded++;
+            }
+            num_offsets++;
+            offset_pt = get_next_offset(offset_pt);
+        }
+        // If there are no excluded offsets, all its relations are already in the path dependent and end to end,
+        // and if all of them are excluded, the frame is not in the stage
+        if (num_excluded == 0 || num_excluded == num_offsets) {
+            continue;
+        }
+        frame_offsets = malloc(sizeof(Offset *) * num_offsets);
+        distance = malloc(sizeof(long long int *) * num_offsets);
+        offset_pt = get_offset_root(frame_pt);
+        for (int i = 0; i < num_offsets; i++) {
+            frame_offsets[i] = offset_pt;
+            offset_index[get_offset_link(offset_pt)] = i;
+            distance[i] = malloc(sizeof(long long int) * num_offsets);
+            for (int j = 0; j < num_offsets; j++) {
+                distance[i][j] = (i == j) ? 0 : infinite;
+            }
+            offset_pt = get_next_offset(offset_pt);
+        }
+        
+        // offset next - offset >= timeslot + switch time => offset - offset next <= -(timeslot + switch time)
+        // offset last - offset first <= end to end delay - timeslot last
+        for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+            for (int path_it = 0; path_it < get_frame_num_paths(frame_pt, receiver_it); path_it++) {
+                path_pt = get_frame_path(frame_pt, receiver_it, path_it);
+                for (int link_it = 0; link_it < path_pt->length - 1; link_it++) {
+                    first = offset_index[path_pt->path[link_it]];
+                    next = offset_index[path_pt->path[link_it + 1]];
+                    bound = -(get_timeslot_size(frame_offsets[first]) + get_switch_minimum_time());
+                    if (bound < distance[next][first]) {
+                        distance[next][first] = bound;
+                    }
+                }
+                first = offset_index[path_pt->path[0]];
+                last = offset_index[path_pt->path[path_pt->length - 1]];
+                bound = get_end_to_end_delay(frame_pt) - get_timeslot_size(frame_offsets[last]);
+                if (bound < distance[first][last]) {
+                    distance[first][last] = bound;
+                }
+            }
+        }
+        
+        // Floyd-Warshall, frames only have a few offsets
+        for (int k = 0; k < num_offsets; k++) {
+            for (int i = 0; i < num_offsets; i++) {
+                for (int j = 0; j < num_offsets; j++) {
+                    if (distance[i][k] < infinite && distance[k][j] < infinite &&
+                        distance[i][k] + distance[k][j] < distance[i][j]) {
+                        distance[i][j] = distance[i][k] + distance[k][j];
+                    }
+                }
+            }
+        }
+        
+        // offset j - offset i <= distance => offset j + (-distance) <= offset i
+        for (int i = 0; i < num_offsets; i++) {
+            for (int j = 0; j < num_offsets; j++) {
+                if (i != j && distance[i][j] < infinite && offsets_in_stage(frame_offsets[i], frame_offsets[j]) == 1) {
+                    if (set_precedence(frame_offsets[j], 0, 0, frame_offsets[i], 0, 0, -distance[i][j],
+                                       frame_scheduled != NULL ? 1 : 0,
+                                       frame_scheduled != NULL ? &frame_scheduled[frame_it] : NULL) < 0) {
+                        printf("Error relating the offsets of the stage\n");
+                        return ERROR_STAGE_DISTANCES_CONSTRAINTS;
+                    }
+                }
+            }
+        }
+        
+        for (int i = 0; i < num_offsets; i++) {
+            free(distance[i]);
+        }
+        free(distance);
+        free(frame_offsets);
+    }
+    free(offset_index);
+    
+    return 0;
+}
+
+/**
+ Add the configured objectives into the solver. If a latency objective is used, it creates a latency variable per frame
+ bounded by the time from its first transmission to the end of its last transmission in every path, and the maximum of
+ all of them. If frames can be rejected, the scheduled frames are always more important than the configured objectives.
+ It has to be called once all the offset variables are created
+ 
+ @return 0 if everything was ok, error code otherwise
+ */
+int add_objectives(void) {
+    
+    int latency_needed = 0;
+    
+    if (link_spacing != NO_VARIABLE) {  // The pareto front sets its own objectives
+        return 0;
+    }
+    if (conflict_tracking == 1) {       // Conflicts are explained without objectives, the latencies would be tracked
+        return 0;
+    }
+    if (frame_scheduled != NULL && set_scheduled_objective() < 0) {
+        return ERROR_SETTING_OBJECTIVES;
+    }
+    if (num_objectives == 0) {          // By default the distances are maximized if the solver has them
+        if (frame_distances != NULL && (frame_distance_weight != 0.0 || link_distance_weight != 0.0)) {
+            return set_distance_objective();
+        }
+        return 0;
+    }
+    for (int objective_it = 0; objective_it < num_objectives; objective_it++) {
+        if (objectives[objective_it] != distance_objective) {
+            latency_needed = 1;
+        }
+    }
+    if (latency_needed == 1) {
+        if (init_latency_variables() < 0) {
+            printf("Error creating the latency variables\n");
+            return ERROR_LATENCY_CONSTRAINTS;
+        }
+    }
+    
+    // Backends combine the objectives lexicographically in the order they are added
+    for (int objective_it = 0; objective_it < num_objectives; objective_it++) {
+        switch (objectives[objective_it]) {
+            case distance_objective:
+                if (set_distance_objective() < 0) {
+                    return ERROR_SETTING_OBJECTIVES;
+                }
+                break;
+            case latency_sum_objective:
+            case latency_max_objective:
+                if (set_latency_objective(objectives[objective_it]) < 0) {
+                    return ERROR_SETTING_OBJECTIVES;
+                }
+                break;
+            default:
+                return ERROR_SETTING_OBJECTIVES;
+        }
+    }
+    return 0;
+}
+
+/**
+ Creates the variable with the minimum spacing between two transmissions of the same link, so it can be traded against
+ the latency in the pareto front. It has to be called before the contention free constraints
+ 
+ @return 0 if everything was ok, error code otherwise
+ */
+int init_spacing_variable(void) {
+    
+    LinearConstraint constraint;
+    int index;
+    
+    index = add_variable_info(spacing_variable, -1, -1, -1, -1, -1, -1);
+    // 0 <= spacing <= hyper period, so it is bounded even if no frames share a link
+    link_spacing = new_variable(index, 0, get_hyper_period(), integer_domain);
+    if (link_spacing < 0) {
+        printf("Error adding the spacing variable\n");
+        link_spacing = NO_VARIABLE;
+        return ERROR_CREATING_VARIABLE;
+    }
+    if (link_distances == NULL) {       // The spacing is directly in the contention free constraints
+        return 0;
+    }
+    // The link distances are already in the contention free constraints, the spacing is the smallest of them
+    for (int link_it = 0; link_it < get_num_links(); link_it++) {
+        init_difference(&constraint, link_spacing, link_distances[link_it], sense_less_equal, 0);
+        if (backend->add_diff(&constraint) < 0) {
+            printf("Error setting spacing constraint\n");
+            return ERROR_ADDING_CONSTRAINT;
+        }
+    }
+    return 0;
+}
+
+/**
+ Prepare the built model to find the points of the pareto front between the latency and the spacing. Every point
+ minimizes the latency and then maximizes the spacing with a minimum spacing given in every iteration
+ (epsilon-constraint), so the model is built only once and the solver keeps what it learnt between points
+ 
+ @param latency_objective latency to trade against the spacing (latency_sum_objective or latency_max_objective)
+ @return 0 if everything was ok, error code otherwise
+ */
+int init_pareto_front(ObjectiveType latency_objective) {
+    
+    double values[1] = {1.0};
+    
+    if (link_spacing == NO_VARIABLE) {
+        printf("The spacing variable has to be created before the pareto front\n");
+        return ERROR_SPACING_CONSTRAINTS;
+    }
+    if (latency_objective != latency_sum_objective && latency_objective != latency_max_objective) {
+        printf("The pareto front is only found between the latency and the spacing\n");
+        return ERROR_SETTING_OBJECTIVES;
+    }
+    if (backend->set_lower_bound == NULL) {
+        printf("The solver %s cannot find the pareto front\n", backend->name);
+        return BACKEND_OPERATION_NOT_SUPPORTED;
+    }
+    pareto_latency = latency_objective;
+    if (init_latency_variables() < 0) {
+        printf("Error creating the latency variables\n");
+        return ERROR_LATENCY_CONSTRAINTS;
+    }
+    
+    // The objectives are kept for all points, only the minimum spacing changes in every point
+    if (set_latency_objective(latency_objective) < 0) {
+        return ERROR_SETTING_OBJECTIVES;
+    }
+    // The spacing is a second objective, only maximized for the best latency
+    if (backend->set_objective(1, &link_spacing, values) < 0) {
+        printf("Error setting the spacing objective\n");
+        return ERROR_SETTING_OBJECTIVES;
+    }
+    return 0;
+}
+
+/**
+ Get the number of constraints added into the solver until now, used to measure the constraint construction rate
+ 
+ @return number of constraints in the solver, error code otherwise
+ */
+long long int get_num_constraints(void) {
+    
+    if (backend == NULL || backend->get_num_constraints == NULL) {
+        return 0;
+    }
+    return backend->get_num_constraints();
+}
+
+/**
+ Get how many intersections between offsets were simplified by their transmission windows while building the model
+ 
+ @param ordered pointer to save the number of intersections reduced to a single order
+ @param removed pointer to save the number of intersections removed as the offsets can never collide
+ */
+void get_num_presolved_intersections(long long int *ordered, long long int *removed) {
+    
+    *ordered = num_ordered_intersections;
+    *removed = num_removed_intersections;
+}
+
+
+/**
+ Save the transmission times found by the solver into the offsets of the current stage, so they can be fixed in next
+ stages or written in the schedule. The offsets of rejected frames are 0, as they are not transmitted, and if the solver
+ chooses the paths, it also saves which offsets are used by them
+ 
+ @return 0 if done correctly, error code otherwise
+ */
+int extract_schedule(void) {
+    
+    Frame *frame_pt;
+    Offset *offset_pt;
+    long long int value;
+    long long int scheduled = 1;
+    
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        if (frame_scheduled != NULL) {
+            if (backend->get_value(frame_scheduled[frame_it], &scheduled) < 0) {
+                printf("Error extracting the scheduled frames from the solution of %s\n", backend->name);
+                return ERROR_EXTRACTING_OFFSET;
+            }
+            set_rejected(frame_pt, scheduled == 0);
+        }
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            if (get_offset_state(offset_pt) == offset_free) {
+                if (path_selector != NULL) {
+                    if (backend->get_value(get_offset_used(offset_pt), &value) < 0) {
+                        printf("Error extracting the chosen paths from the solution of %s\n", backend->name);
+                        return ERROR_EXTRACTING_OFFSET;
+                    }
+                    set_offset_chosen(offset_pt, value == 1);
+                }
+                for (int instance = 0; instance < get_num_instances(offset_pt); instance++) {
+                    for (int replica = 0; replica < get_num_replicas(offset_pt); replica++) {
+                        if (backend->get_value(get_offset_variable(offset_pt, instance, replica), &value) < 0) {
+                            printf("Error extracting the transmission time from the solution of %s\n", backend->name);
+                            return ERROR_EXTRACTING_OFFSET;
+                        }
+                        set_offset(offset_pt, instance, replica, scheduled == 0 ? 0 : value);
+                    }
+                }
+            }
+            offset_pt = get_next_offset(offset_pt);
+        }
+    }
     
     return 0;
 }
 
 /**
- Check the constraint solver and returns the status of it, if everything went well, it creates the schedule model
+ Check the constraint solver and returns the status of it, if everything went well, it extracts the schedule into the
+ offsets of the network
  
- @param csolver indicates which solver are we using
  @param time limit time in seconds to solve the schedule
  @param tune if tune is active, instead of solving the schedule, it will tune and find good parameters
  @param tunetimelimit limit in seconds to tune
- @return 1 if the schedule was found, error code otherwise
+ @return 1 if the schedule was found, 0 if only tuned, error code otherwise
+ */
+int check_solver(int time, int tune, int tunetimelimit) {
+    
+    int found = SCHEDULE_NOT_FOUND;
+    int result;
+    
+    if (tune == 1 && backend->tune != NULL) {
+        // Tuning only looks for parameters, so there is no schedule to find
+        backend->tune(tunetimelimit);
+        return 0;
+    }
+    if (tune == 1) {
+        printf("Tuning is not supported by %s, the schedule is solved instead\n", backend->name);
+    }
+    result = backend->solve(time);
+    if (result == 1 || result == SOLUTION_NOT_PROVEN) {
+        found = extract_schedule() < 0 ? SCHEDULE_NOT_FOUND : 1;
+    }
+    backend->destroy();
+    
+    if (result == BACKEND_TIME_LIMIT) {
+        printf("The time limit stopped the solver before finding a schedule\n");
+    }
+    if (found == SCHEDULE_NOT_FOUND) {
+        printf("No schedule was found\n");
+    }
+    return found;
+}
+
+/**
+ Explain why the tracked model has no schedule. The unsat core of the tracking literals given by the solver is
+ minimized removing one group at a time, a group is only kept if the rest of the core has a schedule without it.
+ The groups in conflict, their frames and the links where they contend are printed
+ 
+ @param time limit time in seconds of every check of the solver
+ @return number of groups in conflict, 0 if there is a schedule, error code otherwise
  */
-int check_solver(Solver csolver, int time, int tune, int tunetimelimit) {
-    
-    switch (csolver) {
-        case z3:
-            printf("%s", Z3_optimize_to_string(z3_context, z3_optimize));
-            if (Z3_optimize_check(z3_context, z3_optimize) == Z3_L_TRUE) {
-                z3_model = Z3_optimize_get_model(z3_context, z3_optimize);
-                // To delete
-                Z3_string model_string;
-                model_string = Z3_model_to_string(z3_context, z3_model);
-                printf("%s", model_string);
-                
-                Z3_del_context(z3_context);
+int explain_conflict(int time) {
+    
+    int *literals;                      // Tracking literals assumed in every check
+    int *core;                          // Tracking literals of the current core
+    int *reduced;                       // Tracking literals of the core found without one group
+    int num_core, num_reduced, num_assumed;
+    int core_it = 0;
+    int minimal = 1;                    // 0 if a check was unknown, so the group was kept without knowing it
+    int *is_marked;
+    int result;
+    
+    if (backend->solve_assuming == NULL) {
+        printf("The solver %s cannot explain conflicts\n", backend->name);
+        return BACKEND_OPERATION_NOT_SUPPORTED;
+    }
+    
+    literals = malloc(sizeof(int) * (num_conflict_groups + 1));
+    core = malloc(sizeof(int) * (num_conflict_groups + 1));
+    reduced = malloc(sizeof(int) * (num_conflict_groups + 1));
+    for (int group_it = 0; group_it < num_conflict_groups; group_it++) {
+        literals[group_it] = conflict_groups[group_it].literal;
+    }
+    result = backend->solve_assuming(time, num_conflict_groups, literals, &num_core, core);
+    if (result != 0) {
+        printf(result == 1 ? "There is a schedule, so there is no conflict to explain\n" :
+                             "The solver could not find if there is a schedule\n");
+        free(literals);
+        free(core);
+        free(reduced);
+        return result == 1 ? 0 : ERROR_EXPLAINING_CONFLICT;
+    }
+    
+    // A group is needed if the rest of the core has a schedule without it. The groups needed are needed in any smaller
+    // core too, so the groups before the current one are always kept in their position
+    while (core_it < num_core) {
+        num_assumed = 0;
+        for (int it = 0; it < num_core; it++) {
+            if (it != core_it) {
+                literals[num_assumed] = core[it];
+                num_assumed++;
             }
-            break;
-        case gurobi:
-            GRBupdatemodel(gurobi_model);
-            if (tune == 1) {
-                GRBsetdblparam(GRBgetenv(gurobi_model), "TuneTimeLimit", tunetimelimit);
-                GRBtunemodel(gurobi_model);
-                int nresults;
-                GRBgetintattr(gurobi_model, "TuneResultCount", &nresults);
-                if (nresults > 0) {
-                    GRBgettuneresult(gurobi_model, 0);
-                    GRBwrite(gurobi_model, "Params.prm");
-                    
+        }
+        result = backend->solve_assuming(time, num_assumed, literals, &num_reduced, reduced);
+        if (result == 0) {
+            // Still no schedule without the group, the core only keeps the groups of the new core
+            num_assumed = 0;
+            for (int it = 0; it < num_core; it++) {
+                for (int reduced_it = 0; reduced_it < num_reduced; reduced_it++) {
+                    if (reduced[reduced_it] == core[it]) {
+                        core[num_assumed] = core[it];
+                        num_assumed++;
+                        break;
+                    }
                 }
-            } else {
-                GRBreadparams(gurobi_env, "XML Files/Params.prm");
-                GRBsetdblparam(GRBgetenv(gurobi_model), "TimeLimit", time);
-                GRBwrite(gurobi_model, "Model.lp");
-                GRBoptimize(gurobi_model);
-                int sol_count = 0;
-                GRBgetintattr(gurobi_model, "SolCount", &sol_count);
-                if (sol_count > 0) {
-                    GRBwrite(gurobi_model, "Debug.mps");
-                    GRBwrite(gurobi_model, "Schedule.sol");
+            }
+            num_core = num_assumed;
+        } else {
+            if (result < 0) {
+                minimal = 0;
+            }
+            core_it++;
+        }
+    }
+    
+    // Save the groups of the core
+    num_conflict_core = 0;
+    conflict_core = realloc(conflict_core, sizeof(ConflictGroup) * (num_core + 1));
+    for (int group_it = 0; group_it < num_conflict_groups; group_it++) {
+        for (int it = 0; it < num_core; it++) {
+            if (core[it] == conflict_groups[group_it].literal) {
+                conflict_core[num_conflict_core] = conflict_groups[group_it];
+                num_conflict_core++;
+                break;
+            }
+        }
+    }
+    free(literals);
+    free(core);
+    free(reduced);
+    
+    if (num_conflict_core == 0) {
+        // Only the constraints that are not tracked are left, as the windows of the transmissions
+        printf("The transmission windows of the frames cannot be scheduled by themselves\n");
+        return 0;
+    }
+    printf("Conflict between %d groups of constraints%s:\n", num_conflict_core,
+           minimal == 1 ? "" : " (it might not be minimal, some checks were unknown)");
+    for (int it = 0; it < num_conflict_core; it++) {
+        print_conflict_group(&conflict_core[it]);
+    }
+    is_marked = calloc(get_num_frames() + get_num_links(), sizeof(int));
+    printf("Frames in conflict:");
+    for (int it = 0; it < num_conflict_core; it++) {
+        for (int side = 0; side < 2; side++) {
+            int frame = side == 0 ? conflict_core[it].other_frame : conflict_core[it].frame;
+            if (frame >= 0 && is_marked[frame] == 0) {
+                is_marked[frame] = 1;
+                printf(" %d", frame);
+            }
+        }
+    }
+    printf("\nLinks in conflict:");
+    for (int it = 0; it < num_conflict_core; it++) {
+        if (conflict_core[it].link >= 0 && is_marked[get_num_frames() + conflict_core[it].link] == 0) {
+            is_marked[get_num_frames() + conflict_core[it].link] = 1;
+            printf(" %d", conflict_core[it].link);
+        }
+    }
+    printf("\n");
+    free(is_marked);
+    
+    return num_conflict_core;
+}
+
+/**
+ Get the groups of constraints in the last conflict explained
+ 
+ @param core pointer to save the array with the groups in conflict
+ @return number of groups in conflict
+ */
+int get_conflict_core(ConflictGroup **core) {
+    
+    *core = conflict_core;
+    return num_conflict_core;
+}
+
+/**
+ Find the point of the pareto front with the best latency and at least the given spacing, and extract its schedule
+ into the offsets of the network. The model is not modified, so it can be called again with a larger spacing
+ 
+ @param time limit time in seconds to find the point
+ @param min_spacing minimum spacing between two transmissions of the same link in ns
+ @param latency pointer to save the latency of the point found
+ @param spacing pointer to save the spacing of the point found
+ @return 1 if the point was found, SOLUTION_NOT_PROVEN if the time limit stopped the search after finding it, 0 if
+ there is no schedule with such spacing, BACKEND_TIME_LIMIT if the time limit stopped the search before finding any,
+ error code otherwise
+ */
+int check_pareto_point(int time, long long int min_spacing, long long int *latency, long long int *spacing) {
+    
+    long long int value = 0;
+    int error = 0;
+    int result;
+    
+    // The minimum spacing is only a bound of the variable, the rest of the model is kept
+    if (backend->set_lower_bound(link_spacing, min_spacing) < 0) {
+        printf("Error setting the minimum spacing\n");
+        return ERROR_SPACING_CONSTRAINTS;
+    }
+    result = backend->solve(time);
+    if (result == BACKEND_TIME_LIMIT) {
+        return BACKEND_TIME_LIMIT;
+    }
+    if (result != 1 && result != SOLUTION_NOT_PROVEN) {
+        return 0;
+    }
+    if (extract_schedule() < 0) {
+        return ERROR_EXTRACTING_OFFSET;
+    }
+    *latency = 0;
+    if (pareto_latency == latency_max_objective) {
+        error |= backend->get_value(maximum_latency, latency);
+    } else {
+        for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+            if (frame_latencies[frame_it] != NO_VARIABLE) {
+                // A failed read does not write the value, so it cannot be added to the latency
+                if (backend->get_value(frame_latencies[frame_it], &value) < 0) {
+                    error = 1;
+                    break;
                 }
+                *latency += value;
             }
-        default:
-            break;
+        }
     }
+    error |= backend->get_value(link_spacing, spacing);
+    if (error != 0) {
+        printf("Error extracting the point of the pareto front\n");
+        return ERROR_EXTRACTING_OFFSET;
+    }
+    return result;
+}
+
+/**
+ Release the model of the solver once no more schedules are needed from it
+ 
+ */
+void release_solver(void) {
     
-    return 0;
+    if (backend != NULL) {
+        backend->destroy();
+    }
 }
@@ -7,7 +7,8 @@
  *  Copyright © 2018 Francisco Pozo. All rights reserved.                                                              *
  *                                                                                                                     *
  *  Package that contains the optimizations solvers.                                                                   *
- *  We plan to implement many different solvers, such as Z3, ILP, Gurobi, etc.                                         *
+ *  The model is built through the operations of a solver backend, so every solver (z3, gurobi, HiGHS or a shared     *
+ *  library) receives the same variables and constraints.                                                             *
  *                                                                                                                     *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
@@ -15,47 +16,181 @@
 #define Optimizator_h
 
 #include <stdio.h>
-#include <z3.h>
-#include <gurobi_c.h>
+#include <math.h>
+#include <limits.h>
 #include "Network.h"
+#include "Backend.h"
 
 #endif /* Optimizator_h */
 
 /* ERROR CODE DEFINITIONS */
 
-#define ERROR_EXTRACTING_Z3_OFFSET -1
 #define OPTIMIZATOR_NOT_IMPLEMENTED -101
+#define SOLVER_NOT_AVAILABLE -102
 #define ERROR_INIT_CONSTRAINTS -201
 #define ERROR_CONTENTION_FREE_CONSTRAINTS -202
 #define ERROR_END_TO_END_DELAY_CONSTRAINTS -203
 #define ERROR_PATH_DEPENDENT_CONSTRAINS -204
 #define ERROR_MAXIMIZING_SAME_FRAMES_DISTANCES -205
-#define ERROR_SETTING_GUROBI_VAR -301
-#define ERROR_SETTING_GUROBI_CONSTRAINT -302
+#define ERROR_SYMMETRY_BREAKING_CONSTRAINTS -206
+#define ERROR_STAGE_DISTANCES_CONSTRAINTS -207
+#define ERROR_LATENCY_CONSTRAINTS -208
+#define ERROR_SETTING_OBJECTIVES -209
+#define ERROR_SPACING_CONSTRAINTS -210
+#define ERROR_CREATING_VARIABLE -211
+#define ERROR_ADDING_CONSTRAINT -212
+#define ERROR_EXTRACTING_OFFSET -213
+#define ERROR_EXPLAINING_CONFLICT -214
+#define VARIABLE_INDEX_OUT_OF_RANGE -401
+#define SCHEDULE_NOT_FOUND -601
+#define TOO_MANY_OBJECTIVES -701
 
 /* STRUCT DEFINITIONS */
 
+#define MAX_OBJECTIVES 3
+#define MAX_GUARDS 5                    // Offsets used and frames scheduled of two offsets, and the tracking literal
+
+/**
+ Objectives that can be optimized in the schedule, they are combined lexicographically in the given order
+ */
+typedef enum ObjectiveType {
+    distance_objective,                 // Maximize the weighted frame and link distances (only MIP solvers)
+    latency_sum_objective,              // Minimize the sum of the end to end latencies of all frames
+    latency_max_objective               // Minimize the largest end to end latency of all frames
+}ObjectiveType;
+
+/**
+ Orders between two offsets that share a link allowed by their transmission windows
+ */
+typedef enum IntersectionOrder {
+    both_orders,                        // Any of both offsets can be transmitted first
+    first_before_second,                // Only the first offset can be transmitted first
+    second_before_first,                // Only the second offset can be transmitted first
+    no_intersection                     // Both offsets can never collide, whatever their transmission times are
+}IntersectionOrder;
+
+/**
+ Types of the variables created in the solver
+ */
+typedef enum VariableType {
+    offset_variable,
+    path_selector_variable,
+    frame_distance_variable,
+    link_distance_variable,
+    latency_variable,
+    spacing_variable,
+    offset_used_variable,
+    frame_scheduled_variable,
+    tracking_variable
+}VariableType;
+
+/**
+ Types of the groups of constraints that can be in conflict when the network cannot be scheduled
+ */
+typedef enum ConflictType {
+    path_dependent_conflict,            // Order of the transmissions of a frame along one of its paths
+    end_to_end_conflict,                // End to end delay of a frame along one of its paths
+    contention_conflict                 // Transmissions of two frames that cannot overlap in a link
+}ConflictType;
+
 /**
- Avaliable solvers
+ Group of constraints that only holds if its tracking literal is true, so the unsat core of the tracking literals says
+ which groups are in conflict
  */
-typedef enum Solver{
-    z3,
-    gurobi
-}Solver;
+typedef struct ConflictGroup {
+    ConflictType type;                  // Type of the constraints of the group
+    int frame;                          // Frame identifier
+    int other_frame;                    // Frame that contends with the frame in the link (contention), -1 otherwise
+    int link;                           // Link where both frames contend (contention), -1 otherwise
+    int receiver;                       // Receiver of the path (path dependent and end to end), -1 otherwise
+    int path;                           // Path to the receiver (path dependent and end to end), -1 otherwise
+    int literal;                        // Tracking literal of the group
+}ConflictGroup;
 
 /**
- Initialize the given solver to start the scheduling process
+ Information of a variable of the solver, so its name can be reconstructed from its index when it is needed
+ */
+typedef struct VariableInfo {
+    VariableType type;                  // Type of the variable
+    int frame;                          // Frame identifier (offsets, path selectors, frame distances and latencies)
+    int instance;                       // Instance of the offset (offsets)
+    int replica;                        // Replica of the offset (offsets)
+    int link;                           // Link identifier (offsets and link distances)
+    int receiver;                       // Receiver of the frame (path selectors)
+    int path;                           // Path to the receiver (path selectors)
+}VariableInfo;
+
+/**
+ Set if the variables of the solver are created with a human readable name.
+ Names are only useful to debug, so by default variables are identified by their index in the variables table
+
+ @param names 1 to name the variables, 0 to identify them by their index
+ */
+void set_variable_names(int names);
+
+/**
+ Get the information of the variable with the given index in the variables table
+
+ @param index index of the variable
+ @return pointer to the variable information, NULL if the index does not exist
+ */
+VariableInfo * get_variable_info(int index);
+
+/**
+ Reconstruct the human readable name of the variable with the given index in the variables table
+
+ @param index index of the variable
+ @param name string where the name is written (at least 100 characters)
+ @return 0 if done correctly, error code otherwise
+ */
+int get_variable_name(int index, char *name);
+
+/**
+ Set the format and the file to export the model when it is generated. It is disabled by default.
+ SMT-LIB2 is written incrementally while the constraints are added (z3), LP and MPS are written by the solver once the
+ model is finished (gurobi and HiGHS) and DIMACS is written with the clauses of the SAT encoding before solving them
+
+ @param format format of the exported model, no_export to disable it
+ @param filename name of the file to write the model
+ @return 0 if done correctly, error code otherwise
+ */
+int set_model_export(ExportFormat format, char *filename);
+
+/**
+ Set the objectives to optimize when the model is generated, combined lexicographically (the first one is the most
+ important). Without objectives, the distances are maximized by the MIP solvers and z3 only looks for a feasible
+ schedule
+
+ @param objectives_list array with the objectives ordered from the most to the least important
+ @param num number of objectives, 0 to use the default behaviour
+ @return 0 if done correctly, error code otherwise
+ */
+int set_objectives(ObjectiveType *objectives_list, int num);
+
+/**
+ Set if the next models are built with a tracking literal in every group of constraints (every path of every frame and
+ every pair of frames in a link), so the groups in conflict can be explained if there is no schedule. The symmetry
+ breaking constraints, the link resources and the objectives are not added to the tracked models
+
+ @param tracking 1 to track the groups of constraints, 0 otherwise
+ */
+void set_conflict_tracking(int tracking);
+
+/**
+ Initialize the given solver to start the scheduling process, freeing the model of the previous one.
+ The solver is the name of a built in backend (z3, gurobi, highs, cp or sat) or the path of a shared library with a
+ backend
  
- @param s solver willed to be used and initialized
+ @param name name of the solver willed to be used and initialized
  @return 0 if done correctly, error code otherwise
  */
-int initialize_solver(Solver s);
+int initialize_solver(char *name);
 
 /**
  Initialize the variables to maximize with the distances between the same frame and the distances with frames of the
  same link. If optimization is 0, we then do not care about such distances and set them always to 0.
  You can give different weights to the distances between frames and links, as the distance in links is usually much
- larger and will have more importance.
+ larger and will have more importance. Only solvers that can maximize them have distances (MIP solvers).
 
  @param optimization 1 if we take care of maximizing distances, 0 oterhwise
  @param weight_frame weight ratio of the frame distance
@@ -67,67 +202,179 @@ int initialize_distances(int optimization, double weight_frame, double weight_li
 /**
  Init the variables needed to allow the solver the selection of which path to choose
 
- @param csolver indicates which solver are we using
  @return 0 if everything was ok, error code otherwise
  */
-int init_path_selector(Solver csolver);
+int init_path_selector(void);
+
+/**
+ Init the literal of every frame that is true if the frame is scheduled. All the constraints of a frame only hold if it
+ is scheduled, and the weighted number of scheduled frames is the most important objective, so the solver finds the
+ largest subset of frames that can be scheduled together instead of failing if the network is overloaded
+
+ @param weighted 1 to weight every frame with its priority class plus one, 0 to count the scheduled frames
+ @return 0 if everything was ok, error code otherwise
+ */
+int init_frame_scheduled(int weighted);
 
 /**
  Creates the offset variables for all frames in the network, then adds them into the logical context
  
- @param csolver indicates which solver are we using
  @return 0 if everything was ok, error code otherwise
  */
-int create_offset_variables(Solver csolver);
+int create_offset_variables(void);
 
 /**
  Add constraints for the solver to choose the paths of frames. For now, we allow only one possible path, chosen by the
  solver
 
- @param csolver indicates which solver are we using
  @return 0 if everything was ok, error code otherwise
  */
-int choose_path(Solver csolver);
+int choose_path(void);
+
+/**
+ Orders the offsets of identical frames in the first link that all their paths share, so the solver does not explore
+ the symmetric schedules obtained by swapping them. If frames can be rejected, the previous identical frame is also
+ scheduled whenever the next one is, so both are only ordered if the next one is scheduled.
+ It has to be called before the contention free constraints
+ 
+ @return 0 if everything was ok, error code otherwise
+ */
+int break_symmetries(void);
 
 /**
  Assures that no frames are allowed to be transmitted at the same time in the same link
  
- @param csolver indicates which solver are we using
  @return 0 if everything was ok, error code otherwise
  */
-int contention_free(Solver csolver);
+int contention_free(void);
 
 /**
  Assures that all frames follow their path in the correct order
  
- @param csolver indicates which solver are we using
  @return 0 if everything was ok, error code otherwise
  */
-int frame_path_dependent(Solver csolver);
+int frame_path_dependent(void);
 
 /**
  Assures that all frames follow their end to end delay in all paths from the first transmission to the last
  
- @param csolver indicates which solver are we using
  @return 0 if everything was ok, error code otherwise
  */
-int frame_end_to_end_delay(Solver csolver);
+int frame_end_to_end_delay(void);
+
+/**
+ Relates the offsets of the current stage of every frame that has excluded offsets. The offsets of the stage can be
+ related through excluded offsets, even of different paths, so the distances between all of them are calculated with
+ the path dependent and end to end delay constraints of the frame (all pairs shortest paths, as they are differences
+ between offsets), and the tightest distance between every pair of offsets in the stage is added
+ 
+ @return 0 if everything was ok, error code otherwise
+ */
+int frame_stage_distances(void);
+
+/**
+ Add the configured objectives into the solver. If a latency objective is used, it creates a latency variable per frame
+ bounded by the time from its first transmission to the end of its last transmission in every path, and the maximum of
+ all of them. If frames can be rejected, the scheduled frames are always more important than the configured objectives.
+ It has to be called once all the offset variables are created
+ 
+ @return 0 if everything was ok, error code otherwise
+ */
+int add_objectives(void);
+
+/**
+ Creates the variable with the minimum spacing between two transmissions of the same link, so it can be traded against
+ the latency in the pareto front. It has to be called before the contention free constraints
+ 
+ @return 0 if everything was ok, error code otherwise
+ */
+int init_spacing_variable(void);
+
+/**
+ Prepare the built model to find the points of the pareto front between the latency and the spacing. Every point
+ minimizes the latency and then maximizes the spacing with a minimum spacing given in every iteration
+ (epsilon-constraint), so the model is built only once and the solver keeps what it learnt between points
+ 
+ @param latency_objective latency to trade against the spacing (latency_sum_objective or latency_max_objective)
+ @return 0 if everything was ok, error code otherwise
+ */
+int init_pareto_front(ObjectiveType latency_objective);
 
 /**
  Optimize distances between transmission of the same frame during its path and frames transmitted at the same link
 
- @param csolver indicates which solver are we using
  @return 0 if everything was ok, error code otherwise
  */
-int optimize_distances(Solver csolver);
+int optimize_distances(void);
+
+/**
+ Get the number of constraints added into the solver until now, used to measure the constraint construction rate
+
+ @return number of constraints in the solver, error code otherwise
+ */
+long long int get_num_constraints(void);
 
 /**
- Check the constraint solver and returns the status of it, if everything went well, it creates the schedule model
+ Get how many intersections between offsets were simplified by their transmission windows while building the model
+
+ @param ordered pointer to save the number of intersections reduced to a single order
+ @param removed pointer to save the number of intersections removed as the offsets can never collide
+ */
+void get_num_presolved_intersections(long long int *ordered, long long int *removed);
+
+/**
+ Save the transmission times found by the solver into the offsets of the current stage, so they can be fixed in next
+ stages or written in the schedule. The offsets of rejected frames are 0, as they are not transmitted
+
+ @return 0 if done correctly, error code otherwise
+ */
+int extract_schedule(void);
+
+/**
+ Check the constraint solver and returns the status of it, if everything went well, it extracts the schedule into the
+ offsets of the network
  
- @param csolver indicates which solver are we using
  @param time limit time in seconds to solve the schedule
  @param tune if tune is active, instead of solving the schedule, it will tune and find good parameters
  @param tunetimelimit limit in seconds to tune
- @return 1 if the schedule was found, error code otherwise
+ @return 1 if the schedule was found, 0 if only tuned, error code otherwise
+ */
+int check_solver(int time, int tune, int tunetimelimit);
+
+/**
+ Explain why the tracked model has no schedule. The unsat core of the tracking literals given by the solver is
+ minimized removing one group at a time, a group is only kept if the rest of the core has a schedule without it.
+ The groups in conflict, their frames and the links where they contend are printed
+
+ @param time limit time in seconds of every check of the solver
+ @return number of groups in conflict, 0 if there is a schedule, error code otherwise
+ */
+int explain_conflict(int time);
+
+/**
+ Get the groups of constraints in the last conflict explained
+
+ @param core pointer to save the array with the groups in conflict
+ @return number of groups in conflict
+ */
+int get_conflict_core(ConflictGroup **core);
+
+/**
+ Find the point of the pareto front with the best latency and at least the given spacing, and extract its schedule
+ into the offsets of the network. The model is not modified, so it can be called again with a larger spacing
+ 
+ @param time limit time in seconds to find the point
+ @param min_spacing minimum spacing between two transmissions of the same link in ns
+ @param latency pointer to save the latency of the point found
+ @param spacing pointer to save the spacing of the point found
+ @return 1 if the point was found, SOLUTION_NOT_PROVEN if the time limit stopped the search after finding it, 0 if
+ there is no schedule with such spacing, BACKEND_TIME_LIMIT if the time limit stopped the search before finding any,
+ error code otherwise
+ */
+int check_pareto_point(int time, long long int min_spacing, long long int *latency, long long int *spacing);
+
+/**
+ Release the model of the solver once no more schedules are needed from it
+ 
  */
-int check_solver(Solver csolver, int time, int tune, int tunetimelimit);
+void release_solver(void);
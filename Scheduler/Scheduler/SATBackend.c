@@ -0,0 +1,1100 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  SATBackend.c                                                                                                       *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Description in SATBackend.h                                                                                        *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Backend.h"
+#include "SATBackend.h"
+
+/* VARIABLES */
+
+long long int sat_macrotick = SAT_DEFAULT_MACROTICK;    // Length of a macrotick in ns
+SATVariable *sat_variables = NULL;  // Every variable of the model, its handle is the index in the array
+int sat_num_variables = 0;          // Number of variables of the model
+int sat_variables_capacity = 0;     // Number of variables allocated
+int sat_num_literals = 0;           // Number of literals of the CNF, order literals and auxiliary ones
+int *sat_clauses = NULL;            // Literals of all the clauses, every clause finishes with a 0 as in DIMACS
+long long int sat_clauses_size = 0; // Number of literals and terminators in the clauses
+long long int sat_clauses_capacity = 0; // Number of literals allocated for the clauses
+long long int sat_num_clauses = 0;  // Number of clauses of the CNF
+long long int sat_clause_start = 0; // Position of the clause that is being built
+int sat_clause_satisfied = 0;       // 1 if the clause that is being built has a literal that is always true
+int *sat_bound_variables = NULL;    // Variables with a lower bound that is only assumed in every solve
+long long int *sat_bound_values = NULL; // Value of every lower bound assumed in every solve
+int sat_num_bounds = 0;             // Number of lower bounds assumed in every solve
+char *sat_solution = NULL;          // Value of every literal in the last solution found, NULL if there is none
+Z3_context sat_context = NULL;      // Context of z3 where the clauses are solved, NULL if nothing was solved yet
+Z3_solver sat_solver;               // Solver of z3 for finite domains, that solves the clauses with its SAT core
+Z3_ast *sat_z3_literals = NULL;     // Boolean constant of z3 of every literal
+int sat_z3_num_literals = 0;        // Number of literals that already have a constant in z3
+long long int sat_asserted_size = 0;    // Position of the first clause that was not asserted into z3 yet
+char sat_export_filename[1000];     // Name of the file where the CNF is exported once it is finished
+int sat_export_pending = 0;         // 1 if the CNF has to be exported before it is solved
+
+/* PRIVATE FUNCTIONS */
+
+/**
+ Integer division rounded towards minus infinity
+
+ @param a dividend
+ @param b divisor, not 0
+ @return floor of a / b
+ */
+long long int sat_floor_division(long long int a, long long int b) {
+    
+    long long int quotient = a / b;
+    
+    if (a % b != 0 && ((a < 0) != (b < 0))) {
+        quotient--;
+    }
+    return quotient;
+}
+
+/**
+ Integer division rounded towards plus infinity
+
+ @param a dividend
+ @param b divisor, not 0
+ @return ceiling of a / b
+ */
+long long int sat_ceil_division(long long int a, long long int b) {
+    
+    return -sat_floor_division(-a, b);
+}
+
+/**
+ Create a new literal in the CNF
+
+ @return number of the literal
+ */
+int sat_new_literal(void) {
+    
+    sat_num_literals++;
+    return sat_num_literals;
+}
+
+/**
+ Append a literal or the terminator of a clause into the clauses
+
+ @param literal literal or 0 to finish the clause
+ */
+void sat_append(int literal) {
+    
+    if (sat_clauses_size == sat_clauses_capacity) {
+        sat_clauses_capacity = sat_clauses_capacity == 0 ? 65536 : sat_clauses_capacity * 2;
+        sat_clauses = realloc(sat_clauses, sizeof(int) * sat_clauses_capacity);
+    }
+    sat_clauses[sat_clauses_size] = literal;
+    sat_clauses_size++;
+}
+
+/**
+ Add a literal into the clause that is being built. Literals that are always false are removed, and literals that are
+ always true satisfy the clause, so it is not added
+
+ @param literal literal, SAT_TRUE_LITERAL or SAT_FALSE_LITERAL
+ */
+void sat_add_literal(int literal) {
+    
+    if (literal == SAT_TRUE_LITERAL) {
+        sat_clause_satisfied = 1;
+    } else if (literal != SAT_FALSE_LITERAL) {
+        sat_append(literal);
+    }
+}
+
+/**
+ Start a new clause with the given literals
+
+ @param num_prefix number of literals that start the clause
+ @param prefix literals that start the clause (the negation of the literals that activate it)
+ */
+void sat_begin_clause(int num_prefix, int *prefix) {
+    
+    sat_clause_start = sat_clauses_size;
+    sat_clause_satisfied = 0;
+    for (int prefix_it = 0; prefix_it < num_prefix; prefix_it++) {
+        sat_add_literal(prefix[prefix_it]);
+    }
+}
+
+/**
+ Finish the clause that is being built. If it has no literals, the CNF is unsatisfiable
+ */
+void sat_end_clause(void) {
+    
+    if (sat_clause_satisfied == 1) {
+        sat_clauses_size = sat_clause_start;
+        return;
+    }
+    sat_append(0);
+    sat_num_clauses++;
+}
+
+/**
+ Get the order literal that is true if the variable is at least its k-th value (base + k * step)
+
+ @param variable handle of the variable
+ @param k position of the value
+ @return order literal, SAT_TRUE_LITERAL if k is not positive and SAT_FALSE_LITERAL if it is larger than the range
+ */
+int sat_order_literal(int variable, long long int k) {
+    
+    SATVariable *variable_pt = &sat_variables[variable];
+    
+    if (k <= 0) {
+        return SAT_TRUE_LITERAL;
+    }
+    if (k > variable_pt->num_literals) {
+        return SAT_FALSE_LITERAL;
+    }
+    return variable_pt->first_literal + (int) k - 1;
+}
+
+/**
+ Get the literal that is true if coefficient * variable >= rhs
+
+ @param variable handle of the variable
+ @param coefficient coefficient of the variable, not 0
+ @param rhs right hand side
+ @return literal, SAT_TRUE_LITERAL or SAT_FALSE_LITERAL
+ */
+int sat_bound_literal(int variable, long long int coefficient, long long int rhs) {
+    
+    SATVariable *variable_pt = &sat_variables[variable];
+    long long int bound;
+    
+    if (coefficient > 0) {
+        // variable >= bound, so the first value that reaches it
+        bound = sat_ceil_division(rhs, coefficient);
+        return sat_order_literal(variable, sat_ceil_division(bound - variable_pt->base, variable_pt->step));
+    }
+    // variable <= bound, so it cannot reach the value after the last one below it
+    bound = sat_floor_division(rhs, coefficient);
+    return -sat_order_literal(variable, sat_floor_division(bound - variable_pt->base, variable_pt->step) + 1);
+}
+
+/**
+ Get the literal that is true if the boolean variable has the given value
+
+ @param variable handle of the variable
+ @param value value of the variable, 0 or 1
+ @return literal, SAT_TRUE_LITERAL or SAT_FALSE_LITERAL
+ */
+int sat_boolean_literal(int variable, int value) {
+    
+    return value == 1 ? sat_bound_literal(variable, 1, 1) : -sat_bound_literal(variable, 1, 1);
+}
+
+/**
+ Check that all the variables of a linear row exist
+
+ @param row pointer to the linear row
+ @return 0 if they exist, error code otherwise
+ */
+int sat_check_row(LinearConstraint *row) {
+    
+    for (int term_it = 0; term_it < row->num_variables; term_it++) {
+        if (row->variables[term_it] < 0 || row->variables[term_it] >= sat_num_variables) {
+            return SAT_VARIABLE_OUT_OF_RANGE;
+        }
+    }
+    return 0;
+}
+
+/**
+ Encode a linear row sum >= rhs into clauses. Constants are moved into the right hand side, so only two variables can
+ be left. With two variables, every value k of the first one gives a clause: either the first one is larger than its
+ k-th value (or smaller, with a negative coefficient), or the second one covers the rest of the right hand side
+
+ @param num_terms number of terms of the row
+ @param variables handle of the variable of every term
+ @param coefficients coefficient of every term
+ @param rhs right hand side
+ @param num_prefix number of literals that start every clause
+ @param prefix literals that start every clause
+ @return 0 if done correctly, error code otherwise
+ */
+int sat_encode_greater(int num_terms, int *variables, long long int *coefficients, long long int rhs, int num_prefix,
+                       int *prefix) {
+    
+    int terms[MAX_LINEAR_VARIABLES];
+    long long int values[MAX_LINEAR_VARIABLES];
+    int num_left = 0;
+    int first, second;
+    SATVariable *first_pt;
+    long long int value;
+    
+    for (int term_it = 0; term_it < num_terms; term_it++) {
+        if (coefficients[term_it] == 0) {
+            continue;
+        }
+        if (sat_variables[variables[term_it]].num_literals == 0) {
+            rhs -= coefficients[term_it] * sat_variables[variables[term_it]].base;
+        } else {
+            terms[num_left] = variables[term_it];
+            values[num_left] = coefficients[term_it];
+            num_left++;
+        }
+    }
+    
+    if (num_left == 0) {
+        if (rhs > 0) {
+            sat_begin_clause(num_prefix, prefix);
+            sat_end_clause();
+        }
+    } else if (num_left == 1) {
+        sat_begin_clause(num_prefix, prefix);
+        sat_add_literal(sat_bound_literal(terms[0], values[0], rhs));
+        sat_end_clause();
+    } else if (num_left == 2) {
+        // Going through the values of the variable with less literals gives less clauses
+        first = sat_variables[terms[0]].num_literals <= sat_variables[terms[1]].num_literals ? 0 : 1;
+        second = 1 - first;
+        first_pt = &sat_variables[terms[first]];
+        for (int k = 0; k <= first_pt->num_literals; k++) {
+            value = first_pt->base + k * first_pt->step;
+            sat_begin_clause(num_prefix, prefix);
+            if (values[first] > 0) {
+                sat_add_literal(sat_order_literal(terms[first], k + 1));
+            } else {
+                sat_add_literal(-sat_order_literal(terms[first], k));
+            }
+            sat_add_literal(sat_bound_literal(terms[second], values[second], rhs - values[first] * value));
+            sat_end_clause();
+        }
+    } else {
+        printf("The SAT encoding only supports rows with two variables, objectives cannot be encoded\n");
+        return SAT_ROW_NOT_SUPPORTED;
+    }
+    
+    return 0;
+}
+
+/**
+ Encode a linear row into clauses, every clause starts with the given literals
+
+ @param row pointer to the linear row
+ @param num_prefix number of literals that start every clause
+ @param prefix literals that start every clause
+ @return 0 if done correctly, error code otherwise
+ */
+int sat_encode_row(LinearConstraint *row, int num_prefix, int *prefix) {
+    
+    long long int negated[MAX_LINEAR_VARIABLES];
+    int result = 0;
+    
+    if (sat_check_row(row) < 0) {
+        return SAT_VARIABLE_OUT_OF_RANGE;
+    }
+    for (int term_it = 0; term_it < row->num_variables; term_it++) {
+        negated[term_it] = -row->values[term_it];
+    }
+    if (row->sense != sense_less_equal) {
+        result = sat_encode_greater(row->num_variables, row->variables, row->values, row->rhs, num_prefix, prefix);
+    }
+    if (result == 0 && row->sense != sense_greater_equal) {
+        result = sat_encode_greater(row->num_variables, row->variables, negated, -row->rhs, num_prefix, prefix);
+    }
+    return result;
+}
+
+/**
+ Add that at most one of the literals is true. Few literals are encoded with a clause for every pair, and the rest
+ with a sequential counter, where the auxiliary literal i is true if any of the first i + 1 literals is true
+
+ @param num_literals number of literals
+ @param literals literals
+ */
+void sat_add_at_most_one(int num_literals, int *literals) {
+    
+    int counter, previous = 0;
+    
+    if (num_literals <= SAT_PAIRWISE_LITERALS) {
+        for (int first_it = 0; first_it < num_literals; first_it++) {
+            for (int second_it = first_it + 1; second_it < num_literals; second_it++) {
+                sat_begin_clause(0, NULL);
+                sat_add_literal(-literals[first_it]);
+                sat_add_literal(-literals[second_it]);
+                sat_end_clause();
+            }
+        }
+        return;
+    }
+    
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        counter = literal_it < num_literals - 1 ? sat_new_literal() : 0;
+        if (counter != 0) {
+            // literal => counter
+            sat_begin_clause(0, NULL);
+            sat_add_literal(-literals[literal_it]);
+            sat_add_literal(counter);
+            sat_end_clause();
+        }
+        if (previous != 0) {
+            // previous counter => counter, and the literal cannot be true after another one
+            if (counter != 0) {
+                sat_begin_clause(0, NULL);
+                sat_add_literal(-previous);
+                sat_add_literal(counter);
+                sat_end_clause();
+            }
+            sat_begin_clause(0, NULL);
+            sat_add_literal(-literals[literal_it]);
+            sat_add_literal(-previous);
+            sat_end_clause();
+        }
+        previous = counter;
+    }
+}
+
+/**
+ Write the CNF into the export file in DIMACS, the lower bounds of the solves are assumptions so they are not written
+
+ @return 0 if done correctly, error code otherwise
+ */
+int write_sat_export(void) {
+    
+    FILE *export_file;
+    
+    if (sat_export_pending == 0) {
+        return 0;
+    }
+    sat_export_pending = 0;
+    export_file = fopen(sat_export_filename, "w");
+    if (export_file == NULL) {
+        printf("The export file could not be opened\n");
+        return EXPORT_FILE_NOT_OPENED;
+    }
+    fprintf(export_file, "c Time-indexed schedule with a macrotick of %lld ns\n", sat_macrotick);
+    fprintf(export_file, "p cnf %d %lld\n", sat_num_literals, sat_num_clauses);
+    for (long long int position = 0; position < sat_clauses_size; position++) {
+        if (sat_clauses[position] == 0) {
+            fprintf(export_file, "0\n");
+        } else {
+            fprintf(export_file, "%d ", sat_clauses[position]);
+        }
+    }
+    fclose(export_file);
+    return 0;
+}
+
+/**
+ Create the context of z3 and its solver for finite domains, that sends the boolean clauses to its SAT core
+
+ @param time limit time in seconds of every solve
+ */
+void init_sat_solver(int time) {
+    
+    Z3_config z3_configuration;
+    Z3_params z3_parameters;
+    
+    if (sat_context == NULL) {
+        z3_configuration = Z3_mk_config();
+        sat_context = Z3_mk_context(z3_configuration);
+        Z3_del_config(z3_configuration);
+        sat_solver = Z3_mk_solver_for_logic(sat_context, Z3_mk_string_symbol(sat_context, "QF_FD"));
+        Z3_solver_inc_ref(sat_context, sat_solver);
+        sat_z3_num_literals = 0;
+        sat_asserted_size = 0;
+    }
+    z3_parameters = Z3_mk_params(sat_context);
+    Z3_params_inc_ref(sat_context, z3_parameters);
+    Z3_params_set_uint(sat_context, z3_parameters, Z3_mk_string_symbol(sat_context, "timeout"),
+                       (unsigned) time * 1000);
+    Z3_solver_set_params(sat_context, sat_solver, z3_parameters);
+    Z3_params_dec_ref(sat_context, z3_parameters);
+}
+
+/**
+ Get the constant of z3 of a literal, negated if the literal is negative
+
+ @param literal literal
+ @return z3 formula of the literal
+ */
+Z3_ast get_sat_z3_literal(int literal) {
+    
+    if (literal < 0) {
+        return Z3_mk_not(sat_context, sat_z3_literals[-literal]);
+    }
+    return sat_z3_literals[literal];
+}
+
+/**
+ Assert into z3 the clauses added since the last solve, creating the constants of the new literals
+ */
+void assert_sat_clauses(void) {
+    
+    Z3_ast *z3_clause;
+    int clause_size = 0, clause_capacity = 16;
+    
+    sat_z3_literals = realloc(sat_z3_literals, sizeof(Z3_ast) * (sat_num_literals + 1));
+    for (int literal = sat_z3_num_literals + 1; literal <= sat_num_literals; literal++) {
+        sat_z3_literals[literal] = Z3_mk_const(sat_context, Z3_mk_int_symbol(sat_context, literal),
+                                               Z3_mk_bool_sort(sat_context));
+    }
+    sat_z3_num_literals = sat_num_literals;
+    
+    z3_clause = malloc(sizeof(Z3_ast) * clause_capacity);
+    for (long long int position = sat_asserted_size; position < sat_clauses_size; position++) {
+        if (sat_clauses[position] != 0) {
+            if (clause_size == clause_capacity) {
+                clause_capacity *= 2;
+                z3_clause = realloc(z3_clause, sizeof(Z3_ast) * clause_capacity);
+            }
+            z3_clause[clause_size] = get_sat_z3_literal(sat_clauses[position]);
+            clause_size++;
+            continue;
+        }
+        if (clause_size == 0) {
+            Z3_solver_assert(sat_context, sat_solver, Z3_mk_false(sat_context));
+        } else if (clause_size == 1) {
+            Z3_solver_assert(sat_context, sat_solver, z3_clause[0]);
+        } else {
+            Z3_solver_assert(sat_context, sat_solver, Z3_mk_or(sat_context, clause_size, z3_clause));
+        }
+        clause_size = 0;
+    }
+    sat_asserted_size = sat_clauses_size;
+    free(z3_clause);
+}
+
+/**
+ Free the model of the SAT encoding, it can be called several times
+ */
+void sat_destroy(void) {
+    
+    if (sat_context != NULL) {
+        Z3_solver_dec_ref(sat_context, sat_solver);
+        Z3_del_context(sat_context);
+        sat_context = NULL;
+    }
+    free(sat_solution);
+    sat_solution = NULL;
+    sat_num_variables = 0;
+    sat_num_literals = 0;
+    sat_clauses_size = 0;
+    sat_num_clauses = 0;
+    sat_num_bounds = 0;
+    sat_export_pending = 0;
+}
+
+/**
+ Create an empty model, freeing the previous one
+
+ @return 0 if done correctly
+ */
+int sat_create(void) {
+    
+    sat_destroy();
+    return 0;
+}
+
+/**
+ Export the CNF in DIMACS once it is finished, before it is solved
+
+ @param format format of the exported model, only dimacs_export is supported
+ @param filename name of the file to write the model
+ @return 0 if done correctly, error code otherwise
+ */
+int sat_open_export(ExportFormat format, char *filename) {
+    
+    if (format != dimacs_export) {
+        printf("Only DIMACS export is supported with the SAT encoding\n");
+        return EXPORT_FORMAT_NOT_SUPPORTED;
+    }
+    if (strlen(filename) >= sizeof(sat_export_filename)) {
+        printf("The export file name is too long\n");
+        return EXPORT_FILE_NOT_OPENED;
+    }
+    strcpy(sat_export_filename, filename);
+    sat_export_pending = 1;
+    return 0;
+}
+
+/**
+ Create a variable with an order literal for every value after the first one. Integer variables take a value every
+ macrotick from their lower bound, so the transmissions of the windows smaller than a macrotick still have a value
+
+ @param lower lower bound of the variable
+ @param upper upper bound of the variable
+ @param domain domain of the variable
+ @param index index of the variable in the optimizator, not used
+ @param name name of the variable, not used
+ @return handle of the variable, error code otherwise
+ */
+int sat_new_var(long long int lower, long long int upper, VariableDomain domain, int index, char *name) {
+    
+    SATVariable *variable_pt;
+    long long int num_ticks;
+    
+    (void) index;
+    (void) name;
+    if (sat_num_variables == sat_variables_capacity) {
+        sat_variables_capacity = sat_variables_capacity == 0 ? 1024 : sat_variables_capacity * 2;
+        sat_variables = realloc(sat_variables, sizeof(SATVariable) * sat_variables_capacity);
+    }
+    variable_pt = &sat_variables[sat_num_variables];
+    variable_pt->base = lower;
+    variable_pt->step = 1;
+    variable_pt->num_literals = 0;
+    
+    if (domain == boolean_domain) {
+        variable_pt->base = lower > 0 ? 1 : 0;
+        variable_pt->num_literals = lower <= 0 && upper >= 1 ? 1 : 0;
+    } else if (lower < upper) {
+        if (lower <= -INFINITE_BOUND || upper >= INFINITE_BOUND) {
+            printf("The SAT encoding needs bounded variables\n");
+            return SAT_HORIZON_TOO_LARGE;
+        }
+        num_ticks = (upper - lower) / sat_macrotick;
+        if (num_ticks > SAT_MAX_MACROTICKS) {
+            printf("A variable spans %lld macroticks and the SAT encoding supports %d, the macrotick should be "
+                   "larger\n", num_ticks, SAT_MAX_MACROTICKS);
+            return SAT_HORIZON_TOO_LARGE;
+        }
+        variable_pt->step = sat_macrotick;
+        variable_pt->num_literals = (int) num_ticks;
+    }
+    variable_pt->first_literal = sat_num_literals + 1;
+    sat_num_literals += variable_pt->num_literals;
+    
+    // variable >= value k => variable >= value k - 1
+    for (int k = 2; k <= variable_pt->num_literals; k++) {
+        sat_begin_clause(0, NULL);
+        sat_add_literal(-(variable_pt->first_literal + k - 1));
+        sat_add_literal(variable_pt->first_literal + k - 2);
+        sat_end_clause();
+    }
+    
+    sat_num_variables++;
+    return sat_num_variables - 1;
+}
+
+/**
+ Add a linear row that always holds
+
+ @param constraint pointer to the linear row
+ @return 0 if done correctly, error code otherwise
+ */
+int sat_add_diff(LinearConstraint *constraint) {
+    
+    return sat_encode_row(constraint, 0, NULL);
+}
+
+/**
+ Add a linear row that only holds when the literal has the given value
+
+ @param literal handle of the boolean literal
+ @param value value of the literal that activates the row
+ @param constraint pointer to the linear row
+ @return 0 if done correctly, error code otherwise
+ */
+int sat_add_guarded(int literal, int value, LinearConstraint *constraint) {
+    
+    int prefix;
+    
+    if (literal < 0 || literal >= sat_num_variables) {
+        return SAT_VARIABLE_OUT_OF_RANGE;
+    }
+    prefix = -sat_boolean_literal(literal, value);
+    return sat_encode_row(constraint, 1, &prefix);
+}
+
+/**
+ Add that at least one of the rows holds, unless any of the guard literals is false. Every row has a new literal that
+ activates it, and at least one of them is true
+
+ @param num_constraints number of rows
+ @param constraints rows
+ @param num_guards number of guard literals
+ @param guards handles of the guard literals
+ @return 0 if done correctly, error code otherwise
+ */
+int sat_add_disjunction(int num_constraints, LinearConstraint *constraints, int num_guards, int *guards) {
+    
+    int *prefix;
+    int selector;
+    int result = 0;
+    
+    for (int guard_it = 0; guard_it < num_guards; guard_it++) {
+        if (guards[guard_it] < 0 || guards[guard_it] >= sat_num_variables) {
+            return SAT_VARIABLE_OUT_OF_RANGE;
+        }
+    }
+    prefix = malloc(sizeof(int) * (num_guards + num_constraints));
+    for (int guard_it = 0; guard_it < num_guards; guard_it++) {
+        prefix[guard_it] = -sat_boolean_literal(guards[guard_it], 1);
+    }
+    
+    if (num_constraints == 1) {
+        result = sat_encode_row(&constraints[0], num_guards, prefix);
+        free(prefix);
+        return result;
+    }
+    for (int constraint_it = 0; constraint_it < num_constraints; constraint_it++) {
+        prefix[num_guards + constraint_it] = sat_new_literal();
+    }
+    // guards => any of the selectors
+    sat_begin_clause(num_guards + num_constraints, prefix);
+    sat_end_clause();
+    for (int constraint_it = 0; constraint_it < num_constraints && result == 0; constraint_it++) {
+        selector = -prefix[num_guards + constraint_it];
+        result = sat_encode_row(&constraints[constraint_it], 1, &selector);
+    }
+    free(prefix);
+    return result;
+}
+
+/**
+ Add that the result literal is true if and only if any of the literals is true
+
+ @param result handle of the result literal
+ @param num_literals number of literals
+ @param literals handles of the literals
+ @return 0 if done correctly, error code otherwise
+ */
+int sat_add_or(int result, int num_literals, int *literals) {
+    
+    if (result < 0 || result >= sat_num_variables) {
+        return SAT_VARIABLE_OUT_OF_RANGE;
+    }
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        if (literals[literal_it] < 0 || literals[literal_it] >= sat_num_variables) {
+            return SAT_VARIABLE_OUT_OF_RANGE;
+        }
+    }
+    
+    // result => any of the literals
+    sat_begin_clause(0, NULL);
+    sat_add_literal(-sat_boolean_literal(result, 1));
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        sat_add_literal(sat_boolean_literal(literals[literal_it], 1));
+    }
+    sat_end_clause();
+    // every literal => result
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        sat_begin_clause(0, NULL);
+        sat_add_literal(-sat_boolean_literal(literals[literal_it], 1));
+        sat_add_literal(sat_boolean_literal(result, 1));
+        sat_end_clause();
+    }
+    return 0;
+}
+
+/**
+ Add that exactly one of the literals is true
+
+ @param num_literals number of literals
+ @param literals handles of the literals
+ @return 0 if done correctly, error code otherwise
+ */
+int sat_add_exactly_one(int num_literals, int *literals) {
+    
+    int *cnf_literals;
+    
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        if (literals[literal_it] < 0 || literals[literal_it] >= sat_num_variables) {
+            return SAT_VARIABLE_OUT_OF_RANGE;
+        }
+    }
+    cnf_literals = malloc(sizeof(int) * (num_literals + 1));
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        cnf_literals[literal_it] = sat_boolean_literal(literals[literal_it], 1);
+    }
+    sat_begin_clause(num_literals, cnf_literals);
+    sat_end_clause();
+    sat_add_at_most_one(num_literals, cnf_literals);
+    free(cnf_literals);
+    return 0;
+}
+
+/**
+ Add a link as a time-indexed resource. Every macrotick of the link has a literal for every task that can occupy it,
+ true when the task starts in one of the macroticks that reach it, and at most one of them is true. Macroticks
+ occupied by constant tasks (fixed in previous stages) cannot be occupied by any other task. A task occupies all the
+ macroticks it touches, so two tasks shorter than a macrotick cannot share one, and the encoding is stricter than the
+ resource when the macrotick is larger than the transmissions
+
+ @param num_tasks number of tasks
+ @param variables handles of the start variable of every task
+ @param durations duration of every task
+ @return 0 if done correctly, error code otherwise
+ */
+int sat_add_resource(int num_tasks, int *variables, long long int *durations) {
+    
+    SATVariable *variable_pt;
+    long long int first_slot = LLONG_MAX, last_slot = LLONG_MIN;
+    long long int start_slot, end_slot, width;
+    long long int lowest, highest;
+    int num_slots, total = 0;
+    char *occupied;
+    int *slot_start, *slot_size, *slot_literals;
+    int literal;
+    
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        if (variables[task_it] < 0 || variables[task_it] >= sat_num_variables) {
+            return SAT_VARIABLE_OUT_OF_RANGE;
+        }
+        variable_pt = &sat_variables[variables[task_it]];
+        if (variable_pt->num_literals > 0 && variable_pt->step != sat_macrotick) {
+            printf("The tasks of a resource have to move in macroticks\n");
+            return SAT_TASK_NOT_ON_MACROTICKS;
+        }
+        if (durations[task_it] <= 0) {
+            continue;
+        }
+        start_slot = sat_floor_division(variable_pt->base, sat_macrotick);
+        end_slot = sat_floor_division(variable_pt->base + variable_pt->num_literals * variable_pt->step +
+                                      durations[task_it] - 1, sat_macrotick);
+        first_slot = start_slot < first_slot ? start_slot : first_slot;
+        last_slot = end_slot > last_slot ? end_slot : last_slot;
+    }
+    if (first_slot > last_slot) {
+        return 0;
+    }
+    if (last_slot - first_slot >= SAT_MAX_MACROTICKS) {
+        printf("A link spans %lld macroticks and the SAT encoding supports %d, the macrotick should be larger\n",
+               last_slot - first_slot + 1, SAT_MAX_MACROTICKS);
+        return SAT_HORIZON_TOO_LARGE;
+    }
+    
+    num_slots = (int) (last_slot - first_slot + 1);
+    occupied = calloc(num_slots, sizeof(char));
+    slot_start = calloc(num_slots + 1, sizeof(int));
+    slot_size = calloc(num_slots, sizeof(int));
+    
+    // Count the literals of every macrotick, and mark the ones occupied by constants
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        variable_pt = &sat_variables[variables[task_it]];
+        if (durations[task_it] <= 0) {
+            continue;
+        }
+        start_slot = sat_floor_division(variable_pt->base, sat_macrotick) - first_slot;
+        end_slot = sat_floor_division(variable_pt->base + variable_pt->num_literals * variable_pt->step +
+                                      durations[task_it] - 1, sat_macrotick) - first_slot;
+        for (long long int slot = start_slot; slot <= end_slot; slot++) {
+            if (variable_pt->num_literals == 0) {
+                occupied[slot] = 1;
+            } else {
+                slot_start[slot + 1]++;
+            }
+        }
+    }
+    for (int slot = 0; slot < num_slots; slot++) {
+        slot_start[slot + 1] += slot_start[slot];
+    }
+    total = slot_start[num_slots];
+    slot_literals = malloc(sizeof(int) * (total + 1));
+    
+    // The task occupies the macrotick if it starts in one of the width macroticks before it. All the values of the
+    // task are at the same distance from the start of their macrotick, so all of them occupy the same width
+    for (int task_it = 0; task_it < num_tasks; task_it++) {
+        variable_pt = &sat_variables[variables[task_it]];
+        if (durations[task_it] <= 0 || variable_pt->num_literals == 0) {
+            continue;
+        }
+        start_slot = sat_floor_division(variable_pt->base, sat_macrotick);
+        width = sat_floor_division(variable_pt->base + durations[task_it] - 1, sat_macrotick) - start_slot + 1;
+        start_slot -= first_slot;
+        for (long long int slot = start_slot; slot < start_slot + variable_pt->num_literals + width; slot++) {
+            lowest = slot - start_slot - width + 1;
+            highest = slot - start_slot;
+            literal = sat_new_literal();
+            // variable in [lowest, highest] => literal
+            sat_begin_clause(0, NULL);
+            sat_add_literal(-sat_order_literal(variables[task_it], lowest));
+            sat_add_literal(sat_order_literal(variables[task_it], highest + 1));
+            sat_add_literal(literal);
+            sat_end_clause();
+            slot_literals[slot_start[slot] + slot_size[slot]] = literal;
+            slot_size[slot]++;
+        }
+    }
+    
+    for (int slot = 0; slot < num_slots; slot++) {
+        if (occupied[slot] == 1) {
+            for (int literal_it = 0; literal_it < slot_size[slot]; literal_it++) {
+                sat_begin_clause(0, NULL);
+                sat_add_literal(-slot_literals[slot_start[slot] + literal_it]);
+                sat_end_clause();
+            }
+        } else {
+            sat_add_at_most_one(slot_size[slot], &slot_literals[slot_start[slot]]);
+        }
+    }
+    
+    free(occupied);
+    free(slot_start);
+    free(slot_size);
+    free(slot_literals);
+    return 0;
+}
+
+/**
+ Objectives cannot be encoded, the SAT encoding only looks for feasible schedules
+
+ @param num_variables number of variables of the objective
+ @param variables handles of the variables
+ @param values weight of every variable
+ @return error code
+ */
+int sat_set_objective(int num_variables, int *variables, double *values) {
+    
+    (void) num_variables;
+    (void) variables;
+    (void) values;
+    printf("The SAT encoding only looks for feasible schedules, objectives are not supported\n");
+    return SAT_OBJECTIVE_NOT_SUPPORTED;
+}
+
+/**
+ Change the lower bound of a variable for the next calls to solve. It is assumed in every solve, so the clauses and
+ what the SAT core learnt from them are kept
+
+ @param variable handle of the variable
+ @param lower new lower bound
+ @return 0 if done correctly, error code otherwise
+ */
+int sat_set_lower_bound(int variable, long long int lower) {
+    
+    if (variable < 0 || variable >= sat_num_variables) {
+        return SAT_VARIABLE_OUT_OF_RANGE;
+    }
+    for (int bound_it = 0; bound_it < sat_num_bounds; bound_it++) {
+        if (sat_bound_variables[bound_it] == variable) {
+            sat_bound_values[bound_it] = lower;
+            return 0;
+        }
+    }
+    sat_bound_variables = realloc(sat_bound_variables, sizeof(int) * (sat_num_bounds + 1));
+    sat_bound_values = realloc(sat_bound_values, sizeof(long long int) * (sat_num_bounds + 1));
+    sat_bound_variables[sat_num_bounds] = variable;
+    sat_bound_values[sat_num_bounds] = lower;
+    sat_num_bounds++;
+    return 0;
+}
+
+/**
+ Solve the clauses with the SAT core of z3 assuming the lower bounds and the given literals, and keep the value of
+ every literal of the solution. If there is no solution, the given literals in the unsat core of z3 are saved
+
+ @param time limit time in seconds
+ @param num_literals number of literals assumed
+ @param literals array with the handles of the literals assumed
+ @param num_core pointer to save the number of literals in the unsat core, NULL if the core is not needed
+ @param core array to save the handles of the literals in the unsat core, with space for all the literals assumed
+ @return 1 if a solution was found, 0 if there is none, SAT_UNKNOWN_RESULT if it is unknown
+ */
+int check_sat_assumptions(int time, int num_literals, int *literals, int *num_core, int *core) {
+    
+    Z3_ast *assumptions;
+    int *assumed;                       // Handle of the literal of every assumption, NO_VARIABLE for the bounds
+    Z3_ast_vector z3_core;
+    Z3_lbool z3_result;
+    Z3_model z3_model;
+    Z3_ast z3_value;
+    int num_assumptions = 0;
+    int literal;
+    
+    write_sat_export();
+    free(sat_solution);
+    sat_solution = NULL;
+    init_sat_solver(time);
+    assert_sat_clauses();
+    if (num_core != NULL) {
+        *num_core = 0;
+    }
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        if (literals[literal_it] < 0 || literals[literal_it] >= sat_num_variables) {
+            return SAT_VARIABLE_OUT_OF_RANGE;
+        }
+    }
+    
+    assumptions = malloc(sizeof(Z3_ast) * (sat_num_bounds + num_literals + 1));
+    assumed = malloc(sizeof(int) * (sat_num_bounds + num_literals + 1));
+    for (int assumption_it = 0; assumption_it < sat_num_bounds + num_literals; assumption_it++) {
+        if (assumption_it < sat_num_bounds) {
+            literal = sat_bound_literal(sat_bound_variables[assumption_it], 1, sat_bound_values[assumption_it]);
+        } else {
+            literal = sat_boolean_literal(literals[assumption_it - sat_num_bounds], 1);
+        }
+        if (literal == SAT_FALSE_LITERAL) {
+            // A literal that is always false is a core by itself
+            if (num_core != NULL && assumption_it >= sat_num_bounds) {
+                core[0] = literals[assumption_it - sat_num_bounds];
+                *num_core = 1;
+            }
+            free(assumptions);
+            free(assumed);
+            return 0;
+        }
+        if (literal != SAT_TRUE_LITERAL) {
+            assumptions[num_assumptions] = get_sat_z3_literal(literal);
+            assumed[num_assumptions] = assumption_it < sat_num_bounds ? NO_VARIABLE :
+                                                                        literals[assumption_it - sat_num_bounds];
+            num_assumptions++;
+        }
+    }
+    z3_result = Z3_solver_check_assumptions(sat_context, sat_solver, num_assumptions, assumptions);
+    if (get_backend_statistics() == 1) {
+        printf("The SAT encoding with %d literals and %lld clauses is %s\n", sat_num_literals, sat_num_clauses,
+               z3_result == Z3_L_TRUE ? "satisfiable" : (z3_result == Z3_L_FALSE ? "unsatisfiable" : "unknown"));
+    }
+    if (z3_result == Z3_L_FALSE && num_core != NULL) {
+        z3_core = Z3_solver_get_unsat_core(sat_context, sat_solver);
+        Z3_ast_vector_inc_ref(sat_context, z3_core);
+        for (unsigned core_it = 0; core_it < Z3_ast_vector_size(sat_context, z3_core); core_it++) {
+            z3_value = Z3_ast_vector_get(sat_context, z3_core, core_it);
+            for (int assumption_it = 0; assumption_it < num_assumptions; assumption_it++) {
+                if (assumed[assumption_it] != NO_VARIABLE &&
+                    Z3_is_eq_ast(sat_context, z3_value, assumptions[assumption_it])) {
+                    core[*num_core] = assumed[assumption_it];
+                    (*num_core)++;
+                    break;
+                }
+            }
+        }
+        Z3_ast_vector_dec_ref(sat_context, z3_core);
+    }
+    free(assumptions);
+    free(assumed);
+    if (z3_result != Z3_L_TRUE) {
+        return z3_result == Z3_L_FALSE ? 0 : SAT_UNKNOWN_RESULT;
+    }
+    
+    z3_model = Z3_solver_get_model(sat_context, sat_solver);
+    Z3_model_inc_ref(sat_context, z3_model);
+    sat_solution = malloc(sizeof(char) * (sat_num_literals + 1));
+    for (literal = 1; literal <= sat_num_literals; literal++) {
+        sat_solution[literal] = 0;
+        if (Z3_model_eval(sat_context, z3_model, sat_z3_literals[literal], Z3_TRUE, &z3_value) == Z3_TRUE &&
+            Z3_get_bool_value(sat_context, z3_value) == Z3_L_TRUE) {
+            sat_solution[literal] = 1;
+        }
+    }
+    Z3_model_dec_ref(sat_context, z3_model);
+    return 1;
+}
+
+/**
+ Solve the clauses with the SAT core of z3 and keep the value of every literal of the solution
+
+ @param time limit time in seconds
+ @return 1 if a solution was found, 0 if there is none, BACKEND_TIME_LIMIT if the time limit stopped the search
+ */
+int sat_solve(int time) {
+    
+    int result = check_sat_assumptions(time, 0, NULL, NULL, NULL);
+    
+    if (result == SAT_UNKNOWN_RESULT) {
+        return BACKEND_TIME_LIMIT;
+    }
+    return result == 1 ? 1 : 0;
+}
+
+/**
+ Solve the clauses assuming that the given literals are true. If there is no solution, the literals in conflict are
+ the ones in the unsat core of z3
+
+ @param time limit time in seconds
+ @param num_literals number of literals assumed
+ @param literals array with the handles of the literals assumed
+ @param num_core pointer to save the number of literals in the unsat core
+ @param core array to save the handles of the literals in the unsat core, with space for all the literals assumed
+ @return 1 if a solution was found, 0 if there is none, error code if it is unknown
+ */
+int sat_solve_assuming(int time, int num_literals, int *literals, int *num_core, int *core) {
+    
+    return check_sat_assumptions(time, num_literals, literals, num_core, core);
+}
+
+/**
+ Get the value of a variable in the last solution found, its number of true order literals says which value it has
+
+ @param variable handle of the variable
+ @param value pointer to save the value, literals are 1 if true and 0 if false
+ @return 0 if done correctly, error code otherwise
+ */
+int sat_get_value(int variable, long long int *value) {
+    
+    SATVariable *variable_pt;
+    int k = 0;
+    
+    if (sat_solution == NULL) {
+        return NO_SAT_MODEL;
+    }
+    if (variable < 0 || variable >= sat_num_variables) {
+        return SAT_VARIABLE_OUT_OF_RANGE;
+    }
+    variable_pt = &sat_variables[variable];
+    while (k < variable_pt->num_literals && sat_solution[variable_pt->first_literal + k] == 1) {
+        k++;
+    }
+    *value = variable_pt->base + k * variable_pt->step;
+    return 0;
+}
+
+/**
+ Get the number of clauses of the CNF
+
+ @return number of constraints
+ */
+long long int sat_get_num_constraints(void) {
+    
+    return sat_num_clauses;
+}
+
+/* PUBLIC FUNCTIONS */
+
+/**
+ Set the length of the macrotick of the SAT encoding for the next models. Variables take a value every macrotick from
+ their lower bound, so a larger macrotick gives a smaller encoding that misses the values in between, and every
+ variable can span at most SAT_MAX_MACROTICKS of them
+
+ @param macrotick length of the macrotick in ns, 0 or less to use the default one
+ */
+void set_sat_macrotick(long long int macrotick) {
+    
+    sat_macrotick = macrotick > 0 ? macrotick : SAT_DEFAULT_MACROTICK;
+}
+
+/**
+ Get the built in backend of the time-indexed SAT encoding, solved with the SAT core of z3
+
+ @return pointer to the backend
+ */
+SolverBackend * get_sat_backend(void) {
+    
+    static SolverBackend sat_backend = {
+        .version = BACKEND_INTERFACE_VERSION,
+        .name = "sat",
+        .distances = 0,
+        .create = sat_create,
+        .open_export = sat_open_export,
+        .new_var = sat_new_var,
+        .add_diff = sat_add_diff,
+        .add_guarded = sat_add_guarded,
+        .add_disjunction = sat_add_disjunction,
+        .add_or = sat_add_or,
+        .add_exactly_one = sat_add_exactly_one,
+        .add_resource = sat_add_resource,
+        .set_objective = sat_set_objective,
+        .set_lower_bound = sat_set_lower_bound,
+        .solve = sat_solve,
+        .solve_assuming = sat_solve_assuming,
+        .tune = NULL,
+        .get_value = sat_get_value,
+        .get_num_constraints = sat_get_num_constraints,
+        .destroy = sat_destroy
+    };
+    
+    return &sat_backend;
+}
@@ -0,0 +1,58 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  SATBackend.h                                                                                                       *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Package that contains the time-indexed SAT encoding. Time is divided in macroticks and every integer variable     *
+ *  takes a value every macrotick from its lower bound, with a boolean literal for every value saying if the variable  *
+ *  is at least there (order encoding). Linear rows become clauses between these literals, and every link is an        *
+ *  at-most-one constraint over the transmissions that can occupy each of its macroticks. The CNF is solved with the   *
+ *  SAT core of z3 and can be exported in DIMACS. It only looks for feasible schedules, so it is meant for networks    *
+ *  with small horizons.                                                                                               *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef SATBackend_h
+#define SATBackend_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <z3.h>
+
+#endif /* SATBackend_h */
+
+/* ERROR CODE DEFINITIONS */
+
+#define SAT_VARIABLE_OUT_OF_RANGE -1
+#define SAT_HORIZON_TOO_LARGE -2
+#define SAT_ROW_NOT_SUPPORTED -3
+#define SAT_OBJECTIVE_NOT_SUPPORTED -4
+#define SAT_TASK_NOT_ON_MACROTICKS -5
+#define NO_SAT_MODEL -6
+#define SAT_UNKNOWN_RESULT -7
+
+/* CODE DEFINITIONS */
+
+#define SAT_DEFAULT_MACROTICK 1000          // Length of a macrotick in ns if it is not configured
+#define SAT_MAX_MACROTICKS 65536            // Largest number of macroticks in the range of a variable or a link
+#define SAT_PAIRWISE_LITERALS 6             // Largest at-most-one encoded with pairs, larger ones use a counter
+#define SAT_TRUE_LITERAL INT_MAX            // Literal that is always true, it satisfies the clause
+#define SAT_FALSE_LITERAL (-INT_MAX)        // Literal that is always false, it is removed from the clause
+
+/* STRUCT DEFINITIONS */
+
+/**
+ Variable of the model in the order encoding. It can take the values base + k * step for k in [0, num_literals], and
+ the literal first_literal + k - 1 is true if and only if the value is at least base + k * step
+ */
+typedef struct SATVariable {
+    long long int base;                 // Smallest value of the variable
+    long long int step;                 // Distance between two consecutive values (the macrotick, or 1 for literals)
+    int num_literals;                   // Number of order literals, 0 if the variable is a constant
+    int first_literal;                  // Literal of the second value (literals are numbered from 1 as in DIMACS)
+}SATVariable;
@@ -19,29 +19,113 @@ int timelimit;
 int tunetimelimit;
 double distance_frame_weigth;
 double distance_link_weigth;
-Solver solver;
+int variable_naming = 0;
+int symmetry_breaking = 0;
+ScheduleMode schedule_mode = one_shot_mode;
+int backbone_links = 0;
+int slack_analysis = 0;
+int pareto_points = 10;
+int pre_routing = 0;
+int benders_iterations = 20;
+int benders_workers = 0;
+long long int macrotick = 0;
+int subset_weighted = 0;
+int conflict_analysis = 0;
+int model_statistics = 0;
+ObjectiveType schedule_objectives[MAX_OBJECTIVES];
+int num_schedule_objectives = 0;
+ExportFormat export_model = no_export;
+char export_model_file[1000];
+char solver[1000];
+int restricted_configuration = 0;       // 1 if the configuration comes from a client that is not trusted
 
 /**
- Given a schedule configuration file, load the needed variables to start the scheduling
+ Search the value of an optional parameter of the schedule configuration
 
- @param filename name of the scheduling file
+ @param file_configuration pointer to the top of the configuration xml tree
+ @param context xpath context of the configuration
+ @param path xpath of the parameter
+ @return value of the parameter that has to be freed with xmlFree, NULL if the parameter is not in the file
+ */
+xmlChar * get_optional_configuration(xmlDocPtr file_configuration, xmlXPathContextPtr context, char *path) {
+    
+    xmlChar *value = NULL;
+    xmlXPathObjectPtr result;
+    
+    result = xmlXPathEvalExpression((xmlChar*) path, context);
+    if (result->nodesetval != NULL && result->nodesetval->nodeTab != NULL) {
+        value = xmlNodeListGetString(file_configuration, result->nodesetval->nodeTab[0]->xmlChildrenNode, 1);
+    }
+    xmlXPathFreeObject(result);
+    return value;
+}
+
+/**
+ Set the default value of every optional parameter of the schedule configuration, so a configuration never keeps the
+ parameters of the one read before
+ */
+void reset_optional_configuration(void) {
+    
+    variable_naming = 0;
+    symmetry_breaking = 0;
+    schedule_mode = one_shot_mode;
+    backbone_links = 0;
+    pareto_points = 10;
+    num_schedule_objectives = 0;
+    pre_routing = 0;
+    benders_iterations = 20;
+    benders_workers = 0;
+    subset_weighted = 0;
+    macrotick = 0;
+    conflict_analysis = 0;
+    slack_analysis = 0;
+    model_statistics = 0;
+    export_model = no_export;
+    export_model_file[0] = '\0';
+}
+
+/**
+ Get the scheduling mode with the given name, as written in the schedule configuration
+
+ @param name name of the mode (oneshot, hierarchical, priority, pareto, benders or subset)
+ @return scheduling mode, MODE_NOT_FOUND if the name is not recognized
+ */
+int get_schedule_mode_by_name(char *name) {
+    
+    if (strcmp(name, "oneshot") == 0) {
+        return one_shot_mode;
+    } else if (strcmp(name, "hierarchical") == 0) {
+        return hierarchical_mode;
+    } else if (strcmp(name, "priority") == 0) {
+        return priority_mode;
+    } else if (strcmp(name, "pareto") == 0) {
+        return pareto_mode;
+    } else if (strcmp(name, "benders") == 0) {
+        return benders_mode;
+    } else if (strcmp(name, "subset") == 0) {
+        return subset_mode;
+    }
+    return MODE_NOT_FOUND;
+}
+
+/**
+ Given the xml tree of a schedule configuration, load the needed variables to start the scheduling. The tree is freed
+ once it is read. The optional parameters not given take their default value. If the configuration is restricted, only
+ the built in solvers are accepted and the model is never exported
+
+ @param file_configuration pointer to the top of the schedule configuration xml tree
  @return 0 if done correctly, error code otherwise
  */
-int read_schedule_configuration(char *filename) {
+int read_schedule_configuration_xml(xmlDocPtr file_configuration) {
     
     // Init xml variables needed to search information in the file
     xmlChar *value;
     xmlXPathContextPtr context;
     xmlXPathObjectPtr result;
-    xmlDocPtr file_configuration;
-    
-    file_configuration = xmlReadFile(filename, NULL, 0);
-    if (file_configuration == NULL) {
-        printf("The xml schedule configuration file does not exist\n");
-        return CONFIGURATION_NOT_FOUND;
-    }
+    int mode;
     
     context = xmlXPathNewContext(file_configuration);
+    reset_optional_configuration();
     
     // Search the time limit and save it
     result = xmlXPathEvalExpression((xmlChar*) "/ScheduleConfiguration/TimeLimit", context);
@@ -134,17 +218,192 @@ int read_schedule_configuration(char *filename) {
         return SOLVER_NOT_FOUND;
     }
     value = xmlNodeListGetString(file_configuration, result->nodesetval->nodeTab[0]->xmlChildrenNode, 1);
-    if (strcmp((const char*) value, "gurobi") == 0) {
-        solver = gurobi;
-    } else if (strcmp((const char*) value, "z3") == 0) {
-        solver = z3;
-    } else {
+    // The solver is a built in backend or the path of a shared library with one, only trusted configurations load
+    // libraries
+    if (restricted_configuration == 1 && get_built_in_backend((char*) value) == NULL) {
+        printf("Only the built in solvers can be used\n");
+        return SOLVER_NOT_FOUND;
+    }
+    if (strlen((const char*) value) >= sizeof(solver) || get_solver_backend((char*) value) == NULL) {
         printf("Solver not recognized or implemented\n");
         return SOLVER_NOT_FOUND;
     }
+    strcpy(solver, (const char*) value);
     // Free xml objects
     xmlFree(value);
     xmlXPathFreeObject(result);
+    
+    // Search if the variables should be named, optional as names are only needed to debug the model
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/VariableNames");
+    if (value != NULL) {
+        variable_naming = atoi((const char*) value);
+        xmlFree(value);
+    }
+    
+    // Search if identical frames should be ordered, optional as it is disabled by default
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/SymmetryBreaking");
+    if (value != NULL) {
+        symmetry_breaking = atoi((const char*) value);
+        xmlFree(value);
+    }
+    
+    // Search the scheduling mode, optional as by default all the network is scheduled in one shot
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/Mode");
+    if (value != NULL) {
+        mode = get_schedule_mode_by_name((char*) value);
+        xmlFree(value);
+        if (mode < 0) {
+            printf("Scheduling mode not recognized\n");
+            return MODE_NOT_FOUND;
+        }
+        schedule_mode = (ScheduleMode) mode;
+    }
+    
+    // Search the number of backbone links of the hierarchical mode, optional as by default it is a quarter of links
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/BackboneLinks");
+    if (value != NULL) {
+        backbone_links = atoi((const char*) value);
+        xmlFree(value);
+    }
+    
+    // Search the maximum number of points of the pareto front, optional as by default 10 points are searched
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/ParetoPoints");
+    if (value != NULL) {
+        pareto_points = atoi((const char*) value);
+        xmlFree(value);
+    }
+    
+    // Search the objectives separated by commas, from the most to the least important, optional as by default only
+    // the distances are maximized by the MIP solvers
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/Objective");
+    if (value != NULL) {
+        num_schedule_objectives = 0;
+        for (char *objective = strtok((char*) value, ", "); objective != NULL; objective = strtok(NULL, ", ")) {
+            if (num_schedule_objectives == MAX_OBJECTIVES) {
+                printf("Too many objectives, at most %d can be combined\n", MAX_OBJECTIVES);
+                xmlFree(value);
+                return OBJECTIVE_NOT_FOUND;
+            }
+            if (strcmp(objective, "distance") == 0) {
+                schedule_objectives[num_schedule_objectives] = distance_objective;
+            } else if (strcmp(objective, "latency_sum") == 0) {
+                schedule_objectives[num_schedule_objectives] = latency_sum_objective;
+            } else if (strcmp(objective, "latency_max") == 0) {
+                schedule_objectives[num_schedule_objectives] = latency_max_objective;
+            } else {
+                printf("Objective not recognized\n");
+                xmlFree(value);
+                return OBJECTIVE_NOT_FOUND;
+            }
+            num_schedule_objectives++;
+        }
+        xmlFree(value);
+    }
+    
+    // Search the rip-up and reroute iterations to route the frames before scheduling, optional as by default the
+    // frames are not routed and all their paths are used (or chosen by the solver with the path selector)
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/PreRouting");
+    if (value != NULL) {
+        pre_routing = atoi((const char*) value);
+        xmlFree(value);
+    }
+    
+    // Search the maximum number of routings tried by the benders mode, optional as by default 20 are tried
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/BendersIterations");
+    if (value != NULL) {
+        benders_iterations = atoi((const char*) value);
+        xmlFree(value);
+    }
+    
+    // Search the number of groups of frames scheduled at the same time by the benders mode, optional as by default
+    // there is one process for every processor
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/BendersWorkers");
+    if (value != NULL) {
+        benders_workers = atoi((const char*) value);
+        xmlFree(value);
+    }
+    
+    // Search how the frames scheduled by the subset mode are weighted, optional as by default all of them count 1
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/SubsetWeights");
+    if (value != NULL) {
+        if (strcmp((const char*) value, "count") == 0) {
+            subset_weighted = 0;
+        } else if (strcmp((const char*) value, "priority") == 0) {
+            subset_weighted = 1;
+        } else {
+            printf("Subset weights not recognized\n");
+            xmlFree(value);
+            return SUBSET_WEIGHTS_NOT_FOUND;
+        }
+        xmlFree(value);
+    }
+    
+    // Search the length of the macrotick in ns of the SAT encoding, optional as by default it is 1 us
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/Macrotick");
+    if (value != NULL) {
+        macrotick = atoll((const char*) value);
+        xmlFree(value);
+    }
+    
+    // Search if the conflict should be explained when there is no schedule, optional as it is disabled by default
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/ConflictAnalysis");
+    if (value != NULL) {
+        conflict_analysis = atoi((const char*) value);
+        xmlFree(value);
+    }
+    
+    // Search if the slack of the schedule should be analyzed, optional as it is disabled by default
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/SlackAnalysis");
+    if (value != NULL) {
+        slack_analysis = atoi((const char*) value);
+        xmlFree(value);
+    }
+    
+    // Search if the statistics of the model should be printed, optional as it is disabled by default
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/Statistics");
+    if (value != NULL) {
+        model_statistics = atoi((const char*) value);
+        xmlFree(value);
+    }
+    
+    // Search if the model should be exported and in which format, optional as it is disabled by default. Restricted
+    // configurations never write files other than the schedule, so the export is ignored
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/Export");
+    if (value != NULL && restricted_configuration == 1) {
+        xmlFree(value);
+    } else if (value != NULL) {
+        if (strcmp((const char*) value, "smt2") == 0) {
+            export_model = smt2_export;
+            strcpy(export_model_file, "Model.smt2");
+        } else if (strcmp((const char*) value, "lp") == 0) {
+            export_model = lp_export;
+            strcpy(export_model_file, "Model.lp");
+        } else if (strcmp((const char*) value, "mps") == 0) {
+            export_model = mps_export;
+            strcpy(export_model_file, "Model.mps");
+        } else if (strcmp((const char*) value, "dimacs") == 0) {
+            export_model = dimacs_export;
+            strcpy(export_model_file, "Model.cnf");
+        } else if (strcmp((const char*) value, "none") == 0) {
+            export_model = no_export;
+        } else {
+            printf("Export format not recognized\n");
+            xmlFree(value);
+            return EXPORT_FORMAT_NOT_FOUND;
+        }
+        xmlFree(value);
+    }
+    
+    // Search the file where the model is exported, if not given, a default name with the format extension is used
+    value = get_optional_configuration(file_configuration, context, "/ScheduleConfiguration/ExportFile");
+    if (value != NULL && restricted_configuration == 1) {
+        xmlFree(value);
+    } else if (value != NULL) {
+        strncpy(export_model_file, (const char*) value, sizeof(export_model_file) - 1);
+        export_model_file[sizeof(export_model_file) - 1] = '\0';
+        xmlFree(value);
+    }
+    
     xmlXPathFreeContext(context);
     xmlFreeDoc(file_configuration);
     
@@ -152,63 +411,1369 @@ int read_schedule_configuration(char *filename) {
 }
 
 /**
- Produces the schedule solving all constraints in one call to the Solver for a given network.
- It inits the solver and the network.
- It starts creating all the constraints (one variable for each transmission offset), then adds constraints relating
- different offsets. At the end solves the logical context and the model obtained is the solver.
- It creates an xml file with the output schedule.
- It also creates different constraint files for every switch in the network containing specific constraints for each
- switch
- 
+ Given a schedule configuration file, load the needed variables to start the scheduling
+
+ @param filename name of the scheduling file
+ @return 0 if done correctly, error code otherwise
+ */
+int read_schedule_configuration(char *filename) {
+    
+    xmlDocPtr file_configuration;
+    
+    file_configuration = xmlReadFile(filename, NULL, 0);
+    if (file_configuration == NULL) {
+        printf("The xml schedule configuration file does not exist\n");
+        return CONFIGURATION_NOT_FOUND;
+    }
+    return read_schedule_configuration_xml(file_configuration);
+}
+
+/**
+ Compare the utilization of two links to sort them from the most to the least utilized
+
+ @param a pointer to the identifier of the first link
+ @param b pointer to the identifier of the second link
+ @return negative if a is more utilized, positive if b is more utilized, 0 otherwise
+ */
+int compare_links_utilization(const void *a, const void *b) {
+    
+    float utilization_a = get_link_utilization(*(const int*) a);
+    float utilization_b = get_link_utilization(*(const int*) b);
+    return (utilization_a < utilization_b) - (utilization_a > utilization_b);
+}
+
+/**
+ Set the state of all the offsets depending if their link is in the backbone or not
+
+ @param is_backbone array that indicates for every link if it is in the backbone
+ @param backbone_state state of the offsets in the backbone links
+ @param edge_state state of the rest of offsets
+ */
+void set_offsets_state(int *is_backbone, OffsetState backbone_state, OffsetState edge_state) {
+    
+    Offset *offset_pt;
+    
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        offset_pt = get_offset_root(get_frame(frame_it));
+        while (!is_last_offset(offset_pt)) {
+            if (is_backbone[get_offset_link(offset_pt)] == 1) {
+                set_offset_state(offset_pt, backbone_state);
+            } else {
+                set_offset_state(offset_pt, edge_state);
+            }
+            offset_pt = get_next_offset(offset_pt);
+        }
+    }
+}
+
+/**
+ Set the state of all the offsets depending on the priority of their frame compared with the class being scheduled
+
+ @param priority priority class being scheduled
+ @param higher_state state of the offsets of the higher classes, fixed if they keep their schedule
+ */
+void set_priority_class_state(int priority, OffsetState higher_state) {
+    
+    Frame *frame_pt;
+    Offset *offset_pt;
+    OffsetState state;
+    
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        if (get_priority(frame_pt) > priority) {            // Already scheduled
+            state = higher_state;
+        } else if (get_priority(frame_pt) == priority) {    // Scheduled now
+            state = offset_free;
+        } else {                                            // Scheduled later
+            state = offset_excluded;
+        }
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            set_offset_state(offset_pt, state);
+            offset_pt = get_next_offset(offset_pt);
+        }
+    }
+}
+
+/**
+ Set the state of all the offsets for the scheduling of a group of frames routed by the benders master. Only the
+ offsets in the routed paths of the frames of the group are scheduled, the rest are excluded
+
+ @param components group of every frame
+ @param component group being scheduled
+ @param excluded_frames array that indicates for every frame if it is excluded from the group, NULL if none is
+ */
+void set_component_state(int *components, int component, int *excluded_frames) {
+    
+    Frame *frame_pt;
+    Offset *offset_pt;
+    Path *path_pt;
+    
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            set_offset_state(offset_pt, offset_excluded);
+            offset_pt = get_next_offset(offset_pt);
+        }
+        if (components[frame_it] != component || (excluded_frames != NULL && excluded_frames[frame_it] == 1)) {
+            continue;
+        }
+        for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+            path_pt = get_frame_path(frame_pt, receiver_it, 0);
+            for (int link_it = 0; link_it < path_pt->length; link_it++) {
+                set_offset_state(get_frame_offset_by_link(frame_pt, path_pt->path[link_it]), offset_free);
+            }
+        }
+    }
+}
+
+/**
+ Fix the offsets in the routed paths of all the frames, and leave the rest of offsets unused (transmission time 0) and out
+ of the schedule
+ */
+void set_routed_state(void) {
+    
+    Frame *frame_pt;
+    Offset *offset_pt;
+    Path *path_pt;
+    
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            set_offset_state(offset_pt, offset_excluded);
+            offset_pt = get_next_offset(offset_pt);
+        }
+        for (int receiver_it = 0; receiver_it < get_num_receivers(frame_pt); receiver_it++) {
+            path_pt = get_frame_path(frame_pt, receiver_it, 0);
+            for (int link_it = 0; link_it < path_pt->length; link_it++) {
+                set_offset_state(get_frame_offset_by_link(frame_pt, path_pt->path[link_it]), offset_fixed);
+            }
+        }
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            set_offset_chosen(offset_pt, get_offset_state(offset_pt) != offset_excluded);
+            if (get_offset_state(offset_pt) == offset_excluded) {
+                for (int instance = 0; instance < get_num_instances(offset_pt); instance++) {
+                    for (int replica = 0; replica < get_num_replicas(offset_pt); replica++) {
+                        set_offset(offset_pt, instance, replica, 0);
+                    }
+                }
+            }
+            offset_pt = get_next_offset(offset_pt);
+        }
+    }
+}
+
+/**
+ Prepare the network already parsed to be scheduled with the schedule configuration already read
+
+ @return 0 if done correctly, error code otherwise
+ */
+int prepare_configured_network(void) {
+    
+    int num_iterations = 0;                 // Iterations of the routing of the frames
+    int num_symmetric;                      // Frames identical to a previous one
+    
+    set_variable_names(variable_naming);
+    set_sat_macrotick(macrotick);
+    set_backend_statistics(model_statistics);
+    if (set_model_export(export_model, export_model_file) < 0) {
+        printf("Error setting the model export\n");
+        return ERROR_LOADING_NETWORK;
+    }
+    if (set_objectives(schedule_objectives, num_schedule_objectives) < 0) {
+        printf("Error setting the objectives\n");
+        return ERROR_LOADING_NETWORK;
+    }
+    // Routed frames only have one path per receiver, so there is nothing left for the solver to choose
+    if (pre_routing > 0) {
+        num_iterations = route_frames(pre_routing);
+        if (num_iterations < 0) {
+            printf("Error routing the frames\n");
+            return ERROR_LOADING_NETWORK;
+        }
+        select_path = 0;
+    }
+    initialize_network();
+    if (pre_routing > 0 && model_statistics == 1) {
+        printf("Routed all frames in %d iterations with a maximum link utilization of %.3f\n", num_iterations,
+               get_max_link_utilization());
+    }
+    if (symmetry_breaking == 1) {
+        num_symmetric = detect_symmetric_frames();
+        if (num_symmetric < 0) {
+            printf("Error detecting the identical frames\n");
+            return ERROR_LOADING_NETWORK;
+        }
+        if (model_statistics == 1) {
+            printf("Found %d frames identical to a previous one\n", num_symmetric);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ Read the schedule configuration and prepare the network already parsed to be scheduled
+
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if done correctly, error code otherwise
+ */
+int prepare_network(char *configuration_file) {
+    
+    if (read_schedule_configuration(configuration_file) < 0) {
+        printf("Error reading the configuration file\n");
+        return ERROR_LOADING_NETWORK;
+    }
+    return prepare_configured_network();
+}
+
+/**
+ Read the schedule configuration from the given xml in memory and prepare the network already parsed or built to be
+ scheduled, so no file is needed
+
+ @param configuration xml of the schedule configuration
+ @param size number of bytes of the xml
+ @return 0 if done correctly, error code otherwise
+ */
+int prepare_network_from_memory(char *configuration, int size) {
+    
+    xmlDocPtr file_configuration;
+    
+    file_configuration = xmlReadMemory(configuration, size, NULL, NULL, 0);
+    if (file_configuration == NULL || read_schedule_configuration_xml(file_configuration) < 0) {
+        printf("Error reading the configuration\n");
+        return ERROR_LOADING_NETWORK;
+    }
+    return prepare_configured_network();
+}
+
+/**
+ Read the network and the schedule configuration, and prepare the network to be scheduled
+
  @param network_file name of the file with the description of the network
- @param schedule_file name of the file with the scheduled network
- @return 0 if the schedule was found, error code otherwise
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if done correctly, error code otherwise
  */
-int one_shot_scheduling(char *network_file, char *schedule_file, char *configuration_file) {
+int load_network(char *network_file, char *configuration_file) {
     
     if (parse_network_xml(network_file) < 0) {
         printf("Error reading the network file\n");
-        return ERROR_SCHEDULING_ONE_SHOT;
+        return ERROR_LOADING_NETWORK;
     }
-    if (read_schedule_configuration(configuration_file) < 0) {
-        printf("Error reading the configuration file\n");
-        return ERROR_SCHEDULING_ONE_SHOT;
+    return prepare_network(configuration_file);
+}
+
+/**
+ Init the solver and create all the constraints for the offsets of the current stage (all of them if the network is
+ scheduled in one shot)
+
+ @return 0 if done correctly, error code otherwise
+ */
+int build_schedule_model(void) {
+    
+    clock_t construction_start;             // Clock when the constraints start to be created
+    double construction_time;               // Seconds spent creating the constraints
+    long long int constraints;              // Number of constraints created
+    long long int ordered, removed;         // Intersections simplified by the windows
+    
+    if (initialize_solver(solver) < 0) {
+        printf("Error initializing the solver\n");
+        return ERROR_BUILDING_MODEL;
     }
-    initialize_solver(solver);
-    initialize_network();
+    construction_start = clock();
     if (select_path == 1) {
-        init_path_selector(solver);
+        if (init_path_selector() < 0) {
+            printf("Error creating the path selectors\n");
+            return ERROR_BUILDING_MODEL;
+        }
     }
-    if (create_offset_variables(solver) < 0) {
+    if (schedule_mode == subset_mode) {
+        if (init_frame_scheduled(subset_weighted) < 0) {
+            printf("Error creating the frame scheduled literals\n");
+            return ERROR_BUILDING_MODEL;
+        }
+    }
+    if (create_offset_variables() < 0) {
         printf("Error creating offset variables\n");
-        return ERROR_SCHEDULING_ONE_SHOT;
+        return ERROR_BUILDING_MODEL;
     }
-    if (solver == gurobi) {
-        initialize_distances(optimization, distance_frame_weigth, distance_link_weigth);
+    // The spacing of the pareto front is the smallest link distance, so the distances cannot be fixed to 0
+    if (initialize_distances(schedule_mode == pareto_mode ? 1 : optimization, distance_frame_weigth,
+                             distance_link_weigth) < 0) {
+        printf("Error creating the distance variables\n");
+        return ERROR_BUILDING_MODEL;
     }
     if (select_path == 1) {
-        choose_path(solver);
+        if (choose_path() < 0) {
+            printf("Error choosing the paths\n");
+            return ERROR_BUILDING_MODEL;
+        }
+    }
+    // The benders master can route identical frames through different paths, so they cannot be ordered
+    if (symmetry_breaking == 1 && schedule_mode != benders_mode) {
+        if (break_symmetries() < 0) {
+            printf("Error creating symmetry breaking constraints\n");
+            return ERROR_BUILDING_MODEL;
+        }
+    }
+    if (schedule_mode == pareto_mode) {
+        if (init_spacing_variable() < 0) {
+            printf("Error creating the spacing variable\n");
+            return ERROR_BUILDING_MODEL;
+        }
     }
-    if (contention_free(solver) < 0) {
+    if (contention_free() < 0) {
         printf("Error creating contention free constraints\n");
-        return ERROR_SCHEDULING_ONE_SHOT;
+        return ERROR_BUILDING_MODEL;
     }
-    if (frame_path_dependent(solver) < 0) {
+    if (frame_path_dependent() < 0) {
         printf("Error creating path dependent constraints\n");
-        return ERROR_SCHEDULING_ONE_SHOT;
+        return ERROR_BUILDING_MODEL;
     }
-    if (frame_end_to_end_delay(solver) < 0) {
+    if (frame_end_to_end_delay() < 0) {
         printf("Error creating end to end delay constraints\n");
+        return ERROR_BUILDING_MODEL;
+    }
+    if (frame_stage_distances() < 0) {
+        printf("Error creating the distances between offsets of the stage\n");
+        return ERROR_BUILDING_MODEL;
+    }
+    if (add_objectives() < 0) {
+        printf("Error adding the objectives\n");
+        return ERROR_BUILDING_MODEL;
+    }
+    // Measure how fast the constraints are created, as it is a large part of the time on big networks
+    construction_time = (double) (clock() - construction_start) / CLOCKS_PER_SEC;
+    constraints = get_num_constraints();
+    if (model_statistics == 1) {
+        printf("Created %lld constraints in %.3f s (%.0f constraints/s)\n", constraints, construction_time,
+               construction_time > 0 ? constraints / construction_time : 0.0);
+    }
+    get_num_presolved_intersections(&ordered, &removed);
+    if (model_statistics == 1 && (ordered > 0 || removed > 0)) {
+        printf("The windows ordered %lld intersections and removed %lld\n", ordered, removed);
+    }
+    
+    return 0;
+}
+
+/**
+ Analyze the schedule found if the analysis is enabled in the schedule configuration
+
+ @return 0 if done correctly, error code otherwise
+ */
+int analyze_schedule(void) {
+    
+    if (slack_analysis == 1) {
+        if (analyze_slack() < 0) {
+            printf("Error analyzing the slack of the schedule\n");
+            return ERROR_ANALYZING_SCHEDULE;
+        }
+        print_slack_analysis();
+    }
+    
+    return 0;
+}
+
+/**
+ Explain why the loaded network has no schedule. The model is built again with every group of constraints tracked
+ and the groups in conflict are found by the solver
+
+ @return 0 if done correctly, error code otherwise
+ */
+int analyze_conflict(void) {
+    
+    int num_conflicts;
+    
+    printf("Explaining the conflict\n");
+    set_conflict_tracking(1);
+    if (build_schedule_model() < 0) {
+        set_conflict_tracking(0);
+        return ERROR_ANALYZING_CONFLICT;
+    }
+    set_conflict_tracking(0);
+    num_conflicts = explain_conflict(timelimit);
+    release_solver();
+    if (num_conflicts < 0) {
+        printf("Error explaining the conflict\n");
+        return ERROR_ANALYZING_CONFLICT;
+    }
+    
+    return 0;
+}
+
+/**
+ Schedule the loaded network solving all constraints in one call to the solver
+
+ @return 0 if the schedule was found, error code otherwise
+ */
+int solve_one_shot(void) {
+    
+    int found;
+    
+    if (build_schedule_model() < 0) {
         return ERROR_SCHEDULING_ONE_SHOT;
     }
-    if (check_solver(solver, timelimit, tune, tunetimelimit) < 0) {
+    found = check_solver(timelimit, tune, tunetimelimit);
+    if (found == SCHEDULE_NOT_FOUND && conflict_analysis == 1) {
+        analyze_conflict();
+    }
+    if (found < 0) {
         printf("Error finding the schedule\n");
         return ERROR_SCHEDULING_ONE_SHOT;
     }
-    // If successful, extract the scheduler and save into the network
-    // Write in a xml file the network schedule
+    if (found == 1) {
+        analyze_schedule();
+    }
+    
+    return 0;
+}
+
+/**
+ Schedule the loaded network in two stages. The first stage only schedules the offsets in the most utilized links (the
+ backbone), where the contention concentrates. The second one fixes them and schedules the remaining offsets inside
+ the windows left by the fixed ones along their paths. The first stage does not see the links outside the backbone, so
+ it can leave no room for them, in that case all the links are scheduled again at once
+
+ @return 0 if the schedule was found, error code otherwise
+ */
+int solve_hierarchical(void) {
+    
+    int *sorted_links;                      // Links sorted by utilization
+    int *is_backbone;                       // 1 if the link is in the backbone, 0 otherwise
+    int num_backbone;                       // Number of links in the backbone
+    
+    // The windows are propagated along all paths of a frame, so the paths cannot be chosen
+    if (select_path == 1) {
+        printf("The hierarchical scheduling does not support path selection\n");
+        return ERROR_SCHEDULING_HIERARCHICAL;
+    }
+    if (tune == 1) {
+        printf("The hierarchical scheduling does not support tuning\n");
+        return ERROR_SCHEDULING_HIERARCHICAL;
+    }
+    
+    // Select the most utilized links as backbone, by default a quarter of the links
+    num_backbone = backbone_links > 0 ? backbone_links : (get_num_links() + 3) / 4;
+    if (num_backbone > get_num_links()) {
+        num_backbone = get_num_links();
+    }
+    sorted_links = malloc(sizeof(int) * get_num_links());
+    is_backbone = malloc(sizeof(int) * get_num_links());
+    for (int link_it = 0; link_it < get_num_links(); link_it++) {
+        sorted_links[link_it] = link_it;
+        is_backbone[link_it] = 0;
+    }
+    qsort(sorted_links, get_num_links(), sizeof(int), compare_links_utilization);
+    for (int link_it = 0; link_it < num_backbone; link_it++) {
+        is_backbone[sorted_links[link_it]] = 1;
+    }
+    free(sorted_links);
+    
+    // First stage, only the backbone links
+    printf("Scheduling the %d most utilized links\n", num_backbone);
+    set_offsets_state(is_backbone, offset_free, offset_excluded);
+    if (propagate_offset_windows() < 0 || build_schedule_model() < 0 ||
+        check_solver(timelimit, tune, tunetimelimit) < 0) {
+        printf("Error scheduling the backbone links\n");
+        free(is_backbone);
+        return ERROR_SCHEDULING_HIERARCHICAL;
+    }
+    
+    // Second stage, the rest of links with the backbone fixed
+    printf("Scheduling the rest of links\n");
+    set_offsets_state(is_backbone, offset_fixed, offset_free);
+    if (propagate_offset_windows() < 0 || build_schedule_model() < 0) {
+        printf("Error scheduling the links outside the backbone\n");
+        free(is_backbone);
+        return ERROR_SCHEDULING_HIERARCHICAL;
+    }
+    if (check_solver(timelimit, tune, tunetimelimit) < 0) {
+        // The backbone is scheduled again with the rest of links, as in the one shot scheduling
+        printf("The backbone leaves no room for the rest of links, scheduling all links at once\n");
+        set_offsets_state(is_backbone, offset_free, offset_free);
+        if (propagate_offset_windows() < 0 || build_schedule_model() < 0 ||
+            check_solver(timelimit, tune, tunetimelimit) < 0) {
+            printf("Error scheduling all the links\n");
+            free(is_backbone);
+            return ERROR_SCHEDULING_HIERARCHICAL;
+        }
+    }
+    
+    // All the offsets have now a fixed transmission time
+    set_offsets_state(is_backbone, offset_fixed, offset_fixed);
+    free(is_backbone);
+    analyze_schedule();
+    return 0;
+}
+
+/**
+ Reject the frames of the given priority class and the lower ones, so they are left out of the schedule with all their
+ offsets at 0
+
+ @param priority highest priority class rejected
+ */
+void reject_priority_classes(int priority) {
+    
+    Frame *frame_pt;
+    Offset *offset_pt;
+    
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        frame_pt = get_frame(frame_it);
+        if (get_priority(frame_pt) > priority) {
+            continue;
+        }
+        set_rejected(frame_pt, 1);
+        offset_pt = get_offset_root(frame_pt);
+        while (!is_last_offset(offset_pt)) {
+            for (int instance = 0; instance < get_num_instances(offset_pt); instance++) {
+                for (int replica = 0; replica < get_num_replicas(offset_pt); replica++) {
+                    set_offset(offset_pt, instance, replica, 0);
+                }
+            }
+            offset_pt = get_next_offset(offset_pt);
+        }
+    }
+}
+
+/**
+ Schedule the loaded network one priority class at a time, from the highest priority to the lowest. Every class is
+ scheduled with the offsets of the higher classes fixed and without the lower classes. If a class cannot be scheduled,
+ it is tried again with the higher classes scheduled with it, as their fixed offsets may be what leaves no room. If it
+ still cannot be scheduled, the schedule of the higher classes is written with the frames of that class and the lower
+ ones rejected
+
+ @param schedule_file name of the file with the scheduled network
+ @return 0 if all classes were scheduled, error code otherwise
+ */
+int solve_priority(char *schedule_file) {
+    
+    int priority = INT_MAX;                 // Priority class being scheduled
+    int next_priority;                      // Next lower priority class
+    int num_frames_class;                   // Number of frames in the class
+    int num_classes = 0;                    // Number of classes already scheduled
+    int found;                              // Result of the solver for the class
+    
+    // The windows are propagated along all paths of a frame, so the paths cannot be chosen
+    if (select_path == 1) {
+        printf("The priority scheduling does not support path selection\n");
+        return ERROR_SCHEDULING_PRIORITY;
+    }
+    if (tune == 1) {
+        printf("The priority scheduling does not support tuning\n");
+        return ERROR_SCHEDULING_PRIORITY;
+    }
+    
+    while (1) {
+        // Search the next class with lower priority than the last one scheduled
+        next_priority = -1;
+        for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+            if (get_priority(get_frame(frame_it)) < priority && get_priority(get_frame(frame_it)) > next_priority) {
+                next_priority = get_priority(get_frame(frame_it));
+            }
+        }
+        if (next_priority == -1) {          // All classes are scheduled
+            break;
+        }
+        priority = next_priority;
+        num_frames_class = 0;
+        for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+            if (get_priority(get_frame(frame_it)) == priority) {
+                num_frames_class++;
+            }
+        }
+        
+        printf("Scheduling the priority class %d with %d frames\n", priority, num_frames_class);
+        set_priority_class_state(priority, offset_fixed);
+        if (propagate_offset_windows() < 0 || build_schedule_model() < 0) {
+            printf("Error scheduling the priority class %d\n", priority);
+            return ERROR_SCHEDULING_PRIORITY;
+        }
+        found = check_solver(timelimit, tune, tunetimelimit);
+        if (found < 0 && num_classes > 0) {
+            printf("Scheduling the priority class %d again with the higher classes\n", priority);
+            set_priority_class_state(priority, offset_free);
+            if (propagate_offset_windows() < 0 || build_schedule_model() < 0) {
+                printf("Error scheduling the priority class %d\n", priority);
+                return ERROR_SCHEDULING_PRIORITY;
+            }
+            found = check_solver(timelimit, tune, tunetimelimit);
+        }
+        if (found < 0) {
+            // The higher classes keep their schedule, they do not depend on the lower ones
+            printf("Error scheduling the priority class %d\n", priority);
+            if (num_classes > 0) {
+                reject_priority_classes(priority);
+                set_priority_class_state(-1, offset_fixed);
+                printf("Rejected the frames of the priority class %d and lower\n", priority);
+                if (write_schedule_xml(schedule_file) < 0) {
+                    printf("Error writing the schedule\n");
+                }
+            }
+            return ERROR_SCHEDULING_PRIORITY;
+        }
+        num_classes++;
+    }
+    
+    // All the offsets have now a fixed transmission time
+    set_priority_class_state(-1, offset_fixed);
+    analyze_schedule();
+    return 0;
+}
+
+/**
+ Get the name of the schedule file of a point of the pareto front, adding the number of the point before the extension
+
+ @param schedule_file name of the file with the scheduled network
+ @param point number of the point
+ @param name string where the name is written (at least 1000 characters)
+ */
+void get_pareto_filename(char *schedule_file, int point, char *name) {
+    
+    char *extension = strrchr(schedule_file, '.');
+    
+    // The dot has to be in the name of the file, not in a directory
+    if (extension == NULL || strchr(extension, '/') != NULL) {
+        snprintf(name, 1000, "%s_%d", schedule_file, point);
+    } else {
+        snprintf(name, 1000, "%.*s_%d%s", (int) (extension - schedule_file), schedule_file, point, extension);
+    }
+}
+
+/**
+ Find the pareto front between the latency and the spacing in the loaded network with the epsilon-constraint method.
+ Every point has a larger spacing than the previous one, so the latency can only get worse. If a point has the same
+ latency as the previous ones (the solver did not reach the optimal spacing), they are dominated and are replaced.
+ The minimum spacing of the next point spreads the points left evenly up to the largest spacing possible, and when no
+ point reaches it, the next point is searched halfway. The solver is called at most twice per point, and the search
+ stops once the time limit stops the solver, as the next points are harder to find
+
+ @param schedule_file name of the file with the scheduled network
+ @return 0 if at least one point was found, error code otherwise
+ */
+int solve_pareto(char *schedule_file) {
+    
+    ObjectiveType latency_objective = latency_sum_objective;
+    long long int *latencies;               // Latency of every point of the front
+    long long int *spacings;                // Spacing of every point of the front
+    long long int min_spacing = 0;          // Minimum spacing of the next point
+    long long int max_spacing;              // Largest spacing that a point can have
+    long long int last_spacing;             // Spacing of the last point found
+    long long int step;                     // Spacing between the next points
+    int num_points = 0;                     // Number of non-dominated points found
+    int num_files = 0;                      // Number of schedule files written
+    int num_solves = 0;                     // Number of calls to the solver
+    int found = 1;
+    char filename[1000];
+    
+    if (tune == 1) {
+        printf("The pareto scheduling does not support tuning\n");
+        return ERROR_SCHEDULING_PARETO;
+    }
+    
+    // The first latency objective of the configuration is the one traded against the spacing
+    for (int objective_it = num_schedule_objectives - 1; objective_it >= 0; objective_it--) {
+        if (schedule_objectives[objective_it] != distance_objective) {
+            latency_objective = schedule_objectives[objective_it];
+        }
+    }
+    // The objectives of every point are set by the pareto front, the configured ones are restored once it is built
+    set_objectives(NULL, 0);
+    if (build_schedule_model() < 0 || init_pareto_front(latency_objective) < 0) {
+        set_objectives(schedule_objectives, num_schedule_objectives);
+        return ERROR_SCHEDULING_PARETO;
+    }
+    set_objectives(schedule_objectives, num_schedule_objectives);
+    // Without path selection all the offsets are transmitted, so their links bound the spacing
+    max_spacing = select_path == 1 ? get_hyper_period() : get_max_link_spacing();
+    
+    latencies = malloc(sizeof(long long int) * pareto_points);
+    spacings = malloc(sizeof(long long int) * pareto_points);
+    while (num_points < pareto_points && num_solves < 2 * pareto_points) {
+        found = check_pareto_point(timelimit, min_spacing, &latencies[num_points], &spacings[num_points]);
+        num_solves++;
+        if (found == 0 && num_points > 0) {
+            // No point reaches the spacing, so the next one is searched halfway from the last point
+            last_spacing = spacings[num_points - 1];
+            max_spacing = min_spacing - 1;
+            min_spacing = last_spacing + (max_spacing - last_spacing + 1) / 2;
+            if (min_spacing <= last_spacing) {
+                break;
+            }
+            continue;
+        }
+        if (found == BACKEND_TIME_LIMIT && num_points > 0) {
+            printf("The time limit stopped the solver before finding the next point\n");
+            found = 0;
+            break;
+        }
+        if (found != 1 && found != SOLUTION_NOT_PROVEN) {
+            break;
+        }
+        // Remove the previous points that are dominated by the new one
+        while (num_points > 0 && latencies[num_points - 1] >= latencies[num_points]) {
+            latencies[num_points - 1] = latencies[num_points];
+            spacings[num_points - 1] = spacings[num_points];
+            num_points--;
+        }
+        printf("Pareto point %d: latency %lld ns, spacing %lld ns\n", num_points, latencies[num_points],
+               spacings[num_points]);
+        get_pareto_filename(schedule_file, num_points, filename);
+        if (write_schedule_xml(filename) < 0) {
+            found = ERROR_SCHEDULING_PARETO;
+            break;
+        }
+        last_spacing = spacings[num_points];
+        num_points++;
+        if (num_points > num_files) {
+            num_files = num_points;
+        }
+        if (found == SOLUTION_NOT_PROVEN) {
+            printf("The time limit stopped the solver before proving the point, the next points are not searched\n");
+            break;
+        }
+        if (num_points == pareto_points || last_spacing >= max_spacing) {
+            break;
+        }
+        // The points left are spread evenly between the last point and the largest spacing
+        step = (max_spacing - last_spacing) / (pareto_points - num_points);
+        min_spacing = last_spacing + (step > 1 ? step : 1);
+    }
+    release_solver();
+    free(latencies);
+    free(spacings);
+    
+    // Remove the files of the dominated points that were not overwritten
+    for (int file_it = num_points; file_it < num_files; file_it++) {
+        get_pareto_filename(schedule_file, file_it, filename);
+        remove(filename);
+    }
+    if (found < 0 || num_points == 0) {
+        printf("Error finding the pareto front\n");
+        return ERROR_SCHEDULING_PARETO;
+    }
+    printf("Found %d points of the pareto front in %d calls to the solver\n", num_points, num_solves);
+    return 0;
+}
+
+/**
+ Write all the given bytes in a pipe, even if the pipe only accepts part of them at once
+
+ @param pipe_fd file descriptor of the writing end of the pipe
+ @param data pointer to the bytes to write
+ @param size number of bytes
+ @return 0 if done correctly, -1 otherwise
+ */
+int write_pipe(int pipe_fd, void *data, size_t size) {
+    
+    ssize_t written;
+    
+    while (size > 0) {
+        written = write(pipe_fd, data, size);
+        if (written <= 0) {
+            return -1;
+        }
+        data = (char*) data + written;
+        size -= written;
+    }
+    return 0;
+}
+
+/**
+ Read the given number of bytes from a pipe, waiting until all of them are written
+
+ @param pipe_fd file descriptor of the reading end of the pipe
+ @param data pointer where the bytes are saved
+ @param size number of bytes
+ @return 0 if done correctly, -1 if the pipe was closed before
+ */
+int read_pipe(int pipe_fd, void *data, size_t size) {
+    
+    ssize_t received;
+    
+    while (size > 0) {
+        received = read(pipe_fd, data, size);
+        if (received <= 0) {
+            return -1;
+        }
+        data = (char*) data + received;
+        size -= received;
+    }
+    return 0;
+}
+
+/**
+ Schedule the frames of a group of the benders decomposition in their routed paths
+
+ @param components group of every frame
+ @param component group being scheduled
+ @param excluded_frames array that indicates for every frame if it is excluded from the group, NULL if none is
+ @return 1 if the group was scheduled, 0 if not, error code otherwise
+ */
+int schedule_component(int *components, int component, int *excluded_frames) {
+    
+    set_component_state(components, component, excluded_frames);
+    // The routed paths do not fit in the windows of the frames, it is the same as not finding the schedule
+    if (propagate_offset_windows() < 0) {
+        return 0;
+    }
+    if (build_schedule_model() < 0) {
+        return ERROR_SCHEDULING_BENDERS;
+    }
+    return check_solver(timelimit, 0, 0) == 1;
+}
+
+/**
+ Schedule a group of frames of the benders decomposition in a child process and send the result to the parent.
+ If the group was scheduled, it sends the transmission times of its offsets. If not, it searches a minimal set of
+ frames that cannot be scheduled together removing one frame at a time, and sends their identifiers. If no frame can
+ be removed (for example, every smaller group runs out of time), the whole group is sent as the conflict
+
+ @param components group of every frame
+ @param component group being scheduled
+ @param pipe_fd file descriptor of the writing end of the pipe to the parent
+ @return 0 if the result was sent, error code otherwise
+ */
+int solve_component_process(int *components, int component, int pipe_fd) {
+    
+    Frame *frame_pt;
+    Offset *offset_pt;
+    int *excluded_frames;                   // 1 if the frame is not needed for the conflict, 0 otherwise
+    int found, num_conflict_frames = 0;
+    long long int time;
+    
+    found = schedule_component(components, component, NULL);
+    if (write_pipe(pipe_fd, &found, sizeof(int)) < 0) {
+        return ERROR_SCHEDULING_BENDERS;
+    }
+    if (found == 1) {
+        for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+            if (components[frame_it] != component) {
+                continue;
+            }
+            frame_pt = get_frame(frame_it);
+            offset_pt = get_offset_root(frame_pt);
+            while (!is_last_offset(offset_pt)) {
+                if (get_offset_state(offset_pt) == offset_free) {
+                    for (int instance = 0; instance < get_num_instances(offset_pt); instance++) {
+                        for (int replica = 0; replica < get_num_replicas(offset_pt); replica++) {
+                            time = get_offset(offset_pt, instance, replica);
+                            if (write_pipe(pipe_fd, &time, sizeof(long long int)) < 0) {
+                                return ERROR_SCHEDULING_BENDERS;
+                            }
+                        }
+                    }
+                }
+                offset_pt = get_next_offset(offset_pt);
+            }
+        }
+    } else if (found == 0) {
+        // A frame is only kept in the conflict if the rest of frames can be scheduled without it
+        excluded_frames = calloc(get_num_frames(), sizeof(int));
+        for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+            if (components[frame_it] == component) {
+                excluded_frames[frame_it] = 1;
+                if (schedule_component(components, component, excluded_frames) == 1) {
+                    excluded_frames[frame_it] = 0;
+                    num_conflict_frames++;
+                }
+            }
+        }
+        // Without any frame proved necessary, the only known conflict is the whole group
+        if (num_conflict_frames == 0) {
+            for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+                if (components[frame_it] == component) {
+                    excluded_frames[frame_it] = 0;
+                    num_conflict_frames++;
+                }
+            }
+        }
+        if (write_pipe(pipe_fd, &num_conflict_frames, sizeof(int)) < 0) {
+            free(excluded_frames);
+            return ERROR_SCHEDULING_BENDERS;
+        }
+        for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+            if (components[frame_it] == component && excluded_frames[frame_it] == 0) {
+                if (write_pipe(pipe_fd, &frame_it, sizeof(int)) < 0) {
+                    free(excluded_frames);
+                    return ERROR_SCHEDULING_BENDERS;
+                }
+            }
+        }
+        free(excluded_frames);
+    }
+    return 0;
+}
+
+/**
+ Receive the result of a group of frames of the benders decomposition from its child process. The transmission times
+ of a scheduled group are saved in the offsets, and the frames in conflict of a group that could not be scheduled are
+ cut from the master
+
+ @param components group of every frame
+ @param component group being received
+ @param pipe_fd file descriptor of the reading end of the pipe from the child
+ @return 1 if the group was scheduled, 0 if not, error code otherwise
+ */
+int receive_component_result(int *components, int component, int pipe_fd) {
+    
+    Frame *frame_pt;
+    Offset *offset_pt;
+    int *conflict_frames;
+    int found, num_conflict_frames;
+    long long int time;
+    
+    if (read_pipe(pipe_fd, &found, sizeof(int)) < 0 || found < 0) {
+        return ERROR_SCHEDULING_BENDERS;
+    }
+    if (found == 1) {
+        // The states of the child are set again to know which offsets it sent
+        set_component_state(components, component, NULL);
+        for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+            if (components[frame_it] != component) {
+                continue;
+            }
+            frame_pt = get_frame(frame_it);
+            offset_pt = get_offset_root(frame_pt);
+            while (!is_last_offset(offset_pt)) {
+                if (get_offset_state(offset_pt) == offset_free) {
+                    for (int instance = 0; instance < get_num_instances(offset_pt); instance++) {
+                        for (int replica = 0; replica < get_num_replicas(offset_pt); replica++) {
+                            if (read_pipe(pipe_fd, &time, sizeof(long long int)) < 0) {
+                                return ERROR_SCHEDULING_BENDERS;
+                            }
+                            set_offset(offset_pt, instance, replica, time);
+                        }
+                    }
+                }
+                offset_pt = get_next_offset(offset_pt);
+            }
+        }
+        return 1;
+    }
+    
+    if (read_pipe(pipe_fd, &num_conflict_frames, sizeof(int)) < 0) {
+        return ERROR_SCHEDULING_BENDERS;
+    }
+    conflict_frames = malloc(sizeof(int) * (num_conflict_frames + 1));
+    for (int conflict_it = 0; conflict_it < num_conflict_frames; conflict_it++) {
+        if (read_pipe(pipe_fd, &conflict_frames[conflict_it], sizeof(int)) < 0) {
+            free(conflict_frames);
+            return ERROR_SCHEDULING_BENDERS;
+        }
+    }
+    printf("The group %d cannot be scheduled, %d frames in conflict\n", component, num_conflict_frames);
+    if (add_routing_cut(conflict_frames, num_conflict_frames) < 0) {
+        free(conflict_frames);
+        return ERROR_SCHEDULING_BENDERS;
+    }
+    free(conflict_frames);
+    return 0;
+}
+
+/**
+ Schedule all the groups of frames of the current routing, every group in its own process as the solver state is
+ global. At most the given number of workers run at the same time
+
+ @param components group of every frame
+ @param num_components number of groups
+ @return number of groups that could not be scheduled, error code otherwise
+ */
+int solve_components(int *components, int num_components) {
+    
+    int *pipes;                             // Reading and writing ends of the pipe of every worker
+    pid_t *workers;                         // Process of every worker
+    int num_workers, result;
+    int num_infeasible = 0;
+    
+    num_workers = benders_workers > 0 ? benders_workers : (int) sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_workers < 1) {
+        num_workers = 1;
+    }
+    pipes = malloc(sizeof(int) * 2 * num_workers);
+    workers = malloc(sizeof(pid_t) * num_workers);
+    
+    for (int first = 0; first < num_components; first += num_workers) {
+        // The children inherit the buffer of the standard output, it has to be empty before forking
+        fflush(stdout);
+        for (int worker_it = 0; worker_it < num_workers && first + worker_it < num_components; worker_it++) {
+            if (pipe(&pipes[2 * worker_it]) < 0) {
+                workers[worker_it] = -1;
+                continue;
+            }
+            workers[worker_it] = fork();
+            if (workers[worker_it] == 0) {
+                close(pipes[2 * worker_it]);
+                result = solve_component_process(components, first + worker_it, pipes[2 * worker_it + 1]);
+                close(pipes[2 * worker_it + 1]);
+                fflush(stdout);
+                _exit(result < 0);
+            }
+            close(pipes[2 * worker_it + 1]);
+            if (workers[worker_it] < 0) {
+                close(pipes[2 * worker_it]);
+            }
+        }
+        for (int worker_it = 0; worker_it < num_workers && first + worker_it < num_components; worker_it++) {
+            if (workers[worker_it] < 0) {
+                printf("Error creating the process of the group %d\n", first + worker_it);
+                num_infeasible = ERROR_SCHEDULING_BENDERS;
+                continue;
+            }
+            result = receive_component_result(components, first + worker_it, pipes[2 * worker_it]);
+            close(pipes[2 * worker_it]);
+            waitpid(workers[worker_it], NULL, 0);
+            if (result < 0) {
+                printf("Error receiving the schedule of the group %d\n", first + worker_it);
+                num_infeasible = ERROR_SCHEDULING_BENDERS;
+            } else if (result == 0 && num_infeasible >= 0) {
+                num_infeasible++;
+            }
+        }
+    }
+    
+    free(pipes);
+    free(workers);
+    return num_infeasible;
+}
+
+/**
+ Route and schedule the loaded network with a logic-based benders decomposition. The master chooses the paths, the
+ groups of frames that share links are scheduled independently, and the routing of the frames in conflict of every
+ group that cannot be scheduled is cut from the master
+
+ @return 0 if the schedule was found, error code otherwise
+ */
+int solve_benders(void) {
+    
+    int *components;                        // Group of every frame in the current routing
+    int num_components, num_infeasible;
+    int found = 0;
+    
+    // The master chooses the paths, every offset of every path has to exist
+    if (select_path == 1 || pre_routing > 0) {
+        printf("The benders scheduling routes the frames itself, it does not support path selection or pre-routing\n");
+        return ERROR_SCHEDULING_BENDERS;
+    }
+    if (tune == 1) {
+        printf("The benders scheduling does not support tuning\n");
+        return ERROR_SCHEDULING_BENDERS;
+    }
+    if (init_routing_master() < 0) {
+        printf("Error creating the routing master problem\n");
+        free_routing_master();
+        return ERROR_SCHEDULING_BENDERS;
+    }
+    
+    components = malloc(sizeof(int) * get_num_frames());
+    for (int iteration = 0; iteration < benders_iterations && found == 0; iteration++) {
+        if (solve_routing_master() != 1) {
+            printf("There is no routing left within the capacity of the links\n");
+            break;
+        }
+        num_components = get_routing_components(components);
+        printf("Benders iteration %d: scheduling %d groups of frames\n", iteration, num_components);
+        num_infeasible = solve_components(components, num_components);
+        if (num_infeasible < 0) {
+            break;
+        }
+        found = num_infeasible == 0;
+    }
+    free_routing_master();
+    free(components);
+    
+    if (found == 0) {
+        printf("Error finding a routing that can be scheduled\n");
+        return ERROR_SCHEDULING_BENDERS;
+    }
+    // All the offsets of the routed paths have now a fixed transmission time
+    set_routed_state();
+    analyze_schedule();
+    return 0;
+}
+
+/**
+ Schedule the largest subset of frames of the loaded network that can be scheduled together in one call to the solver,
+ the frames left out are marked as rejected
+
+ @return 0 if the schedule was found, error code otherwise
+ */
+int solve_subset(void) {
+    
+    int num_rejected = 0;
+    
+    if (tune == 1) {
+        printf("The subset scheduling does not support tuning\n");
+        return ERROR_SCHEDULING_SUBSET;
+    }
+    if (build_schedule_model() < 0) {
+        return ERROR_SCHEDULING_SUBSET;
+    }
+    // Rejecting all the frames is always a schedule, so it is only not found if the solver fails or runs out of time
+    if (check_solver(timelimit, 0, 0) != 1) {
+        printf("Error finding the schedule of a subset of frames\n");
+        return ERROR_SCHEDULING_SUBSET;
+    }
+    
+    for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+        if (get_rejected(get_frame(frame_it)) == 1) {
+            num_rejected++;
+        }
+    }
+    printf("Scheduled %d of %d frames\n", get_num_frames() - num_rejected, get_num_frames());
+    if (num_rejected > 0) {
+        printf("Rejected frames:");
+        for (int frame_it = 0; frame_it < get_num_frames(); frame_it++) {
+            if (get_rejected(get_frame(frame_it)) == 1) {
+                printf(" %d", frame_it);
+            }
+        }
+        printf("\n");
+    }
+    analyze_schedule();
+    
+    return 0;
+}
+
+/**
+ Produces the schedule solving all constraints in one call to the Solver for a given network.
+ It inits the solver and the network.
+ It starts creating all the constraints (one variable for each transmission offset), then adds constraints relating
+ different offsets. At the end solves the logical context and the model obtained is the solver.
+ It creates an xml file with the output schedule.
+ It also creates different constraint files for every switch in the network containing specific constraints for each
+ switch
+ 
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if the schedule was found, error code otherwise
+ */
+int one_shot_scheduling(char *network_file, char *schedule_file, char *configuration_file) {
+    
+    if (load_network(network_file, configuration_file) < 0) {
+        return ERROR_SCHEDULING_ONE_SHOT;
+    }
+    set_schedule_mode(one_shot_mode);
+    return solve_network(schedule_file);
+}
+
+/**
+ Produces the schedule in two stages, first the offsets in the most utilized links and then the rest of them with the
+ first ones fixed. Both models are much smaller than the model scheduled in one shot, but the split is not exact:
+ the offsets fixed in the first stage can leave the second one without a schedule even if the network has one
+ 
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if the schedule was found, error code otherwise
+ */
+int hierarchical_scheduling(char *network_file, char *schedule_file, char *configuration_file) {
+    
+    if (load_network(network_file, configuration_file) < 0) {
+        return ERROR_SCHEDULING_HIERARCHICAL;
+    }
+    set_schedule_mode(hierarchical_mode);
+    return solve_network(schedule_file);
+}
+
+/**
+ Produces the schedule one priority class at a time, from the most critical to the least. Every class is scheduled
+ with the offsets of the more critical classes fixed, so the critical classes get their schedule even if a less
+ critical one cannot be scheduled. A class that cannot be scheduled is tried again with the more critical classes
+ scheduled with it, and if it still fails, the schedule of the critical classes is written with the frames of the rest
+ of classes rejected
+ 
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if all classes were scheduled, error code otherwise
+ */
+int priority_scheduling(char *network_file, char *schedule_file, char *configuration_file) {
+    
+    if (load_network(network_file, configuration_file) < 0) {
+        return ERROR_SCHEDULING_PRIORITY;
+    }
+    set_schedule_mode(priority_mode);
+    return solve_network(schedule_file);
+}
+
+/**
+ Produces the pareto front between the latency and the spacing of the transmissions in the same link.
+ The model is built once and every point is found in the same solver with a minimum spacing larger than the spacing of
+ the previous point, spread up to the largest spacing possible, until the maximum number of points is found, the
+ solver is called twice per point or the time limit stops it.
+ Every non-dominated schedule is written in the schedule file with the number of the point before the extension
+ 
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if at least one point was found, error code otherwise
+ */
+int pareto_scheduling(char *network_file, char *schedule_file, char *configuration_file) {
+    
+    if (load_network(network_file, configuration_file) < 0) {
+        return ERROR_SCHEDULING_PARETO;
+    }
+    set_schedule_mode(pareto_mode);
+    return solve_network(schedule_file);
+}
+
+/**
+ Produces the schedule routing the frames with a logic-based Benders decomposition. A master problem chooses one path
+ for every receiver of every frame without exceeding the capacity of the links, and the groups of frames that share
+ links are scheduled in parallel processes. When a group cannot be scheduled, a minimal set of its frames in conflict
+ is cut from the master and the frames are routed again, until every group is scheduled
+ 
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if the schedule was found, error code otherwise
+ */
+int benders_scheduling(char *network_file, char *schedule_file, char *configuration_file) {
+    
+    if (load_network(network_file, configuration_file) < 0) {
+        return ERROR_SCHEDULING_BENDERS;
+    }
+    set_schedule_mode(benders_mode);
+    return solve_network(schedule_file);
+}
+
+/**
+ Produces the schedule of the largest subset of frames that can be scheduled together when the network is overloaded.
+ Every frame has a literal that is true if it is scheduled, all its constraints only hold if it is scheduled, and the
+ solver maximizes the number of scheduled frames, or the sum of their priority classes plus one if the weights are the
+ priorities (SubsetWeights). The schedule file has the transmission times of the scheduled frames and the rejected ones
+ 
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if the schedule was found, error code otherwise
+ */
+int subset_scheduling(char *network_file, char *schedule_file, char *configuration_file) {
+    
+    if (load_network(network_file, configuration_file) < 0) {
+        return ERROR_SCHEDULING_SUBSET;
+    }
+    set_schedule_mode(subset_mode);
+    return solve_network(schedule_file);
+}
+
+/**
+ Check that the network already prepared can be scheduled before solving it. No link can be used over its capacity
+ and, if the paths are not chosen by the solver, every offset needs a window where it can be transmitted. The windows
+ of the offsets are narrowed by the check
+
+ @return 0 if the network is valid, error code otherwise
+ */
+int validate_network(void) {
+    
+    for (int link_it = 0; link_it < get_num_links(); link_it++) {
+        if (get_link_utilization(link_it) > 1.0) {
+            printf("The link %d is used over its capacity\n", link_it);
+            return NETWORK_NOT_VALID;
+        }
+    }
+    if (select_path == 0 && propagate_offset_windows() < 0) {
+        printf("The offsets cannot be transmitted inside their windows\n");
+        return NETWORK_NOT_VALID;
+    }
+    
+    return 0;
+}
+
+/**
+ Set if the next schedule configurations come from a client that is not trusted, as the ones sent to the daemon. A
+ restricted configuration can only use the built in solvers and cannot export the model
+
+ @param restricted 1 to restrict the configurations, 0 otherwise
+ */
+void set_restricted_configuration(int restricted) {
+    
+    restricted_configuration = restricted;
+}
+
+/**
+ Set the mode to schedule the network, overwriting the one given in the schedule configuration
+
+ @param mode mode to schedule the network
+ */
+void set_schedule_mode(ScheduleMode mode) {
+    
+    schedule_mode = mode;
+}
+
+/**
+ Get the mode to schedule the network, the one given in the schedule configuration unless it was overwritten
+
+ @return mode to schedule the network
+ */
+ScheduleMode get_schedule_mode(void) {
+    
+    return schedule_mode;
+}
+
+/**
+ Schedule the network already prepared with the mode given in the schedule configuration and write its schedule once.
+ The pareto front writes a file for every point instead, with the number of the point before the extension, and the
+ priority scheduling writes the higher classes with the rest rejected even if a class cannot be scheduled
+
+ @param schedule_file name of the file with the scheduled network
+ @return 0 if the schedule was found and written, error code otherwise
+ */
+int solve_network(char *schedule_file) {
     
+    int result;
+    
+    switch (schedule_mode) {
+        case one_shot_mode:
+            result = solve_one_shot();
+            break;
+        case hierarchical_mode:
+            result = solve_hierarchical();
+            break;
+        case priority_mode:
+            result = solve_priority(schedule_file);
+            break;
+        case pareto_mode:
+            return solve_pareto(schedule_file);
+        case benders_mode:
+            result = solve_benders();
+            break;
+        case subset_mode:
+            result = solve_subset();
+            break;
+        default:
+            return MODE_NOT_FOUND;
+    }
+    // Tuning only looks for parameters of the solver, there is no schedule to write
+    if (result < 0 || tune == 1) {
+        return result;
+    }
+    if (write_schedule_xml(schedule_file) < 0) {
+        printf("Error writing the schedule\n");
+        return ERROR_WRITING_SCHEDULE;
+    }
     return 0;
 }
 
+/**
+ Produces the schedule of the given network with the mode given in the schedule configuration
+ 
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if the schedule was found, error code otherwise
+ */
+int schedule_network(char *network_file, char *schedule_file, char *configuration_file) {
+    
+    if (load_network(network_file, configuration_file) < 0) {
+        return ERROR_LOADING_NETWORK;
+    }
+    return solve_network(schedule_file);
+}
+
 
@@ -17,8 +17,13 @@
 #define Scheduler_h
 
 #include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
 //#include "Network.h"
 #include "Optimizator.h"
+#include "Analysis.h"
+#include "Decomposition.h"
 
 #endif /* Scheduler_h */
 
@@ -34,6 +39,55 @@
 #define TUNE_NOT_FOUND -108
 #define TUNE_LIMIT_TIME_NOT_FOUND -109
 #define SOLVER_NOT_FOUND -110
+#define EXPORT_FORMAT_NOT_FOUND -111
+#define MODE_NOT_FOUND -112
+#define ERROR_SCHEDULING_HIERARCHICAL -113
+#define ERROR_LOADING_NETWORK -114
+#define ERROR_BUILDING_MODEL -115
+#define ERROR_SCHEDULING_PRIORITY -116
+#define ERROR_ANALYZING_SCHEDULE -117
+#define OBJECTIVE_NOT_FOUND -118
+#define ERROR_SCHEDULING_PARETO -119
+#define ERROR_SCHEDULING_BENDERS -120
+#define ERROR_SCHEDULING_SUBSET -121
+#define SUBSET_WEIGHTS_NOT_FOUND -122
+#define ERROR_ANALYZING_CONFLICT -123
+#define NETWORK_NOT_VALID -124
+#define ERROR_WRITING_SCHEDULE -125
+
+/* STRUCT DEFINITIONS */
+
+/**
+ Modes to schedule the network
+ */
+typedef enum ScheduleMode {
+    one_shot_mode,
+    hierarchical_mode,
+    priority_mode,
+    pareto_mode,
+    benders_mode,
+    subset_mode
+}ScheduleMode;
+
+/**
+ Write all the given bytes in a pipe, even if the pipe only accepts part of them at once
+
+ @param pipe_fd file descriptor of the writing end of the pipe
+ @param data pointer to the bytes to write
+ @param size number of bytes
+ @return 0 if done correctly, -1 otherwise
+ */
+int write_pipe(int pipe_fd, void *data, size_t size);
+
+/**
+ Read the given number of bytes from a pipe, waiting until all of them are written
+
+ @param pipe_fd file descriptor of the reading end of the pipe
+ @param data pointer where the bytes are saved
+ @param size number of bytes
+ @return 0 if done correctly, -1 if the pipe was closed before
+ */
+int read_pipe(int pipe_fd, void *data, size_t size);
 
 /**
  Produces the schedule solving all constraints in one call to the Solver for a given network.
@@ -50,3 +104,156 @@
  @return 0 if the schedule was found, error code otherwise
  */
 int one_shot_scheduling(char *network_file, char *schedule_file, char *configuration_file);
+
+/**
+ Produces the schedule in two stages, first the offsets in the most utilized links and then the rest of them with the
+ first ones fixed. Both models are much smaller than the model scheduled in one shot, but the split is not exact:
+ the offsets fixed in the first stage can leave the second one without a schedule even if the network has one
+
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if the schedule was found, error code otherwise
+ */
+int hierarchical_scheduling(char *network_file, char *schedule_file, char *configuration_file);
+
+/**
+ Produces the schedule one priority class at a time, from the most critical to the least. Every class is scheduled
+ with the offsets of the more critical classes fixed, so the critical classes get their schedule even if a less
+ critical one cannot be scheduled. A class that cannot be scheduled is tried again with the more critical classes
+ scheduled with it, and if it still fails, the schedule of the critical classes is written with the frames of the rest
+ of classes rejected
+
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if all classes were scheduled, error code otherwise
+ */
+int priority_scheduling(char *network_file, char *schedule_file, char *configuration_file);
+
+/**
+ Produces the pareto front between the latency and the spacing of the transmissions in the same link.
+ The model is built once and every point is found in the same solver with a minimum spacing larger than the spacing of
+ the previous point, spread up to the largest spacing possible, until the maximum number of points is found, the
+ solver is called twice per point or the time limit stops it.
+ Every non-dominated schedule is written in the schedule file with the number of the point before the extension
+ 
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if at least one point was found, error code otherwise
+ */
+int pareto_scheduling(char *network_file, char *schedule_file, char *configuration_file);
+
+/**
+ Produces the schedule routing the frames with a logic-based Benders decomposition. A master problem chooses one path
+ for every receiver of every frame without exceeding the capacity of the links, and the groups of frames that share
+ links are scheduled in parallel processes. When a group cannot be scheduled, a minimal set of its frames in conflict
+ is cut from the master and the frames are routed again, until every group is scheduled
+ 
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if the schedule was found, error code otherwise
+ */
+int benders_scheduling(char *network_file, char *schedule_file, char *configuration_file);
+
+/**
+ Produces the schedule of the largest subset of frames that can be scheduled together when the network is overloaded.
+ Every frame has a literal that is true if it is scheduled, all its constraints only hold if it is scheduled, and the
+ solver maximizes the number of scheduled frames, or the sum of their priority classes plus one if the weights are the
+ priorities (SubsetWeights). The schedule file has the transmission times of the scheduled frames and the rejected ones
+
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if the schedule was found, error code otherwise
+ */
+int subset_scheduling(char *network_file, char *schedule_file, char *configuration_file);
+
+/**
+ Get the scheduling mode with the given name, as written in the schedule configuration
+
+ @param name name of the mode (oneshot, hierarchical, priority, pareto, benders or subset)
+ @return scheduling mode, MODE_NOT_FOUND if the name is not recognized
+ */
+int get_schedule_mode_by_name(char *name);
+
+/**
+ Read the network and the schedule configuration, and prepare the network to be scheduled
+
+ @param network_file name of the file with the description of the network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if done correctly, error code otherwise
+ */
+int load_network(char *network_file, char *configuration_file);
+
+/**
+ Read the schedule configuration and prepare the network already parsed to be scheduled, so the same parsed network
+ can be scheduled with different configurations
+
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if done correctly, error code otherwise
+ */
+int prepare_network(char *configuration_file);
+
+/**
+ Read the schedule configuration from the given xml in memory and prepare the network already parsed or built to be
+ scheduled, so no file is needed
+
+ @param configuration xml of the schedule configuration
+ @param size number of bytes of the xml
+ @return 0 if done correctly, error code otherwise
+ */
+int prepare_network_from_memory(char *configuration, int size);
+
+/**
+ Check that the network already prepared can be scheduled before solving it. No link can be used over its capacity
+ and, if the paths are not chosen by the solver, every offset needs a window where it can be transmitted. The windows
+ of the offsets are narrowed by the check
+
+ @return 0 if the network is valid, error code otherwise
+ */
+int validate_network(void);
+
+/**
+ Set if the next schedule configurations come from a client that is not trusted, as the ones sent to the daemon. A
+ restricted configuration can only use the built in solvers and cannot export the model
+
+ @param restricted 1 to restrict the configurations, 0 otherwise
+ */
+void set_restricted_configuration(int restricted);
+
+/**
+ Set the mode to schedule the network, overwriting the one given in the schedule configuration
+
+ @param mode mode to schedule the network
+ */
+void set_schedule_mode(ScheduleMode mode);
+
+/**
+ Get the mode to schedule the network, the one given in the schedule configuration unless it was overwritten
+
+ @return mode to schedule the network
+ */
+ScheduleMode get_schedule_mode(void);
+
+/**
+ Schedule the network already prepared with the mode given in the schedule configuration and write its schedule once.
+ The pareto front writes a file for every point instead, with the number of the point before the extension, and the
+ priority scheduling writes the higher classes with the rest rejected even if a class cannot be scheduled
+
+ @param schedule_file name of the file with the scheduled network
+ @return 0 if the schedule was found and written, error code otherwise
+ */
+int solve_network(char *schedule_file);
+
+/**
+ Produces the schedule of the given network with the mode given in the schedule configuration (Mode)
+
+ @param network_file name of the file with the description of the network
+ @param schedule_file name of the file with the scheduled network
+ @param configuration_file name of the file with the schedule configuration
+ @return 0 if the schedule was found, error code otherwise
+ */
+int schedule_network(char *network_file, char *schedule_file, char *configuration_file);
@@ -0,0 +1,840 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Z3Backend.c                                                                                                        *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Description in Z3Backend.h                                                                                         *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Z3Backend.h"
+#include "Backend.h"
+
+/* VARIABLES */
+
+Z3_context z3_context = NULL;       // Context where the constraint are added in z3, NULL if there is no model
+Z3_optimize z3_optimize;            // Optimization solver in z3
+Z3_model z3_model = NULL;           // Model of z3 with the last solution found, NULL if there is none
+Z3_sort z3_integer;                 // Integer sort of z3, created once per context
+Z3_ast z3_int0;                     // Numeral 0 of z3, created once per context
+Z3_ast z3_int1;                     // Numeral 1 of z3, created once per context
+long long int *z3_numeral_keys = NULL;  // Hash table with the values of the numerals already created in z3
+Z3_ast *z3_numeral_values = NULL;   // Hash table with the numerals already created in z3, NULL if the bucket is empty
+int z3_numeral_capacity = 0;        // Number of buckets of the numerals hash table (always a power of 2)
+int z3_numeral_count = 0;           // Number of numerals stored in the hash table
+Z3_ast *z3_variables = NULL;        // Term of every variable, its handle is the index in the array
+VariableDomain *z3_domains = NULL;  // Domain of every variable
+int z3_num_variables = 0;           // Number of variables in the model
+int z3_variables_capacity = 0;      // Number of variables allocated
+int *z3_bound_variables = NULL;     // Variables with a lower bound that is only asserted in the scope of every solve
+long long int *z3_bound_values = NULL;  // Value of every lower bound asserted in the scope of every solve
+int z3_num_bounds = 0;              // Number of lower bounds asserted in the scope of every solve
+long long int z3_num_constraints = 0;   // Number of constraints added into the z3 solver
+Z3_ast *z3_assertions = NULL;       // Formulas asserted into the optimize solver, to check them again with assumptions
+long long int z3_assertions_capacity = 0;   // Number of formulas allocated
+Z3_solver z3_core_solver = NULL;    // Solver that checks the formulas with assumptions to find cores, NULL if none
+long long int z3_core_asserted = 0; // Number of formulas already asserted into the solver of the cores
+FILE *z3_export_file = NULL;        // File where the model is being streamed (SMT-LIB2), NULL if not streaming
+
+/* PRIVATE FUNCTIONS */
+
+/**
+ Init the z3 objects that are used in almost every constraint, so they are created only once per context.
+ This includes the integer sort, the numerals 0 and 1 and an empty hash table of numerals
+ */
+void init_z3_cache(void) {
+    
+    z3_integer = Z3_mk_int_sort(z3_context);
+    z3_int0 = Z3_mk_int64(z3_context, 0, z3_integer);
+    z3_int1 = Z3_mk_int64(z3_context, 1, z3_integer);
+    
+    // The numerals of a previous context are not valid anymore
+    free(z3_numeral_keys);
+    free(z3_numeral_values);
+    z3_numeral_capacity = 1024;
+    z3_numeral_count = 0;
+    z3_numeral_keys = malloc(sizeof(long long int) * z3_numeral_capacity);
+    z3_numeral_values = malloc(sizeof(Z3_ast) * z3_numeral_capacity);
+    for (int bucket = 0; bucket < z3_numeral_capacity; bucket++) {
+        z3_numeral_values[bucket] = NULL;
+    }
+    z3_num_constraints = 0;
+}
+
+/**
+ Get the bucket of the numerals hash table where the given value is, or where it should be inserted
+
+ @param keys array with the values of the hash table
+ @param values array with the numerals of the hash table
+ @param capacity number of buckets of the hash table
+ @param value value of the numeral to search
+ @return bucket of the value
+ */
+int get_z3_numeral_bucket(long long int *keys, Z3_ast *values, int capacity, long long int value) {
+    
+    // Fibonacci hashing, capacity is always a power of 2 so we can mask it
+    int bucket = (int) (((unsigned long long int) value * 11400714819323198485ull) >> 40) & (capacity - 1);
+    
+    // Linear probing until we find the value or an empty bucket
+    while (values[bucket] != NULL && keys[bucket] != value) {
+        bucket = (bucket + 1) & (capacity - 1);
+    }
+    return bucket;
+}
+
+/**
+ Get the z3 integer numeral of the given value.
+ Numerals are saved in a hash table, so every different value is only created once in the context. Z3 also hash-cons
+ its terms, but going through the API for every constraint is much slower than the table
+
+ @param value integer value of the numeral
+ @return z3 numeral with the given value
+ */
+Z3_ast get_z3_numeral(long long int value) {
+    
+    int bucket;
+    int old_capacity;
+    long long int *old_keys;
+    Z3_ast *old_values;
+    
+    bucket = get_z3_numeral_bucket(z3_numeral_keys, z3_numeral_values, z3_numeral_capacity, value);
+    if (z3_numeral_values[bucket] != NULL) {
+        return z3_numeral_values[bucket];
+    }
+    
+    // If the table is half full, we double it and insert again all the previous numerals
+    if ((z3_numeral_count + 1) * 2 > z3_numeral_capacity) {
+        old_capacity = z3_numeral_capacity;
+        old_keys = z3_numeral_keys;
+        old_values = z3_numeral_values;
+        z3_numeral_capacity = z3_numeral_capacity * 2;
+        z3_numeral_keys = malloc(sizeof(long long int) * z3_numeral_capacity);
+        z3_numeral_values = malloc(sizeof(Z3_ast) * z3_numeral_capacity);
+        for (int new_bucket = 0; new_bucket < z3_numeral_capacity; new_bucket++) {
+            z3_numeral_values[new_bucket] = NULL;
+        }
+        for (int old_bucket = 0; old_bucket < old_capacity; old_bucket++) {
+            if (old_values[old_bucket] != NULL) {
+                bucket = get_z3_numeral_bucket(z3_numeral_keys, z3_numeral_values, z3_numeral_capacity,
+                                               old_keys[old_bucket]);
+                z3_numeral_keys[bucket] = old_keys[old_bucket];
+                z3_numeral_values[bucket] = old_values[old_bucket];
+            }
+        }
+        free(old_keys);
+        free(old_values);
+        bucket = get_z3_numeral_bucket(z3_numeral_keys, z3_numeral_values, z3_numeral_capacity, value);
+    }
+    
+    z3_numeral_keys[bucket] = value;
+    z3_numeral_values[bucket] = Z3_mk_int64(z3_context, value, z3_integer);
+    z3_numeral_count++;
+    return z3_numeral_values[bucket];
+}
+
+/**
+ Save the term of a new variable and give it its handle
+
+ @param term z3 term of the variable
+ @param domain domain of the variable
+ @return handle of the variable
+ */
+int add_z3_variable(Z3_ast term, VariableDomain domain) {
+    
+    // Grow the arrays doubling their size to avoid reallocating them for every variable
+    if (z3_num_variables == z3_variables_capacity) {
+        z3_variables_capacity = z3_variables_capacity == 0 ? 1024 : z3_variables_capacity * 2;
+        z3_variables = realloc(z3_variables, sizeof(Z3_ast) * z3_variables_capacity);
+        z3_domains = realloc(z3_domains, sizeof(VariableDomain) * z3_variables_capacity);
+    }
+    
+    z3_variables[z3_num_variables] = term;
+    z3_domains[z3_num_variables] = domain;
+    z3_num_variables++;
+    return z3_num_variables - 1;
+}
+
+/**
+ Get the z3 term of the given variable to use it in an arithmetic expression. Literals are 1 if true and 0 if false
+
+ @param variable handle of the variable
+ @return z3 term, NULL if the variable does not exist
+ */
+Z3_ast get_z3_arithmetic_term(int variable) {
+    
+    if (variable < 0 || variable >= z3_num_variables) {
+        printf("The z3 variable %d does not exist\n", variable);
+        return NULL;
+    }
+    if (z3_domains[variable] == boolean_domain) {
+        return Z3_mk_ite(z3_context, z3_variables[variable], z3_int1, z3_int0);
+    }
+    return z3_variables[variable];
+}
+
+/**
+ Get the z3 literal of the given boolean variable with the given value
+
+ @param variable handle of the variable
+ @param value 1 for the variable, 0 for its negation
+ @return z3 literal, NULL if the variable does not exist or it is not boolean
+ */
+Z3_ast get_z3_literal(int variable, int value) {
+    
+    if (variable < 0 || variable >= z3_num_variables || z3_domains[variable] != boolean_domain) {
+        printf("The z3 literal %d does not exist\n", variable);
+        return NULL;
+    }
+    if (value == 0) {
+        return Z3_mk_not(z3_context, z3_variables[variable]);
+    }
+    return z3_variables[variable];
+}
+
+/**
+ Create the z3 formula of a linear constraint. Positive terms are on the left side and negative terms on the right, so
+ differences keep their natural form (offset2 >= offset1 + distance)
+
+ @param constraint pointer to the linear constraint
+ @return z3 formula, NULL if any variable does not exist
+ */
+Z3_ast make_z3_linear(LinearConstraint *constraint) {
+    
+    Z3_ast left_args[MAX_LINEAR_VARIABLES + 1], right_args[MAX_LINEAR_VARIABLES + 1], mul_args[2];
+    Z3_ast left, right, term;
+    int num_left = 0, num_right = 0;
+    long long int value;
+    
+    for (int term_it = 0; term_it < constraint->num_variables; term_it++) {
+        term = get_z3_arithmetic_term(constraint->variables[term_it]);
+        if (term == NULL) {
+            return NULL;
+        }
+        value = constraint->values[term_it];
+        if (value == 0) {
+            continue;
+        }
+        if (value != 1 && value != -1) {
+            mul_args[0] = get_z3_numeral(value > 0 ? value : -value);
+            mul_args[1] = term;
+            term = Z3_mk_mul(z3_context, 2, mul_args);
+        }
+        if (value > 0) {
+            left_args[num_left] = term;
+            num_left++;
+        } else {
+            right_args[num_right] = term;
+            num_right++;
+        }
+    }
+    if (constraint->rhs > 0) {
+        right_args[num_right] = get_z3_numeral(constraint->rhs);
+        num_right++;
+    } else if (constraint->rhs < 0) {
+        left_args[num_left] = get_z3_numeral(-constraint->rhs);
+        num_left++;
+    }
+    
+    left = num_left == 0 ? z3_int0 : (num_left == 1 ? left_args[0] : Z3_mk_add(z3_context, num_left, left_args));
+    right = num_right == 0 ? z3_int0 : (num_right == 1 ? right_args[0] : Z3_mk_add(z3_context, num_right, right_args));
+    switch (constraint->sense) {
+        case sense_less_equal:
+            return Z3_mk_le(z3_context, left, right);
+        case sense_greater_equal:
+            return Z3_mk_ge(z3_context, left, right);
+        default:
+            return Z3_mk_eq(z3_context, left, right);
+    }
+}
+
+/**
+ Asserts the given formula into the z3 optimize solver and counts it.
+ If the model is being exported, the formula is also written, so the model is never built as a single string
+
+ @param z3_formula formula to assert
+ */
+void assert_z3(Z3_ast z3_formula) {
+    
+    Z3_optimize_assert(z3_context, z3_optimize, z3_formula);
+    // Keep the formula in case it has to be checked again to find an unsat core
+    if (z3_num_constraints == z3_assertions_capacity) {
+        z3_assertions_capacity = z3_assertions_capacity == 0 ? 1024 : z3_assertions_capacity * 2;
+        z3_assertions = realloc(z3_assertions, sizeof(Z3_ast) * z3_assertions_capacity);
+    }
+    z3_assertions[z3_num_constraints] = z3_formula;
+    z3_num_constraints++;
+    if (z3_export_file != NULL) {
+        fprintf(z3_export_file, "(assert %s)\n", Z3_ast_to_string(z3_context, z3_formula));
+    }
+}
+
+/**
+ Finish the streamed model, as nothing else is added once it is solved
+ */
+void close_z3_export(void) {
+    
+    if (z3_export_file != NULL) {
+        fprintf(z3_export_file, "(check-sat)\n(get-model)\n");
+        fclose(z3_export_file);
+        z3_export_file = NULL;
+        Z3_set_ast_print_mode(z3_context, Z3_PRINT_SMTLIB_FULL);
+    }
+}
+
+/**
+ Free the model of z3, it can be called several times
+ */
+void z3_destroy(void) {
+    
+    if (z3_context == NULL) {
+        return;
+    }
+    close_z3_export();
+    if (z3_model != NULL) {
+        Z3_model_dec_ref(z3_context, z3_model);
+        z3_model = NULL;
+    }
+    if (z3_core_solver != NULL) {
+        Z3_solver_dec_ref(z3_context, z3_core_solver);
+        z3_core_solver = NULL;
+    }
+    Z3_optimize_dec_ref(z3_context, z3_optimize);
+    Z3_del_context(z3_context);
+    z3_context = NULL;
+}
+
+/**
+ Create an empty model in a new context of z3
+
+ @return 0 if done correctly, error code otherwise
+ */
+int z3_create(void) {
+    
+    Z3_config z3_configuration;
+    
+    z3_destroy();
+    z3_configuration = Z3_mk_config();
+    z3_context = Z3_mk_context(z3_configuration);
+    Z3_del_config(z3_configuration);
+    z3_optimize = Z3_mk_optimize(z3_context);
+    // The optimize solver is reference counted even in this context, without a reference it is freed with
+    // the first model and it cannot be checked again
+    Z3_optimize_inc_ref(z3_context, z3_optimize);
+    init_z3_cache();
+    Z3_global_param_set("model", "true");
+    Z3_global_param_set("auto_config", "true");
+    z3_num_variables = 0;
+    z3_num_bounds = 0;
+    return 0;
+}
+
+/**
+ Open the file where the model is streamed in SMT-LIB2 while it is built
+
+ @param format format of the exported model, only smt2_export is supported
+ @param filename name of the file to write the model
+ @return 0 if done correctly, error code otherwise
+ */
+int z3_open_export(ExportFormat format, char *filename) {
+    
+    if (format != smt2_export) {
+        printf("Only SMT-LIB2 export is supported with z3\n");
+        return EXPORT_FORMAT_NOT_SUPPORTED;
+    }
+    z3_export_file = fopen(filename, "w");
+    if (z3_export_file == NULL) {
+        printf("The export file could not be opened\n");
+        return EXPORT_FILE_NOT_OPENED;
+    }
+    // Print formulas so the file can be read by any SMT-LIB2 solver
+    Z3_set_ast_print_mode(z3_context, Z3_PRINT_SMTLIB2_COMPLIANT);
+    fprintf(z3_export_file, "(set-logic QF_LIA)\n");
+    return 0;
+}
+
+/**
+ Create a constant of z3 with the given bounds. If both bounds are the same, it is just a numeral (or true and false)
+
+ @param lower lower bound of the variable, -INFINITE_BOUND if it is not bounded
+ @param upper upper bound of the variable, INFINITE_BOUND if it is not bounded
+ @param domain domain of the variable
+ @param index index of the variable to identify it if it has no name, -1 for a fresh name
+ @param name name of the variable, NULL to identify it by its index
+ @return handle of the variable
+ */
+int z3_new_var(long long int lower, long long int upper, VariableDomain domain, int index, char *name) {
+    
+    Z3_sort z3_sort;
+    Z3_symbol z3_name;
+    Z3_ast z3_constant;
+    
+    if (lower == upper) {
+        if (domain == boolean_domain) {
+            return add_z3_variable(lower == 0 ? Z3_mk_false(z3_context) : Z3_mk_true(z3_context), domain);
+        }
+        return add_z3_variable(get_z3_numeral(lower), domain);
+    }
+    
+    z3_sort = domain == boolean_domain ? Z3_mk_bool_sort(z3_context) : z3_integer;
+    if (name != NULL) {
+        z3_name = Z3_mk_string_symbol(z3_context, name);
+        z3_constant = Z3_mk_const(z3_context, z3_name, z3_sort);
+    } else if (index >= 0) {
+        z3_name = Z3_mk_int_symbol(z3_context, index);
+        z3_constant = Z3_mk_const(z3_context, z3_name, z3_sort);
+    } else {
+        z3_constant = Z3_mk_fresh_const(z3_context, "v", z3_sort);
+    }
+    if (z3_export_file != NULL) {
+        fprintf(z3_export_file, "(declare-fun %s () %s)\n", Z3_ast_to_string(z3_context, z3_constant),
+                domain == boolean_domain ? "Bool" : "Int");
+    }
+    
+    if (domain == integer_domain) {
+        if (lower != -INFINITE_BOUND) {
+            assert_z3(Z3_mk_ge(z3_context, z3_constant, get_z3_numeral(lower)));
+        }
+        if (upper != INFINITE_BOUND) {
+            assert_z3(Z3_mk_le(z3_context, z3_constant, get_z3_numeral(upper)));
+        }
+    }
+    return add_z3_variable(z3_constant, domain);
+}
+
+/**
+ Assert a linear constraint
+
+ @param constraint pointer to the linear constraint
+ @return 0 if done correctly, error code otherwise
+ */
+int z3_add_diff(LinearConstraint *constraint) {
+    
+    Z3_ast z3_formula = make_z3_linear(constraint);
+    
+    if (z3_formula == NULL) {
+        return Z3_VARIABLE_OUT_OF_RANGE;
+    }
+    assert_z3(z3_formula);
+    return 0;
+}
+
+/**
+ Assert a linear constraint implied by the given literal
+ literal = value => constraint
+
+ @param literal handle of the boolean variable
+ @param value value of the variable that activates the constraint (0 or 1)
+ @param constraint pointer to the linear constraint
+ @return 0 if done correctly, error code otherwise
+ */
+int z3_add_guarded(int literal, int value, LinearConstraint *constraint) {
+    
+    Z3_ast z3_formula = make_z3_linear(constraint);
+    Z3_ast z3_literal = get_z3_literal(literal, value);
+    
+    if (z3_formula == NULL || z3_literal == NULL) {
+        return Z3_VARIABLE_OUT_OF_RANGE;
+    }
+    assert_z3(Z3_mk_implies(z3_context, z3_literal, z3_formula));
+    return 0;
+}
+
+/**
+ Assert that at least one of the constraints holds or any of the guards is false, as a single clause
+
+ @param num_constraints number of constraints
+ @param constraints array with the linear constraints
+ @param num_guards number of guard literals
+ @param guards array with the handles of the guard literals
+ @return 0 if done correctly, error code otherwise
+ */
+int z3_add_disjunction(int num_constraints, LinearConstraint *constraints, int num_guards, int *guards) {
+    
+    Z3_ast *z3_or_args;
+    int num_args = 0;
+    int result = 0;
+    
+    z3_or_args = malloc(sizeof(Z3_ast) * (num_constraints + num_guards));
+    for (int constraint_it = 0; constraint_it < num_constraints; constraint_it++) {
+        z3_or_args[num_args] = make_z3_linear(&constraints[constraint_it]);
+        if (z3_or_args[num_args] == NULL) {
+            result = Z3_VARIABLE_OUT_OF_RANGE;
+        }
+        num_args++;
+    }
+    for (int guard_it = 0; guard_it < num_guards; guard_it++) {
+        z3_or_args[num_args] = get_z3_literal(guards[guard_it], 0);
+        if (z3_or_args[num_args] == NULL) {
+            result = Z3_VARIABLE_OUT_OF_RANGE;
+        }
+        num_args++;
+    }
+    if (result == 0) {
+        assert_z3(num_args == 1 ? z3_or_args[0] : Z3_mk_or(z3_context, num_args, z3_or_args));
+    }
+    free(z3_or_args);
+    return result;
+}
+
+/**
+ Assert that the result literal is true if and only if any of the literals is true
+
+ @param result handle of the result literal
+ @param num_literals number of literals
+ @param literals array with the handles of the literals
+ @return 0 if done correctly, error code otherwise
+ */
+int z3_add_or(int result, int num_literals, int *literals) {
+    
+    Z3_ast *z3_or_args;
+    Z3_ast z3_result = get_z3_literal(result, 1);
+    int error = z3_result == NULL ? Z3_VARIABLE_OUT_OF_RANGE : 0;
+    
+    z3_or_args = malloc(sizeof(Z3_ast) * (num_literals + 1));
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        z3_or_args[literal_it] = get_z3_literal(literals[literal_it], 1);
+        if (z3_or_args[literal_it] == NULL) {
+            error = Z3_VARIABLE_OUT_OF_RANGE;
+        }
+    }
+    if (error == 0) {
+        assert_z3(Z3_mk_iff(z3_context, z3_result, num_literals == 0 ? Z3_mk_false(z3_context) :
+                            Z3_mk_or(z3_context, num_literals, z3_or_args)));
+    }
+    free(z3_or_args);
+    return error;
+}
+
+/**
+ Assert that exactly one of the literals is true, at least one as a clause and at most one as a pseudo-boolean
+ constraint. Without literals it can never hold
+
+ @param num_literals number of literals
+ @param literals array with the handles of the literals
+ @return 0 if done correctly, error code otherwise
+ */
+int z3_add_exactly_one(int num_literals, int *literals) {
+    
+    Z3_ast *z3_literals;
+    int error = 0;
+    
+    if (num_literals <= 0) {
+        assert_z3(Z3_mk_false(z3_context));
+        return 0;
+    }
+    z3_literals = malloc(sizeof(Z3_ast) * (num_literals + 1));
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        z3_literals[literal_it] = get_z3_literal(literals[literal_it], 1);
+        if (z3_literals[literal_it] == NULL) {
+            error = Z3_VARIABLE_OUT_OF_RANGE;
+        }
+    }
+    if (error == 0) {
+        assert_z3(Z3_mk_or(z3_context, num_literals, z3_literals));
+        if (num_literals > 1) {
+            assert_z3(Z3_mk_atmost(z3_context, num_literals, z3_literals, 1));
+        }
+    }
+    free(z3_literals);
+    return error;
+}
+
+/**
+ Add an objective into the z3 optimize solver, which combines them lexicographically in the order they are added.
+ If all the coefficients are negative, the sum of the variables is minimized instead of maximizing its negation
+
+ @param num_variables number of variables of the objective
+ @param variables array with the handles of the variables
+ @param values array with the coefficient of every variable (integers)
+ @return 0 if done correctly, error code otherwise
+ */
+int z3_set_objective(int num_variables, int *variables, double *values) {
+    
+    Z3_ast *z3_positive, *z3_negative, z3_mul_args[2], z3_sub_args[2];
+    Z3_ast z3_term, z3_objective;
+    int num_positive = 0, num_negative = 0;
+    long long int value;
+    int error = 0;
+    
+    z3_positive = malloc(sizeof(Z3_ast) * (num_variables + 1));
+    z3_negative = malloc(sizeof(Z3_ast) * (num_variables + 1));
+    for (int variable_it = 0; variable_it < num_variables; variable_it++) {
+        z3_term = get_z3_arithmetic_term(variables[variable_it]);
+        value = llround(values[variable_it]);
+        if (z3_term == NULL) {
+            error = Z3_VARIABLE_OUT_OF_RANGE;
+            break;
+        }
+        if (value == 0) {
+            continue;
+        }
+        if (value != 1 && value != -1) {
+            z3_mul_args[0] = get_z3_numeral(value > 0 ? value : -value);
+            z3_mul_args[1] = z3_term;
+            z3_term = Z3_mk_mul(z3_context, 2, z3_mul_args);
+        }
+        if (value > 0) {
+            z3_positive[num_positive] = z3_term;
+            num_positive++;
+        } else {
+            z3_negative[num_negative] = z3_term;
+            num_negative++;
+        }
+    }
+    
+    if (error == 0 && num_positive + num_negative > 0) {
+        if (num_positive == 0) {
+            z3_objective = Z3_mk_add(z3_context, num_negative, z3_negative);
+            Z3_optimize_minimize(z3_context, z3_optimize, z3_objective);
+        } else {
+            z3_objective = Z3_mk_add(z3_context, num_positive, z3_positive);
+            if (num_negative > 0) {
+                z3_sub_args[0] = z3_objective;
+                z3_sub_args[1] = Z3_mk_add(z3_context, num_negative, z3_negative);
+                z3_objective = Z3_mk_sub(z3_context, 2, z3_sub_args);
+            }
+            Z3_optimize_maximize(z3_context, z3_optimize, z3_objective);
+        }
+        if (z3_export_file != NULL) {
+            fprintf(z3_export_file, "(%s %s)\n", num_positive == 0 ? "minimize" : "maximize",
+                    Z3_ast_to_string(z3_context, z3_objective));
+        }
+    }
+    free(z3_positive);
+    free(z3_negative);
+    return error;
+}
+
+/**
+ Change the lower bound of a variable for the next solves. The bounds are asserted in a scope that is removed after
+ every solve, so the rest of the model and what z3 learnt from it are kept
+
+ @param variable handle of the variable
+ @param lower new lower bound
+ @return 0 if done correctly, error code otherwise
+ */
+int z3_set_lower_bound(int variable, long long int lower) {
+    
+    if (variable < 0 || variable >= z3_num_variables) {
+        return Z3_VARIABLE_OUT_OF_RANGE;
+    }
+    for (int bound_it = 0; bound_it < z3_num_bounds; bound_it++) {
+        if (z3_bound_variables[bound_it] == variable) {
+            z3_bound_values[bound_it] = lower;
+            return 0;
+        }
+    }
+    z3_bound_variables = realloc(z3_bound_variables, sizeof(int) * (z3_num_bounds + 1));
+    z3_bound_values = realloc(z3_bound_values, sizeof(long long int) * (z3_num_bounds + 1));
+    z3_bound_variables[z3_num_bounds] = variable;
+    z3_bound_values[z3_num_bounds] = lower;
+    z3_num_bounds++;
+    return 0;
+}
+
+/**
+ Check the optimize solver of z3 and keep the model found. If the time limit stops z3, the result is unknown and no
+ model is kept
+
+ @param time limit time in seconds to solve the model, 0 or less to solve without limit
+ @return 1 if a solution was found, 0 if there is none, BACKEND_TIME_LIMIT if the time limit stopped the search
+ */
+int z3_solve(int time) {
+    
+    Z3_params z3_parameters;
+    Z3_lbool z3_result;
+    
+    close_z3_export();
+    if (time > 0) {
+        z3_parameters = Z3_mk_params(z3_context);
+        Z3_params_inc_ref(z3_context, z3_parameters);
+        Z3_params_set_uint(z3_context, z3_parameters, Z3_mk_string_symbol(z3_context, "timeout"),
+                           (unsigned) time * 1000);
+        Z3_optimize_set_params(z3_context, z3_optimize, z3_parameters);
+        Z3_params_dec_ref(z3_context, z3_parameters);
+    }
+    if (z3_model != NULL) {
+        Z3_model_dec_ref(z3_context, z3_model);
+        z3_model = NULL;
+    }
+    if (z3_num_bounds > 0) {
+        Z3_optimize_push(z3_context, z3_optimize);
+        for (int bound_it = 0; bound_it < z3_num_bounds; bound_it++) {
+            Z3_optimize_assert(z3_context, z3_optimize, Z3_mk_ge(z3_context, z3_variables[z3_bound_variables[bound_it]],
+                                                                 get_z3_numeral(z3_bound_values[bound_it])));
+        }
+    }
+    z3_result = Z3_optimize_check(z3_context, z3_optimize);
+    if (z3_result == Z3_L_TRUE) {
+        z3_model = Z3_optimize_get_model(z3_context, z3_optimize);
+        Z3_model_inc_ref(z3_context, z3_model);
+    }
+    if (z3_num_bounds > 0) {
+        Z3_optimize_pop(z3_context, z3_optimize);
+    }
+    if (z3_result == Z3_L_UNDEF) {
+        return BACKEND_TIME_LIMIT;
+    }
+    return z3_result == Z3_L_TRUE ? 1 : 0;
+}
+
+/**
+ Check the formulas of the model assuming that the given literals are true, and keep the model found. The optimize
+ solver of z3 does not give unsat cores, so the formulas are asserted again into a solver that is kept for the next
+ checks, as a core is usually minimized with several of them. The objectives and the lower bounds are not used
+
+ @param time limit time in seconds of the check, 0 or less to check without limit
+ @param num_literals number of literals assumed
+ @param literals array with the handles of the literals assumed
+ @param num_core pointer to save the number of literals in the unsat core
+ @param core array to save the handles of the literals in the unsat core, with space for all the literals assumed
+ @return 1 if a solution was found, 0 if there is none, error code if it is unknown
+ */
+int z3_solve_assuming(int time, int num_literals, int *literals, int *num_core, int *core) {
+    
+    Z3_ast *assumptions;
+    Z3_ast z3_literal;
+    Z3_ast_vector z3_core;
+    Z3_params z3_parameters;
+    Z3_lbool z3_result;
+    
+    close_z3_export();
+    if (z3_model != NULL) {
+        Z3_model_dec_ref(z3_context, z3_model);
+        z3_model = NULL;
+    }
+    if (z3_core_solver == NULL) {
+        z3_core_solver = Z3_mk_solver(z3_context);
+        Z3_solver_inc_ref(z3_context, z3_core_solver);
+        z3_core_asserted = 0;
+    }
+    if (time > 0) {
+        z3_parameters = Z3_mk_params(z3_context);
+        Z3_params_inc_ref(z3_context, z3_parameters);
+        Z3_params_set_uint(z3_context, z3_parameters, Z3_mk_string_symbol(z3_context, "timeout"),
+                           (unsigned) time * 1000);
+        Z3_solver_set_params(z3_context, z3_core_solver, z3_parameters);
+        Z3_params_dec_ref(z3_context, z3_parameters);
+    }
+    // Only the formulas added since the previous check are missing
+    while (z3_core_asserted < z3_num_constraints) {
+        Z3_solver_assert(z3_context, z3_core_solver, z3_assertions[z3_core_asserted]);
+        z3_core_asserted++;
+    }
+    
+    assumptions = malloc(sizeof(Z3_ast) * (num_literals + 1));
+    for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+        assumptions[literal_it] = get_z3_literal(literals[literal_it], 1);
+        if (assumptions[literal_it] == NULL) {
+            free(assumptions);
+            return Z3_VARIABLE_OUT_OF_RANGE;
+        }
+    }
+    z3_result = Z3_solver_check_assumptions(z3_context, z3_core_solver, num_literals, assumptions);
+    if (z3_result == Z3_L_TRUE) {
+        z3_model = Z3_solver_get_model(z3_context, z3_core_solver);
+        Z3_model_inc_ref(z3_context, z3_model);
+    } else if (z3_result == Z3_L_FALSE) {
+        // The core has the constants of the literals, which are searched in the assumptions to get their handles
+        z3_core = Z3_solver_get_unsat_core(z3_context, z3_core_solver);
+        Z3_ast_vector_inc_ref(z3_context, z3_core);
+        *num_core = 0;
+        for (unsigned core_it = 0; core_it < Z3_ast_vector_size(z3_context, z3_core); core_it++) {
+            z3_literal = Z3_ast_vector_get(z3_context, z3_core, core_it);
+            for (int literal_it = 0; literal_it < num_literals; literal_it++) {
+                if (Z3_is_eq_ast(z3_context, z3_literal, assumptions[literal_it])) {
+                    core[*num_core] = literals[literal_it];
+                    (*num_core)++;
+                    break;
+                }
+            }
+        }
+        Z3_ast_vector_dec_ref(z3_context, z3_core);
+    }
+    free(assumptions);
+    
+    if (z3_result == Z3_L_UNDEF) {
+        return Z3_UNKNOWN_RESULT;
+    }
+    return z3_result == Z3_L_TRUE ? 1 : 0;
+}
+
+/**
+ Get the value of a variable in the last model found by z3
+
+ @param variable handle of the variable
+ @param value pointer to save the value, literals are 1 if true and 0 if false
+ @return 0 if done correctly, error code otherwise
+ */
+int z3_get_value(int variable, long long int *value) {
+    
+    Z3_ast z3_value;
+    int64_t z3_result;
+    
+    if (z3_model == NULL) {
+        return NO_Z3_MODEL;
+    }
+    if (variable < 0 || variable >= z3_num_variables) {
+        return Z3_VARIABLE_OUT_OF_RANGE;
+    }
+    if (Z3_model_eval(z3_context, z3_model, z3_variables[variable], Z3_TRUE, &z3_value) == Z3_FALSE) {
+        return ERROR_EXTRACTING_Z3_OFFSET;
+    }
+    if (z3_domains[variable] == boolean_domain) {
+        *value = Z3_get_bool_value(z3_context, z3_value) == Z3_L_TRUE ? 1 : 0;
+        return 0;
+    }
+    if (Z3_get_numeral_int64(z3_context, z3_value, &z3_result) == Z3_FALSE) {
+        return ERROR_EXTRACTING_Z3_OFFSET;
+    }
+    *value = z3_result;
+    return 0;
+}
+
+/**
+ Get the number of formulas asserted into z3
+
+ @return number of constraints
+ */
+long long int z3_get_num_constraints(void) {
+    
+    return z3_num_constraints;
+}
+
+/* PUBLIC FUNCTIONS */
+
+/**
+ Get the built in backend of z3, which finds the schedule with its optimize solver
+
+ @return pointer to the backend
+ */
+SolverBackend * get_z3_backend(void) {
+    
+    static SolverBackend z3_backend = {
+        .version = BACKEND_INTERFACE_VERSION,
+        .name = "z3",
+        .distances = 0,
+        .create = z3_create,
+        .open_export = z3_open_export,
+        .new_var = z3_new_var,
+        .add_diff = z3_add_diff,
+        .add_guarded = z3_add_guarded,
+        .add_disjunction = z3_add_disjunction,
+        .add_or = z3_add_or,
+        .add_exactly_one = z3_add_exactly_one,
+        .add_resource = NULL,
+        .set_objective = z3_set_objective,
+        .set_lower_bound = z3_set_lower_bound,
+        .solve = z3_solve,
+        .solve_assuming = z3_solve_assuming,
+        .tune = NULL,
+        .get_value = z3_get_value,
+        .get_num_constraints = z3_get_num_constraints,
+        .destroy = z3_destroy
+    };
+    
+    return &z3_backend;
+}
@@ -0,0 +1,31 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Z3Backend.h                                                                                                        *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 17/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Package that contains the backend of z3. The model is asserted into the optimize solver of z3, where integer       *
+ *  variables are integer constants and literals are boolean constants, so the constraints are solved with the         *
+ *  arithmetic of z3. The model can be streamed in SMT-LIB2 while it is built. Unsat cores are found checking the same *
+ *  formulas with assumptions in a solver of z3.                                                                       *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef Z3Backend_h
+#define Z3Backend_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <z3.h>
+
+#endif /* Z3Backend_h */
+
+/* ERROR CODE DEFINITIONS */
+
+#define ERROR_EXTRACTING_Z3_OFFSET -1
+#define Z3_VARIABLE_OUT_OF_RANGE -2
+#define NO_Z3_MODEL -3
+#define Z3_UNKNOWN_RESULT -4
@@ -9,12 +9,120 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 #include <stdio.h>
+#include <getopt.h>
 #include "Scheduler.h"
+#include "Daemon.h"
+#include "Driver.h"
 
-int main(int argc, const char * argv[]) {
-    // insert code here...
-    printf("Hello, World!\n");
-    one_shot_scheduling("XML Files/Network.xml", "XML Files/Schedule.xml", "XML Files/ScheduleConfiguration.xml");
-    printf("Maximum link utlization: %f\n", get_max_link_utilization());
-    return 0;
+/**
+ Print how to call the scheduler
+
+ @param program name of the program
+ */
+void print_usage(const char *program) {
+    
+    printf("Usage: %s [options]\n"
+           "  -n, --network FILE    network to schedule (XML Files/Network.xml)\n"
+           "  -c, --config FILE     schedule configuration (XML Files/ScheduleConfiguration.xml)\n"
+           "  -o, --output PATH     schedule file, or directory of the batch (XML Files/Schedule.xml)\n"
+           "  -m, --mode MODE       oneshot, hierarchical, priority, pareto, benders or subset, overwrites the\n"
+           "                        mode of the configuration\n"
+           "  -s, --stats           print a line with the statistics of the network when it finishes\n"
+           "  -b, --batch PATH      schedule all the xml files of a directory, or the networks of a manifest\n"
+           "  -S, --stats-file FILE write the statistics of the batch in a file instead of the standard output\n"
+           "  -j, --jobs N          networks of the batch or requests of the daemon solved at the same time\n"
+           "  -M, --memory MB       maximum memory of the process of every network of the batch\n"
+           "  -d, --daemon SOCKET   run as a daemon listening in a Unix-domain socket\n"
+           "  -h, --help            print this help\n", program);
+}
+
+int main(int argc, char * argv[]) {
+    
+    struct option options[] = {
+        {"network", required_argument, NULL, 'n'},
+        {"config", required_argument, NULL, 'c'},
+        {"output", required_argument, NULL, 'o'},
+        {"mode", required_argument, NULL, 'm'},
+        {"stats", no_argument, NULL, 's'},
+        {"batch", required_argument, NULL, 'b'},
+        {"stats-file", required_argument, NULL, 'S'},
+        {"jobs", required_argument, NULL, 'j'},
+        {"memory", required_argument, NULL, 'M'},
+        {"daemon", required_argument, NULL, 'd'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+    char *network_file = "XML Files/Network.xml";
+    char *configuration_file = "XML Files/ScheduleConfiguration.xml";
+    char *output = NULL;
+    char *batch = NULL, *stats_file = NULL, *socket_path = NULL;
+    char stats[STATS_LINE_SIZE];
+    int mode = KEEP_CONFIGURATION_MODE;
+    int print_stats = 0, num_workers = 0;
+    long long int memory_limit = 0;
+    int option, result;
+    
+    while ((option = getopt_long(argc, argv, "n:c:o:m:sb:S:j:M:d:h", options, NULL)) != -1) {
+        switch (option) {
+            case 'n':
+                network_file = optarg;
+                break;
+            case 'c':
+                configuration_file = optarg;
+                break;
+            case 'o':
+                output = optarg;
+                break;
+            case 'm':
+                mode = get_schedule_mode_by_name(optarg);
+                if (mode < 0) {
+                    printf("Scheduling mode not recognized\n");
+                    return 2;
+                }
+                break;
+            case 's':
+                print_stats = 1;
+                break;
+            case 'b':
+                batch = optarg;
+                break;
+            case 'S':
+                stats_file = optarg;
+                break;
+            case 'j':
+                num_workers = atoi(optarg);
+                break;
+            case 'M':
+                memory_limit = atoll(optarg);
+                break;
+            case 'd':
+                socket_path = optarg;
+                break;
+            case 'h':
+                print_usage(argv[0]);
+                return 0;
+            default:
+                print_usage(argv[0]);
+                return 2;
+        }
+    }
+    
+    if (socket_path != NULL) {
+        return run_daemon(socket_path, num_workers, 0) < 0;
+    }
+    if (batch != NULL) {
+        if (output == NULL) {
+            printf("The batch needs an output directory\n");
+            return 2;
+        }
+        result = run_batch(batch, configuration_file, output, stats_file, mode, num_workers, memory_limit);
+        return result != 0;
+    }
+    
+    result = schedule_with_stats(network_file, configuration_file, output != NULL ? output : "XML Files/Schedule.xml",
+                                 mode, stats);
+    if (print_stats == 1) {
+        printf("%s", stats);
+    }
+    return result < 0;
 }
@@ -0,0 +1,214 @@
+# -*- coding: utf-8 -*-
+
+"""* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Schedule Checker Class                                                                                             *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 18/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Class that checks a schedule written by the Organic Scheduler against the network xml it was obtained from, with   *
+ *  no help from the scheduler. Every transmission has to be inside the window of its instance, two transmissions of   *
+ *  the same link cannot overlap (counting the guard band and the precision of the node that transmits), every hop     *
+ *  waits the previous one and the switch minimum time, and the last hop of every path finishes within the end to end  *
+ *  delay of the frame. Only the replica 0 of every instance is related with the other hops, as the wired links of the *
+ *  tests have no more replicas.                                                                                       *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * """
+
+import xml.etree.ElementTree as ElementTree
+
+
+class ScheduleChecker:
+    """
+    Class with the information of a network needed to check its schedules
+    """
+
+    def __init__(self, network_file):
+        """
+        Initialization of the checker, reading the network xml
+        :param network_file: name of the file with the network xml
+        :type network_file: str
+        """
+        root = ElementTree.parse(network_file).getroot()
+        general = root.find("General_Information")
+        self.__switch_time = int(general.findtext("Switch_Information/Minimum_Time", "0"))
+
+        # Overhead and guard band of every link type, 0 if the link type is not described
+        overhead = {}
+        guard_band = {}
+        for link_type in general.findall("Link_Types/Link_Type"):
+            overhead[link_type.get("category")] = int(link_type.findtext("Overhead", "0"))
+            guard_band[link_type.get("category")] = int(link_type.findtext("Guard_Band", "0"))
+        precision = {}
+        for node in root.findall("Topology/Nodes/Node"):
+            precision[int(node.findtext("NodeID"))] = int(node.findtext("Precision", "0"))
+
+        # Speed, overhead and separation between transmissions of every link
+        self.__links = {}
+        for link in root.findall("Topology/Links/Link"):
+            category = link.get("category")
+            source = link.findtext("Node_Source")
+            self.__links[int(link.findtext("LinkID"))] = {
+                "speed": int(link.findtext("Speed")),
+                "overhead": overhead.get(category, 0),
+                "separation": guard_band.get(category, 0) + (precision.get(int(source), 0) if source else 0)}
+
+        # Paths of every sender to every receiver as lists of links
+        self.__paths = {}
+        for sender in root.findall("Topology/Paths/Sender"):
+            for receiver in sender.findall("Receivers/Receiver"):
+                self.__paths[(int(sender.findtext("SenderID")), int(receiver.findtext("ReceiverID")))] = \
+                    [[int(link) for link in path.text.split(";")] for path in receiver.findall("Paths/Path")]
+
+        self.__frames = {}
+        for frame in root.findall("Frames/Frame"):
+            self.__frames[int(frame.findtext("FrameID"))] = {
+                "period": int(frame.findtext("Period")),
+                "deadline": int(frame.findtext("Deadline")),
+                "size": int(frame.findtext("Size")),
+                "starting": int(frame.findtext("StartingTime")),
+                "end_to_end": int(frame.findtext("EndToEnd")),
+                "sender": int(frame.findtext("SenderID")),
+                "receivers": [int(receiver) for receiver in frame.findtext("ReceiversID").split(";")]}
+
+    def timeslot(self, frame_id, link_id):
+        """
+        Get the time to transmit the frame in the link, as the scheduler calculates it
+        :param frame_id: identifier of the frame
+        :type frame_id: int
+        :param link_id: identifier of the link
+        :type link_id: int
+        :return: time to transmit in ns
+        :rtype: int
+        """
+        link = self.__links[link_id]
+        return ((self.__frames[frame_id]["size"] + link["overhead"]) * 1000) // link["speed"]
+
+    @staticmethod
+    def read_schedule(schedule_file):
+        """
+        Read a schedule xml written by the scheduler
+        :param schedule_file: name of the file with the schedule
+        :type schedule_file: str
+        :return: hyper-period, list of rejected frames and list of transmissions as
+                 [frame id, link id, instance, replica, time in ns]
+        :rtype: (int, list of int, list of list of int)
+        """
+        root = ElementTree.parse(schedule_file).getroot()
+        rejected = []
+        transmissions = []
+        for frame in root.findall("Frame"):
+            frame_id = int(frame.findtext("FrameID"))
+            if frame.findtext("Rejected") == "1":
+                rejected.append(frame_id)
+            for link in frame.findall("Link"):
+                for instance in link.findall("Instance"):
+                    for replica in instance.findall("Replica"):
+                        transmissions.append([frame_id, int(link.findtext("LinkID")),
+                                              int(instance.findtext("NumInstance")),
+                                              int(replica.findtext("NumReplica")),
+                                              int(replica.findtext("Transmission_Time"))])
+        return int(root.findtext("Hyper_Period")), rejected, transmissions
+
+    def latencies(self, transmissions):
+        """
+        Get the largest latency of every frame in a schedule, from the start of its first hop to the end of its last hop
+        in any instance
+        :param transmissions: list of transmissions as [frame id, link id, instance, replica, time in ns]
+        :type transmissions: list of list of int
+        :return: largest latency in ns of every transmitted frame by its identifier
+        :rtype: dict of int
+        """
+        hops = {}
+        for frame_id, link_id, instance, replica, time in transmissions:
+            if replica == 0:
+                hops.setdefault((frame_id, instance), []).append((time, time + self.timeslot(frame_id, link_id)))
+        latencies = {}
+        for (frame_id, _), times in hops.items():
+            latency = max(end for _, end in times) - min(start for start, _ in times)
+            latencies[frame_id] = max(latency, latencies.get(frame_id, 0))
+        return latencies
+
+    def check(self, hyper_period, rejected, transmissions):
+        """
+        Check a schedule of the network
+        :param hyper_period: hyper-period of the schedule in ns
+        :type hyper_period: int
+        :param rejected: identifiers of the frames that were not scheduled
+        :type rejected: list of int
+        :param transmissions: list of transmissions as [frame id, link id, instance, replica, time in ns]
+        :type transmissions: list of list of int
+        :return: description of every violation found, empty if the schedule is correct
+        :rtype: list of str
+        """
+        errors = []
+        times = {}
+        for frame_id, link_id, instance, replica, time in transmissions:
+            times[(frame_id, link_id, instance, replica)] = time
+
+        for frame_id, frame in self.__frames.items():
+            links = sorted({link_id for (transmitted, link_id, _, _) in times if transmitted == frame_id})
+            if frame_id in rejected:
+                if links:
+                    errors.append("Frame %d is rejected but transmitted" % frame_id)
+                continue
+            instances = hyper_period // frame["period"]
+
+            # Every instance is transmitted in its window
+            for link_id in links:
+                timeslot = self.timeslot(frame_id, link_id)
+                for instance in range(instances):
+                    time = times.get((frame_id, link_id, instance, 0))
+                    start = instance * frame["period"]
+                    if time is None:
+                        errors.append("Frame %d instance %d is not transmitted in link %d" %
+                                      (frame_id, instance, link_id))
+                    elif time < start + max(frame["starting"], 1) or time + timeslot > start + frame["deadline"]:
+                        errors.append("Frame %d instance %d is out of its window in link %d" %
+                                      (frame_id, instance, link_id))
+
+            # Every receiver is reached by a path with all its links transmitted, in order and within the delay
+            used_links = set()
+            for receiver in frame["receivers"]:
+                paths = [path for path in self.__paths.get((frame["sender"], receiver), [])
+                         if all(link_id in links for link_id in path)]
+                if not paths:
+                    errors.append("Frame %d does not reach the receiver %d" % (frame_id, receiver))
+                for path in paths:
+                    used_links.update(path)
+                    for instance in range(instances):
+                        hops = [times.get((frame_id, link_id, instance, 0)) for link_id in path]
+                        if None in hops:
+                            continue
+                        for hop in range(len(path) - 1):
+                            if hops[hop] + self.timeslot(frame_id, path[hop]) + self.__switch_time > hops[hop + 1]:
+                                errors.append("Frame %d instance %d is transmitted in link %d before link %d" %
+                                              (frame_id, instance, path[hop + 1], path[hop]))
+                        if hops[-1] + self.timeslot(frame_id, path[-1]) - hops[0] > frame["end_to_end"]:
+                            errors.append("Frame %d instance %d exceeds its end to end delay to the receiver %d" %
+                                          (frame_id, instance, receiver))
+            for link_id in links:
+                if link_id not in used_links:
+                    errors.append("Frame %d is transmitted in link %d out of its paths" % (frame_id, link_id))
+
+        # Two transmissions of the same link do not overlap, nor start within the separation after the other
+        for link_id, link in self.__links.items():
+            busy = sorted((time, time + self.timeslot(frame_id, link_id) + link["separation"], frame_id)
+                          for (frame_id, transmitted, _, _), time in times.items() if transmitted == link_id)
+            for previous, current in zip(busy, busy[1:]):
+                if current[0] < previous[1]:
+                    errors.append("Frames %d and %d overlap in link %d at %d ns" %
+                                  (previous[2], current[2], link_id, current[0]))
+        return errors
+
+    def check_file(self, schedule_file):
+        """
+        Check a schedule xml written by the scheduler
+        :param schedule_file: name of the file with the schedule
+        :type schedule_file: str
+        :return: description of every violation found, empty if the schedule is correct
+        :rtype: list of str
+        """
+        return self.check(*self.read_schedule(schedule_file))
@@ -0,0 +1,589 @@
+# -*- coding: utf-8 -*-
+
+"""* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                                                                     *
+ *  Scheduler Tests                                                                                                    *
+ *  Organic Scheduler                                                                                                  *
+ *                                                                                                                     *
+ *  Created by agent on 18/10/26.                                                                                      *
+ *  Copyright © 2026 agent. All rights reserved.                                                                       *
+ *                                                                                                                     *
+ *  Tests that schedule the small networks of XML Files with the executable of the Organic Scheduler given in the      *
+ *  environment variable ORGANIC_SCHEDULER, and check every written schedule with the schedule checker. They are run   *
+ *  from this directory with "ORGANIC_SCHEDULER=/path/to/Scheduler python3 -m unittest test_scheduler", and skipped if *
+ *  the variable is not set.                                                                                           *
+ *                                                                                                                     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * """
+
+import importlib.util
+import os
+import re
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+import unittest
+from ScheduleChecker import ScheduleChecker
+
+SCHEDULER = os.environ.get("ORGANIC_SCHEDULER")
+XML_DIRECTORY = os.path.join(os.path.dirname(os.path.abspath(__file__)), "XML Files")
+GENERATOR_DIRECTORY = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "Network Generator",
+                                   "Network Generator")
+sys.path.append(GENERATOR_DIRECTORY)
+BINDINGS = importlib.util.find_spec("_organic_scheduler") is not None
+
+
+@unittest.skipIf(SCHEDULER is None, "ORGANIC_SCHEDULER is not set to the executable of the scheduler")
+class SchedulerTestCase(unittest.TestCase):
+    """
+    Class with the helpers of the tests, to write the configurations and check the schedules
+    """
+
+    def setUp(self):
+        """
+        Create the directory where the configurations and schedules of the test are written
+        """
+        self.directory = tempfile.mkdtemp()
+
+    def tearDown(self):
+        """
+        Remove the directory of the test
+        """
+        shutil.rmtree(self.directory)
+
+    def write_configuration(self, solver="z3", time_limit=60, **parameters):
+        """
+        Write a schedule configuration in the directory of the test
+        :param solver: name of the solver
+        :type solver: str
+        :param time_limit: time limit of the solver in seconds
+        :type time_limit: int
+        :param parameters: parameters of the configuration, as Mode="hierarchical", the rest of the mandatory ones
+                           take a default value
+        :return: name of the configuration file
+        :rtype: str
+        """
+        configuration_file = os.path.join(self.directory, "Configuration.xml")
+        mandatory = [("TimeLimit", time_limit), ("Optimization", 0), ("PathSelector", 0), ("FrameDistanceWeigth", 1.0),
+                     ("LinkDistanceWeigth", 1.0), ("Tune", 0), ("TuneTimeLimit", 0), ("Solver", solver)]
+        with open(configuration_file, "w") as configuration:
+            configuration.write("<?xml version=\"1.0\" ?>\n<ScheduleConfiguration>\n")
+            for name, value in [(name, parameters.pop(name, value)) for name, value in mandatory] + \
+                    list(parameters.items()):
+                configuration.write("    <%s>%s</%s>\n" % (name, value, name))
+            configuration.write("</ScheduleConfiguration>\n")
+        return configuration_file
+
+    def schedule(self, network, solver="z3", **parameters):
+        """
+        Schedule a network of XML Files with the scheduler
+        :param network: name of the network file in XML Files
+        :type network: str
+        :param solver: name of the solver
+        :type solver: str
+        :param parameters: optional parameters of the configuration
+        :return: exit status of the scheduler, its output and the name of the schedule file
+        :rtype: (int, str, str)
+        """
+        schedule_file = os.path.join(self.directory, "Schedule.xml")
+        process = subprocess.run([SCHEDULER, "-n", os.path.join(XML_DIRECTORY, network),
+                                  "-c", self.write_configuration(solver, **parameters), "-o", schedule_file],
+                                 stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True,
+                                 cwd=self.directory, timeout=300)
+        return process.returncode, process.stdout, schedule_file
+
+    def assert_schedule(self, network, schedule_file, rejected=None):
+        """
+        Check that the schedule of a network is correct, and that only the given frames were rejected
+        :param network: name of the network file in XML Files
+        :type network: str
+        :param schedule_file: name of the schedule file
+        :type schedule_file: str
+        :param rejected: identifiers of the frames that should be rejected, none by default
+        :type rejected: list of int
+        """
+        checker = ScheduleChecker(os.path.join(XML_DIRECTORY, network))
+        hyper_period, schedule_rejected, transmissions = checker.read_schedule(schedule_file)
+        self.assertEqual(sorted(schedule_rejected), sorted(rejected or []))
+        self.assertEqual(checker.check(hyper_period, schedule_rejected, transmissions), [])
+
+    def batch(self, networks, solver="z3", stats_file=None, **parameters):
+        """
+        Schedule a batch with copies of networks of XML Files with the scheduler
+        :param networks: names of the network files in XML Files
+        :type networks: list of str
+        :param solver: name of the solver
+        :type solver: str
+        :param stats_file: name of the file for the statistics, None to read them from the output
+        :type stats_file: str
+        :param parameters: optional parameters of the configuration
+        :return: exit status of the scheduler, its output, the statistics of every network file and the output directory
+        :rtype: (int, str, dict of dict of str, str)
+        """
+        input_directory = os.path.join(self.directory, "Networks")
+        output_directory = os.path.join(self.directory, "Schedules")
+        os.mkdir(input_directory)
+        for network in networks:
+            shutil.copy(os.path.join(XML_DIRECTORY, network), input_directory)
+        arguments = [SCHEDULER, "-b", input_directory, "-c", self.write_configuration(solver, **parameters),
+                     "-o", output_directory, "-j", "2"]
+        if stats_file is not None:
+            arguments += ["-S", stats_file]
+        process = subprocess.run(arguments, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True,
+                                 cwd=self.directory, timeout=300)
+        stats_lines = process.stdout
+        if stats_file is not None:
+            with open(stats_file) as stats:
+                stats_lines = stats.read()
+        stats = {}
+        for line in stats_lines.splitlines():
+            fields = line.split()
+            if len(fields) > 1 and all("=" in field for field in fields[1:]):
+                stats[os.path.basename(fields[0])] = dict(field.split("=", 1) for field in fields[1:])
+        return process.returncode, process.stdout, stats, output_directory
+
+    def assert_batch(self, networks, stats, output_directory):
+        """
+        Check that every network of a batch was scheduled with a model, and that its schedule is correct
+        :param networks: names of the network files in XML Files
+        :type networks: list of str
+        :param stats: statistics of every network file
+        :type stats: dict of dict of str
+        :param output_directory: directory with the outputs of the batch
+        :type output_directory: str
+        """
+        self.assertEqual(sorted(stats), sorted(networks))
+        for network in networks:
+            self.assertEqual(stats[network]["status"], "scheduled", stats[network])
+            self.assertGreater(int(stats[network]["constraints"]), 0)
+            self.assertEqual(int(stats[network]["rejected"]), 0)
+            self.assert_schedule(network, os.path.join(output_directory, network[:-4] + "_Schedule.xml"))
+
+    def assert_one_path(self, schedule_file):
+        """
+        Check that every frame of the routing network is transmitted in the links of only one of its paths, the direct
+        one with two links or the one through the second switch with three links
+        :param schedule_file: name of the schedule file
+        :type schedule_file: str
+        """
+        links = {}
+        for frame_id, link_id, _, _, _ in ScheduleChecker.read_schedule(schedule_file)[2]:
+            links.setdefault(frame_id, set()).add(link_id)
+        for frame_id, frame_links in links.items():
+            self.assertIn(len(frame_links), [2, 3], "Frame %d is transmitted in the links %s" % (frame_id, frame_links))
+
+
+class SchedulerTest(SchedulerTestCase):
+    """
+    Class with the tests that schedule a network with every mode and backend, and check the written schedules
+    """
+
+    def test_hierarchical(self):
+        """
+        The backbone links are fixed first and the rest of links are scheduled around them
+        """
+        status, output, schedule_file = self.schedule("Network.xml", Mode="hierarchical")
+        self.assertEqual(status, 0, output)
+        self.assert_schedule("Network.xml", schedule_file)
+
+    def test_hierarchical_fallback(self):
+        """
+        With the slow link as the only backbone link, its fixed offsets leave no room for the fast frame in the shared
+        link, so all the links are scheduled at once
+        """
+        status, output, schedule_file = self.schedule("Network.xml", Mode="hierarchical", BackboneLinks=1)
+        self.assertEqual(status, 0, output)
+        self.assertIn("scheduling all links at once", output)
+        self.assert_schedule("Network.xml", schedule_file)
+
+    def test_priority(self):
+        """
+        The frame of the middle class only fits if the frame of the highest class moves, and the frames of the two
+        lowest classes cannot meet their deadline together, so only the lowest class is rejected. The scheduler fails
+        as a class is rejected, but it writes the schedule of the higher classes
+        """
+        status, output, schedule_file = self.schedule("Priority.xml", Mode="priority")
+        self.assertNotEqual(status, 0, output)
+        self.assertIn("Rejected the frames of the priority class 0 and lower", output)
+        self.assert_schedule("Priority.xml", schedule_file, rejected=[2])
+
+    def test_latency_objective(self):
+        """
+        The frames of the slow link can arrive right after their transmission in it, so the largest latency is the time
+        to transmit a frame in both links of its path
+        """
+        status, output, schedule_file = self.schedule("Latency.xml", Objective="latency_max")
+        self.assertEqual(status, 0, output)
+        self.assert_schedule("Latency.xml", schedule_file)
+        checker = ScheduleChecker(os.path.join(XML_DIRECTORY, "Latency.xml"))
+        self.assertEqual(max(checker.latencies(checker.read_schedule(schedule_file)[2]).values()), 110000)
+
+    def test_pareto(self):
+        """
+        Every point of the pareto front is a schedule with more spacing and no less latency than the previous one, and
+        the solver is called at most twice per point
+        """
+        status, output, schedule_file = self.schedule("Latency.xml", Mode="pareto", Objective="latency_max",
+                                                      ParetoPoints=3)
+        self.assertEqual(status, 0, output)
+        points = [(int(latency), int(spacing)) for latency, spacing in
+                  re.findall(r"Pareto point \d+: latency (\d+) ns, spacing (\d+) ns", output)]
+        calls = re.search(r"Found (\d+) points of the pareto front in (\d+) calls", output)
+        self.assertEqual(len(points), 3, output)
+        self.assertEqual(int(calls.group(1)), 3)
+        self.assertLessEqual(int(calls.group(2)), 6)
+        checker = ScheduleChecker(os.path.join(XML_DIRECTORY, "Latency.xml"))
+        for point, (latency, spacing) in enumerate(points):
+            point_file = schedule_file.replace(".xml", "_%d.xml" % point)
+            self.assert_schedule("Latency.xml", point_file)
+            self.assertEqual(max(checker.latencies(checker.read_schedule(point_file)[2]).values()), latency)
+            if point > 0:
+                self.assertGreater(spacing, points[point - 1][1])
+                self.assertGreaterEqual(latency, points[point - 1][0])
+
+    def test_guard_band(self):
+        """
+        Every transmission in a link leaves the guard band of its link type and the precision of the node that transmits
+        before the next one
+        """
+        status, output, schedule_file = self.schedule("Guard_Band.xml")
+        self.assertEqual(status, 0, output)
+        self.assert_schedule("Guard_Band.xml", schedule_file)
+
+    def test_link_out_of_range(self):
+        """
+        A link with an identifier larger than the number of links stops the parse with an error
+        """
+        status, output, schedule_file = self.schedule("Link_Out_Of_Range.xml")
+        self.assertGreater(status, 0, output)
+        self.assertIn("Error reading the links information", output)
+        self.assertFalse(os.path.exists(schedule_file))
+
+    def test_path_selector(self):
+        """
+        The direct link only fits two frames, so the solver has to send the rest through the second switch
+        """
+        status, output, schedule_file = self.schedule("Routing.xml", PathSelector=1)
+        self.assertEqual(status, 0, output)
+        self.assert_schedule("Routing.xml", schedule_file)
+        self.assert_one_path(schedule_file)
+
+    def test_pre_routing(self):
+        """
+        The frames are routed before scheduling to balance the links, so the direct link is not overloaded
+        """
+        status, output, schedule_file = self.schedule("Routing.xml", PreRouting=5)
+        self.assertEqual(status, 0, output)
+        self.assert_schedule("Routing.xml", schedule_file)
+        self.assert_one_path(schedule_file)
+
+    def test_benders(self):
+        """
+        The routing is chosen by the master problem and every group of frames is scheduled in its own process
+        """
+        status, output, schedule_file = self.schedule("Routing.xml", Mode="benders", BendersWorkers=2)
+        self.assertEqual(status, 0, output)
+        self.assert_schedule("Routing.xml", schedule_file)
+        self.assert_one_path(schedule_file)
+
+    def test_highs(self):
+        """
+        The open source MIP backend schedules the network with the guarded big-M rows of the disjunctions
+        """
+        status, output, schedule_file = self.schedule("Latency.xml", solver="highs")
+        self.assertEqual(status, 0, output)
+        self.assert_schedule("Latency.xml", schedule_file)
+
+    def test_z3(self):
+        """
+        The z3 backend schedules the network in one shot
+        """
+        status, output, schedule_file = self.schedule("Network.xml", solver="z3")
+        self.assertEqual(status, 0, output)
+        self.assert_schedule("Network.xml", schedule_file)
+
+    def test_missing_backend(self):
+        """
+        A solver that is neither built in nor a shared library that can be loaded is rejected with the configuration
+        """
+        status, output, schedule_file = self.schedule("Network.xml", solver="./libmissing.so")
+        self.assertGreater(status, 0, output)
+        self.assertIn("Solver not recognized", output)
+
+    def test_cp(self):
+        """
+        The CP engine keeps the separation of the guard bands in the disjunctive resource of every link
+        """
+        status, output, schedule_file = self.schedule("Guard_Band.xml", solver="cp")
+        self.assertEqual(status, 0, output)
+        self.assert_schedule("Guard_Band.xml", schedule_file)
+
+    def test_cp_latency_objective(self):
+        """
+        The CP engine minimizes the largest latency as well as the z3 backend
+        """
+        status, output, schedule_file = self.schedule("Latency.xml", solver="cp", Objective="latency_max")
+        self.assertEqual(status, 0, output)
+        self.assert_schedule("Latency.xml", schedule_file)
+        checker = ScheduleChecker(os.path.join(XML_DIRECTORY, "Latency.xml"))
+        self.assertEqual(max(checker.latencies(checker.read_schedule(schedule_file)[2]).values()), 110000)
+
+    def test_sat(self):
+        """
+        The time-indexed SAT encoding rounds the timeslots up to whole macroticks, and the schedule it decodes still
+        keeps every constraint in ns
+        """
+        status, output, schedule_file = self.schedule("Latency.xml", solver="sat", Macrotick=1000)
+        self.assertEqual(status, 0, output)
+        self.assert_schedule("Latency.xml", schedule_file)
+
+    def test_subset(self):
+        """
+        The two frames with the short deadline cannot be scheduled together, so only one of them is rejected
+        """
+        status, output, schedule_file = self.schedule("Priority.xml", Mode="subset")
+        self.assertEqual(status, 0, output)
+        rejected = ScheduleChecker.read_schedule(schedule_file)[1]
+        self.assertEqual(len(rejected), 1, output)
+        self.assertIn(rejected[0], [1, 2])
+        self.assert_schedule("Priority.xml", schedule_file, rejected=rejected)
+
+    def test_subset_priority(self):
+        """
+        Weighted by their priority, the frame of the lowest class is the one rejected
+        """
+        status, output, schedule_file = self.schedule("Priority.xml", Mode="subset", SubsetWeights="priority")
+        self.assertEqual(status, 0, output)
+        self.assert_schedule("Priority.xml", schedule_file, rejected=[2])
+
+    def test_conflict_analysis(self):
+        """
+        Without the priority classes the network cannot be scheduled, and the conflict names the two frames with the
+        short deadline
+        """
+        status, output, schedule_file = self.schedule("Priority.xml", ConflictAnalysis=1)
+        self.assertGreater(status, 0, output)
+        self.assertIn("Frames in conflict: 1 2\n", output)
+        self.assertFalse(os.path.exists(schedule_file))
+
+    def test_stats(self):
+        """
+        The line of statistics of a network counts its frames, links and the constraints of its model
+        """
+        schedule_file = os.path.join(self.directory, "Schedule.xml")
+        process = subprocess.run([SCHEDULER, "-n", os.path.join(XML_DIRECTORY, "Network.xml"), "-c",
+                                  self.write_configuration(), "-o", schedule_file, "-s"], stdout=subprocess.PIPE,
+                                 stderr=subprocess.STDOUT, universal_newlines=True, cwd=self.directory, timeout=300)
+        self.assertEqual(process.returncode, 0, process.stdout)
+        self.assert_schedule("Network.xml", schedule_file)
+        stats = re.search(r"Network.xml status=scheduled result=0 frames=6 links=3 utilization=\S+ "
+                          r"constraints=(\d+) rejected=0 ", process.stdout)
+        self.assertIsNotNone(stats, process.stdout)
+        self.assertGreater(int(stats.group(1)), 0)
+
+    def test_batch(self):
+        """
+        Every network of the batch is scheduled in its own process and gets its schedule and line in the stats file
+        """
+        networks = ["Network.xml", "Latency.xml", "Guard_Band.xml"]
+        status, output, stats, output_directory = self.batch(networks,
+                                                             stats_file=os.path.join(self.directory, "Stats.txt"))
+        self.assertEqual(status, 0, output)
+        self.assert_batch(networks, stats, output_directory)
+
+    def test_batch_cp(self):
+        """
+        The batch with the CP engine writes the lines in the output, with the constraints of the model kept after it
+        is freed
+        """
+        networks = ["Latency.xml", "Guard_Band.xml"]
+        status, output, stats, output_directory = self.batch(networks, solver="cp")
+        self.assertEqual(status, 0, output)
+        self.assert_batch(networks, stats, output_directory)
+
+
+class DaemonTest(SchedulerTestCase):
+    """
+    Class with the tests that send requests to the scheduler daemon through its socket
+    """
+
+    def setUp(self):
+        """
+        Start the daemon with two workers in the directory of the test, and wait until it listens
+        """
+        super().setUp()
+        self.socket_path = os.path.join(self.directory, "scheduler.sock")
+        self.daemon = subprocess.Popen([SCHEDULER, "-d", self.socket_path, "-j", "2"], stdout=subprocess.DEVNULL,
+                                       stderr=subprocess.DEVNULL, cwd=self.directory)
+        for _ in range(100):
+            if os.path.exists(self.socket_path):
+                break
+            time.sleep(0.05)
+
+    def tearDown(self):
+        """
+        Stop the daemon and remove the directory of the test
+        """
+        self.daemon.terminate()
+        self.daemon.wait(timeout=30)
+        super().tearDown()
+
+    def request(self, command, network, configuration_file):
+        """
+        Send a request to the daemon and wait for its response
+        :param command: schedule, validate or admission
+        :type command: str
+        :param network: name of the network file in XML Files
+        :type network: str
+        :param configuration_file: name of the configuration file
+        :type configuration_file: str
+        :return: ok or error, and the data of the response
+        :rtype: (str, str)
+        """
+        with open(os.path.join(XML_DIRECTORY, network), "rb") as network_file:
+            network_xml = network_file.read()
+        with open(configuration_file, "rb") as configuration:
+            configuration_xml = configuration.read()
+        client = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        client.settimeout(300)
+        client.connect(self.socket_path)
+        client.sendall(("%s %d %d\n" % (command, len(network_xml), len(configuration_xml))).encode() + network_xml +
+                       configuration_xml)
+        response = b""
+        while True:
+            data = client.recv(65536)
+            if not data:
+                break
+            response += data
+        client.close()
+        header, _, data = response.partition(b"\n")
+        status, size = header.decode().split()
+        self.assertEqual(int(size), len(data))
+        return status, data.decode()
+
+    def test_schedule(self):
+        """
+        The network is parsed by the first request and kept for the second one, both schedules are correct
+        """
+        configuration_file = self.write_configuration()
+        for _ in range(2):
+            status, schedule = self.request("schedule", "Network.xml", configuration_file)
+            self.assertEqual(status, "ok", schedule)
+            schedule_file = os.path.join(self.directory, "Schedule.xml")
+            with open(schedule_file, "w") as schedule_xml:
+                schedule_xml.write(schedule)
+            self.assert_schedule("Network.xml", schedule_file)
+
+    def test_validate(self):
+        """
+        The validation reports the size of the network without scheduling it
+        """
+        status, report = self.request("validate", "Network.xml", self.write_configuration())
+        self.assertEqual(status, "ok", report)
+        self.assertTrue(report.startswith("valid\nframes 6\nlinks 3\n"), report)
+
+    def test_admission(self):
+        """
+        The admission rejects one of the two frames with the short deadline
+        """
+        status, report = self.request("admission", "Priority.xml", self.write_configuration())
+        self.assertEqual(status, "ok", report)
+        self.assertTrue(report.startswith("admitted 2 of 3\n"), report)
+
+    def test_restricted_configuration(self):
+        """
+        The configuration of a client cannot load a library as solver, and its export is ignored
+        """
+        status, report = self.request("schedule", "Network.xml", self.write_configuration("./libmissing.so"))
+        self.assertEqual(status, "error", report)
+        export_file = os.path.join(self.directory, "Model.smt2")
+        status, report = self.request("schedule", "Network.xml",
+                                      self.write_configuration(Export="smt2", ExportFile=export_file))
+        self.assertEqual(status, "ok", report)
+        self.assertFalse(os.path.exists(export_file))
+
+
+@unittest.skipIf(not BINDINGS, "The bindings are not built, run scheduler_build.py in the Network Generator")
+class BindingsTest(unittest.TestCase):
+    """
+    Class with the tests that schedule networks built in memory through the bindings of the Network Generator
+    """
+
+    @staticmethod
+    def schedule_network(node_types, links, paths, frames, path_selector=0):
+        """
+        Schedule a network built in memory with the z3 backend
+        :param node_types: type of every node
+        :type node_types: list of Node.NodeType
+        :param links: list of links as [source node id, destination node id, speed]
+        :type links: list of list of int
+        :param paths: list of paths as [sender id, receiver id, list of link ids], empty to compute them
+        :type paths: list of list
+        :param frames: list of frames as [sender id, period, deadline, end to end delay], all to the last node
+        :type frames: list of list of int
+        :param path_selector: 1 to let the solver choose one of the paths of every frame, 0 to use all of them
+        :type path_selector: int
+        :return: the schedule of the network
+        :rtype: Schedule
+        """
+        from Frame import Frame
+        from Link import Link
+        from Schedule import Schedule
+
+        configuration = "<ScheduleConfiguration><TimeLimit>60</TimeLimit><Optimization>0</Optimization>" \
+                        "<PathSelector>%d</PathSelector><FrameDistanceWeigth>1.0</FrameDistanceWeigth>" \
+                        "<LinkDistanceWeigth>1.0</LinkDistanceWeigth><Tune>0</Tune><TuneTimeLimit>0</TuneTimeLimit>" \
+                        "<Solver>z3</Solver></ScheduleConfiguration>" % path_selector
+        return Schedule.schedule_network(node_types, [[source, destination, Link(speed)]
+                                                      for source, destination, speed in links], paths,
+                                         [Frame(sender, [len(node_types) - 1], period, deadline, 1000, 0, end_to_end)
+                                          for sender, period, deadline, end_to_end in frames], configuration)
+
+    def assert_schedule(self, network, schedule):
+        """
+        Check that the schedule of a network built in memory is correct, against the same network in XML Files
+        :param network: name of the network file in XML Files
+        :type network: str
+        :param schedule: schedule returned by the bindings
+        :type schedule: Schedule
+        """
+        self.assertEqual(schedule.status, 0)
+        self.assertEqual(schedule.rejected_frames, [])
+        checker = ScheduleChecker(os.path.join(XML_DIRECTORY, network))
+        self.assertEqual(checker.check(schedule.hyper_period, schedule.rejected_frames, schedule.transmissions), [])
+
+    def test_bindings(self):
+        """
+        The network built in memory gets a correct schedule, with the given paths and with the computed ones, in the
+        same process
+        """
+        from Node import Node
+
+        node_types = [Node.NodeType.end_system, Node.NodeType.end_system, Node.NodeType.switch,
+                      Node.NodeType.end_system]
+        links = [[0, 2, 10], [1, 2, 100], [2, 3, 100]]
+        frames = [[0, 10000000, 10000000, 110000]] * 5 + [[1, 50000, 50000, 50000]]
+        for paths in [[[0, 3, [0, 2]], [1, 3, [1, 2]]], []]:
+            self.assert_schedule("Network.xml", self.schedule_network(node_types, links, paths, frames))
+
+    def test_bindings_path_selector(self):
+        """
+        The transmissions returned for the network built in memory are only the ones of the path chosen for every frame
+        """
+        from Node import Node
+
+        node_types = [Node.NodeType.end_system, Node.NodeType.end_system, Node.NodeType.switch, Node.NodeType.switch,
+                      Node.NodeType.end_system]
+        links = [[0, 2, 100], [1, 2, 100], [2, 4, 25], [2, 3, 100], [3, 4, 100]]
+        paths = [[0, 4, [0, 2]], [0, 4, [0, 3, 4]], [1, 4, [1, 2]], [1, 4, [1, 3, 4]]]
+        frames = [[0, 100000, 100000, 100000]] * 3 + [[1, 100000, 100000, 100000]] * 3
+        schedule = self.schedule_network(node_types, links, paths, frames, path_selector=1)
+        self.assert_schedule("Routing.xml", schedule)
+        for frame_id in range(len(frames)):
+            frame_links = {transmission[0] for transmission in schedule.get_frame_transmissions(frame_id)}
+            self.assertIn(len(frame_links), [2, 3], "Frame %d is transmitted in the links %s" % (frame_id, frame_links))
+
+if __name__ == "__main__":
+    unittest.main()